@@ -32,7 +32,8 @@
 ACC::ACC(int NID, PacketBuffer* Bf, Settings *S): CongestionControl(NID, Bf, S)
 {
 	this->information = NULL;
-	Buff->enableBufferRecording();
+	/* Buffer statistics are requested over the remaining TTL of a packet */
+	Buff->enableBufferRecording(S->getTTL());
 
 	return;
 }
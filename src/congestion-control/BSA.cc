@@ -35,7 +35,8 @@ BSA::BSA(int NID, PacketBuffer *Bf, Settings *S): CongestionControl(NID, Bf, S)
 	this->lastUpdate = 0.0;
 	this->scanningInterval = S->getScanningInterval();
 	this->congestionThreshold = INITIAL_THRESHOLD;
-	Buff->enableBufferRecording();
+	/* Buffer statistics are requested since the last update */
+	Buff->enableBufferRecording(-1.0);
 
 	if(this->scanningInterval < 0.0)
 	{
@@ -100,6 +101,7 @@ void BSA::receivedBufferReq(double currentTime, int reqNode)
 			printf("@%f Node %d: Updated congestion threshold = %f\n", lastUpdate, nodeID, congestionThreshold);
 		#endif
 	}
+	Buff->releaseBufferRecords(lastUpdate);
 
 	return;
 }
@@ -41,6 +41,10 @@ CACC::CACC(int NID, PacketBuffer* Bf, Settings *S): CongestionControl(NID, Bf, S
 
 CACC::~CACC()
 {
+	if(this->extraInformation != NULL)
+	{
+		AMT::releaseView(this->extraInformation);
+	}
 	delete this->AMTUtils;
 
 	return;
@@ -85,14 +89,8 @@ void CACC::addBufferInfo(void* info)
 
 void *CACC::getExtraInfo(double currTime)
 {
-	struct CACCExtraInformation *extraInfo;
-
-
-	extraInfo = (struct CACCExtraInformation *) malloc(sizeof(struct CACCExtraInformation));
-	extraInfo->recContactNumber = this->AMTUtils->getDstContacts();
-	extraInfo->recAverageDuration = this->AMTUtils->getAverageDurations();
-
-	return (void *) extraInfo;
+	/* the receiver reads the contact numbers and average durations of this node without copying them */
+	return (void *) this->AMTUtils->getView();
 }
 
 
@@ -105,7 +103,11 @@ void CACC::setExtraInfo(void *extraInfo, double currTime)
 	}
 	else
 	{
-		this->extraInformation = (struct CACCExtraInformation *) extraInfo;
+		if(this->extraInformation != NULL)
+		{
+			AMT::releaseView(this->extraInformation);
+		}
+		this->extraInformation = (AMTView *) extraInfo;
 	}
 
 	return;
@@ -124,9 +126,9 @@ void CACC::addPacketInfo(struct ImportInformation *imp)
 	}
 
 	newInfo.packetID = imp->pktID;
-	newInfo.numContacts = this->extraInformation->recContactNumber[Buff->GetPktDestination(newInfo.packetID)];
+	newInfo.numContacts = (double) this->extraInformation->Ncontacts[Buff->GetPktDestination(newInfo.packetID)];
 	newInfo.normNumContacts = 0.0;
-	newInfo.avgDuration = this->extraInformation->recAverageDuration[Buff->GetPktDestination(newInfo.packetID)];
+	newInfo.avgDuration = this->extraInformation->AMTval[Buff->GetPktDestination(newInfo.packetID)];
 	newInfo.normAvgDuration = 0.0;
 	newInfo.gainValue = 0.0;
 
@@ -496,9 +498,7 @@ void CACC::releaseInformation()
 
 	if(this->extraInformation != NULL)
 	{
-		free(this->extraInformation->recContactNumber);
-		free(this->extraInformation->recAverageDuration);
-		free(this->extraInformation);
+		AMT::releaseView(this->extraInformation);
 		this->extraInformation = NULL;
 	}
 
@@ -45,18 +45,11 @@ struct CACCPacketInformation
 };
 
 
-struct CACCExtraInformation
-{
-	double *recContactNumber;
-	double *recAverageDuration;
-};
-
-
 class CACC: public CongestionControl
 {
 protected:
 	struct CongestionInformation *information;
-	struct CACCExtraInformation *extraInformation;
+	AMTView *extraInformation;
 	vector<CACCPacketInformation> pInfo;
 	AMT *AMTUtils;
 
@@ -54,3 +54,11 @@ void CongestionControl::initCCImportInfo(struct ImportInformation *info)
 
 	return;
 }
+
+
+void CongestionControl::Checkpoint(Snapshot *snap)
+{
+	snap->Unsupported("this congestion control mechanism");
+
+	return;
+}
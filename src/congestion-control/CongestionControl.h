@@ -76,4 +76,5 @@ public:
 	virtual void releaseInformation() = 0;
 	virtual int getBufferSize() = 0;
 	virtual int getBufferLength() = 0;
+	virtual void Checkpoint(Snapshot *snap);
 };
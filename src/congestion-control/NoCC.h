@@ -45,4 +45,5 @@ public:
 	virtual void releaseInformation();
 	virtual int getBufferSize();
 	virtual int getBufferLength();
+	virtual void Checkpoint(Snapshot *snap){return;};
 };
@@ -0,0 +1,266 @@
+/*
+ *  Adyton: A Network Simulator for Opportunistic Networks
+ *  Copyright (C) 2015  Nikolaos Papanikos, Dimitrios-Georgios Akestoridis,
+ *  and Evangelos Papapetrou
+ *
+ *  This file is part of Adyton.
+ *
+ *  Adyton is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Adyton is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Adyton.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef BUFFER_HISTORY_H
+	#define BUFFER_HISTORY_H
+	#include "BufferHistory.h"
+#endif
+
+#define INITIAL_HISTORY_CAPACITY 64
+
+
+/* Constructor:BufferHistory
+ * -------------------------
+ * Creates an empty history. Records that are older than horizon seconds are discarded
+ * (a negative horizon disables this).
+ */
+BufferHistory::BufferHistory(double horizon)
+{
+	this->Capacity = INITIAL_HISTORY_CAPACITY;
+	this->RegTime = (double *) malloc(this->Capacity * sizeof(double));
+	this->Before = (struct BufferActivity *) malloc(this->Capacity * sizeof(struct BufferActivity));
+	this->Head = 0;
+	this->Count = 0;
+	this->Horizon = horizon;
+	this->Floor = -DBL_MAX;
+	this->Total.Inserted = 0;
+	this->Total.Removed = 0;
+	this->Total.Dropped = 0;
+	this->Total.SumRTTL = 0.0;
+
+	return;
+}
+
+BufferHistory::~BufferHistory()
+{
+	free(this->RegTime);
+	free(this->Before);
+
+	return;
+}
+
+/* firstAtOrAfter
+ * --------------
+ * Returns the position of the oldest record that was registered at the given time or
+ * later. If there is no such record, the number of records is returned.
+ */
+int BufferHistory::firstAtOrAfter(double time)
+{
+	int low;
+	int high;
+	int mid;
+
+
+	low = 0;
+	high = this->Count;
+	while(low < high)
+	{
+		mid = (low + high) / 2;
+		if(this->RegTime[slot(mid)] < time)
+		{
+			low = mid + 1;
+		}
+		else
+		{
+			high = mid;
+		}
+	}
+
+	return low;
+}
+
+/* activityBefore
+ * --------------
+ * Returns the activity of the buffer before the record at the given position.
+ */
+struct BufferActivity BufferHistory::activityBefore(int pos)
+{
+	if(pos == this->Count)
+	{
+		return this->Total;
+	}
+
+	return this->Before[slot(pos)];
+}
+
+/* discardOld
+ * ----------
+ * Discards the records that were registered before the given time.
+ */
+void BufferHistory::discardOld(double oldest)
+{
+	while(this->Count > 0 && this->RegTime[this->Head] < oldest)
+	{
+		this->Head = (this->Head + 1) % this->Capacity;
+		this->Count--;
+	}
+
+	return;
+}
+
+/* append
+ * ------
+ * Registers a new record at the end of the ring, which grows if it is full. The record
+ * is followed by an update of the total activity.
+ */
+void BufferHistory::append(double now)
+{
+	int i;
+	double *newRegTime;
+	struct BufferActivity *newBefore;
+
+
+	if(this->Horizon >= 0.0)
+	{
+		discardOld(now - this->Horizon);
+	}
+
+	if(this->Count == this->Capacity)
+	{
+		newRegTime = (double *) malloc(2 * this->Capacity * sizeof(double));
+		newBefore = (struct BufferActivity *) malloc(2 * this->Capacity * sizeof(struct BufferActivity));
+		for(i = 0; i < this->Count; i++)
+		{
+			newRegTime[i] = this->RegTime[slot(i)];
+			newBefore[i] = this->Before[slot(i)];
+		}
+		free(this->RegTime);
+		free(this->Before);
+		this->RegTime = newRegTime;
+		this->Before = newBefore;
+		this->Capacity *= 2;
+		this->Head = 0;
+	}
+
+	this->RegTime[slot(this->Count)] = now;
+	this->Before[slot(this->Count)] = this->Total;
+	this->Count++;
+
+	return;
+}
+
+void BufferHistory::recordInsertion(double now, double pktRTTL)
+{
+	append(now);
+	this->Total.Inserted++;
+	this->Total.SumRTTL += pktRTTL;
+
+	return;
+}
+
+void BufferHistory::recordRemoval(double now)
+{
+	append(now);
+	this->Total.Removed++;
+
+	return;
+}
+
+void BufferHistory::recordDrop(double now)
+{
+	append(now);
+	this->Total.Dropped++;
+
+	return;
+}
+
+/* release
+ * -------
+ * Informs the history that no period starting before the given time will be requested
+ * in the future.
+ */
+void BufferHistory::release(double before)
+{
+	if(before > this->Floor)
+	{
+		this->Floor = before;
+		discardOld(before);
+	}
+
+	return;
+}
+
+/* getActivity
+ * -----------
+ * Returns the activity of the buffer during the period [startTime, endTime). The start
+ * of the period must not precede the records that have been discarded.
+ */
+struct BufferActivity BufferHistory::getActivity(double startTime, double endTime)
+{
+	struct BufferActivity start;
+	struct BufferActivity end;
+	struct BufferActivity act;
+
+
+	start = activityBefore(firstAtOrAfter(startTime));
+	end = activityBefore(firstAtOrAfter(endTime));
+
+	act.Inserted = end.Inserted - start.Inserted;
+	act.Removed = end.Removed - start.Removed;
+	act.Dropped = end.Dropped - start.Dropped;
+	act.SumRTTL = end.SumRTTL - start.SumRTTL;
+
+	return act;
+}
+
+/* Checkpoint
+ * ----------
+ * Saves or restores the records of the history along with the total activity.
+ */
+void BufferHistory::Checkpoint(Snapshot *snap)
+{
+	int i;
+
+
+	snap->Match(this->Horizon, "buffer history horizon");
+	snap->Value(this->Floor);
+	snap->Value(this->Total.Inserted);
+	snap->Value(this->Total.Removed);
+	snap->Value(this->Total.Dropped);
+	snap->Value(this->Total.SumRTTL);
+	snap->Value(this->Count);
+
+	if(snap->isRestoring())
+	{
+		free(this->RegTime);
+		free(this->Before);
+		this->Capacity = INITIAL_HISTORY_CAPACITY;
+		while(this->Capacity < this->Count)
+		{
+			this->Capacity *= 2;
+		}
+		this->RegTime = (double *) malloc(this->Capacity * sizeof(double));
+		this->Before = (struct BufferActivity *) malloc(this->Capacity * sizeof(struct BufferActivity));
+		this->Head = 0;
+	}
+
+	for(i = 0; i < this->Count; i++)
+	{
+		snap->Value(this->RegTime[slot(i)]);
+		snap->Value(this->Before[slot(i)].Inserted);
+		snap->Value(this->Before[slot(i)].Removed);
+		snap->Value(this->Before[slot(i)].Dropped);
+		snap->Value(this->Before[slot(i)].SumRTTL);
+	}
+
+	return;
+}
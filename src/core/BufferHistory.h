@@ -0,0 +1,82 @@
+/*
+ *  Adyton: A Network Simulator for Opportunistic Networks
+ *  Copyright (C) 2015  Nikolaos Papanikos, Dimitrios-Georgios Akestoridis,
+ *  and Evangelos Papapetrou
+ *
+ *  This file is part of Adyton.
+ *
+ *  Adyton is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Adyton is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Adyton.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <float.h>
+
+#ifndef SNAPSHOT_H
+	#define SNAPSHOT_H
+	#include "Snapshot.h"
+#endif
+
+using namespace std;
+
+
+/* Activity of a packet buffer over some time period */
+struct BufferActivity
+{
+	unsigned long Inserted;
+	unsigned long Removed;
+	unsigned long Dropped;
+	long double SumRTTL;//sum of the remaining TTL values of the inserted packets
+};
+
+/* BufferHistory
+ * -------------
+ * Keeps the insertions, removals and drops of a packet buffer that took place during the
+ * last Horizon seconds. Each record holds the activity of the buffer before it, so that the
+ * activity over any period is the difference of two records. Records are registered in
+ * time order and are kept in a ring, hence periods are located with a binary search. Older
+ * records are discarded as new ones arrive, while the activity since the beginning of the
+ * simulation remains available. A negative horizon keeps the records until release()
+ * discards them.
+ */
+class BufferHistory
+{
+private:
+	double *RegTime;
+	struct BufferActivity *Before;
+	int Capacity;
+	int Head;
+	int Count;
+	double Horizon;
+	double Floor;
+	struct BufferActivity Total;
+
+	int slot(int pos){return (Head + pos) % Capacity;};
+	int firstAtOrAfter(double time);
+	struct BufferActivity activityBefore(int pos);
+	void discardOld(double oldest);
+	void append(double now);
+
+public:
+	BufferHistory(double horizon);
+	~BufferHistory();
+	void recordInsertion(double now, double pktRTTL);
+	void recordRemoval(double now);
+	void recordDrop(double now);
+	void release(double before);
+	struct BufferActivity getActivity(double startTime, double endTime);
+	struct BufferActivity getTotalActivity(void){return this->Total;};
+	void Checkpoint(Snapshot *snap);
+};
@@ -0,0 +1,189 @@
+/*
+ *  Adyton: A Network Simulator for Opportunistic Networks
+ *  Copyright (C) 2015  Nikolaos Papanikos, Dimitrios-Georgios Akestoridis,
+ *  and Evangelos Papapetrou
+ *
+ *  This file is part of Adyton.
+ *
+ *  Adyton is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Adyton is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Adyton.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef BUFFER_INDEX_H
+	#define BUFFER_INDEX_H
+	#include "BufferIndex.h"
+#endif
+
+
+/* Constructor:BufferIndex
+ * -----------------------
+ * Creates an empty index over the entries of the packet buffer of node ID. No ordering is
+ * maintained until a dropping policy requests it through enable(). The packets of every
+ * entry are also registered to the replica index of God.
+ */
+BufferIndex::BufferIndex(God *G, int ID)
+{
+	this->enabled = 0;
+	this->SGod = G;
+	this->NID = ID;
+	ByID.set_empty_key(-1);
+	ByID.set_deleted_key(-2);
+	return;
+}
+
+BufferIndex::~BufferIndex()
+{
+	ByCreation.clear();
+	RelaysByCreation.clear();
+	RelaysByArrival.clear();
+	ByID.clear();
+	return;
+}
+
+/* enable
+ * ------
+ * Starts maintaining the given ordering. It must be called before any entry is inserted
+ * into the buffer.
+ */
+void BufferIndex::enable(int idx)
+{
+	this->enabled |= idx;
+	return;
+}
+
+/* insert
+ * ------
+ * Registers a buffer entry to all enabled orderings. Relay packets (i.e., packets that
+ * have travelled at least one hop) are additionally kept in the relay orderings, which
+ * are used by the dropping policies that avoid source packets. Entries that are not
+ * encoded are always registered by their packet ID (a buffer holds at most one such
+ * entry per packet).
+ */
+void BufferIndex::insert(EntryPos pos)
+{
+	registerReplicas(pos, true);
+	if(!(*pos)->Encoded)
+	{
+		ByID[(*pos)->pktID] = pos;
+	}
+	if(!enabled)
+	{
+		return;
+	}
+	if(enabled & BY_CREATION_IDX)
+	{
+		ByCreation.insert(pos);
+	}
+	if((*pos)->Hops > 0)
+	{
+		if(enabled & RELAYS_BY_CREATION_IDX)
+		{
+			RelaysByCreation.insert(pos);
+		}
+		if(enabled & RELAYS_BY_ARRIVAL_IDX)
+		{
+			RelaysByArrival.insert(pos);
+		}
+	}
+	return;
+}
+
+/* remove
+ * ------
+ * Unregisters a buffer entry from all enabled orderings. It must be called before the
+ * entry is erased from the buffer or its number of hops is modified.
+ */
+void BufferIndex::remove(EntryPos pos)
+{
+	registerReplicas(pos, false);
+	if(!(*pos)->Encoded)
+	{
+		ByID.erase((*pos)->pktID);
+	}
+	if(!enabled)
+	{
+		return;
+	}
+	if(enabled & BY_CREATION_IDX)
+	{
+		ByCreation.erase(pos);
+	}
+	if((*pos)->Hops > 0)
+	{
+		if(enabled & RELAYS_BY_CREATION_IDX)
+		{
+			RelaysByCreation.erase(pos);
+		}
+		if(enabled & RELAYS_BY_ARRIVAL_IDX)
+		{
+			RelaysByArrival.erase(pos);
+		}
+	}
+	return;
+}
+
+/* registerReplicas
+ * ----------------
+ * Informs God that the packets of a buffer entry were stored (added = true) or discarded.
+ */
+void BufferIndex::registerReplicas(EntryPos pos, bool added)
+{
+	int i;
+
+
+	if(!(*pos)->Encoded)
+	{
+		if(added)
+		{
+			SGod->replicaAdded((*pos)->pktID, NID);
+		}
+		else
+		{
+			SGod->replicaRemoved((*pos)->pktID, NID);
+		}
+		return;
+	}
+
+	for(i = 0; i < (*pos)->CodingDepth; i++)
+	{
+		if(added)
+		{
+			SGod->replicaAdded((*pos)->Enc->PktIDs[i], NID);
+		}
+		else
+		{
+			SGod->replicaRemoved((*pos)->Enc->PktIDs[i], NID);
+		}
+	}
+	return;
+}
+
+/* lookup
+ * ------
+ * Finds the position of the entry (that is not encoded) of the packet with ID "pktID".
+ * Returns false if the buffer does not hold such an entry.
+ */
+bool BufferIndex::lookup(int pktID, EntryPos *pos)
+{
+	dense_hash_map<int, EntryPos>::iterator it;
+
+
+	it = ByID.find(pktID);
+	if(it == ByID.end())
+	{
+		return false;
+	}
+	*pos = it->second;
+	return true;
+}
@@ -0,0 +1,98 @@
+/*
+ *  Adyton: A Network Simulator for Opportunistic Networks
+ *  Copyright (C) 2015  Nikolaos Papanikos, Dimitrios-Georgios Akestoridis,
+ *  and Evangelos Papapetrou
+ *
+ *  This file is part of Adyton.
+ *
+ *  Adyton is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Adyton is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Adyton.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <list>
+#include <set>
+#include <google-sparsehash/google/dense_hash_map>
+
+#ifndef PACKET_ENTRY_H
+	#define PACKET_ENTRY_H
+	#include "PacketEntry.h"
+#endif
+
+#ifndef GOD_H
+	#define GOD_H
+	#include "God.h"
+#endif
+
+using namespace std;
+using google::dense_hash_map;
+
+#define BY_CREATION_IDX 1
+#define RELAYS_BY_CREATION_IDX 2
+#define RELAYS_BY_ARRIVAL_IDX 4
+
+typedef list<PacketEntry*>::iterator EntryPos;
+
+/* Entries with the same creation time are ordered according to their insertion
+ * sequence number, i.e., according to their position in the buffer.
+ */
+struct CreationOrder
+{
+	bool operator()(const EntryPos &a, const EntryPos &b) const
+	{
+		if((*a)->CreationTime != (*b)->CreationTime)
+		{
+			return (*a)->CreationTime < (*b)->CreationTime;
+		}
+		return (*a)->InsSeq < (*b)->InsSeq;
+	}
+};
+
+struct ArrivalOrder
+{
+	bool operator()(const EntryPos &a, const EntryPos &b) const
+	{
+		return (*a)->InsSeq < (*b)->InsSeq;
+	}
+};
+
+class BufferIndex
+{
+private:
+	int enabled;
+	God *SGod;
+	int NID;
+
+	void registerReplicas(EntryPos pos, bool added);
+
+public:
+	set<EntryPos, CreationOrder> ByCreation;
+	set<EntryPos, CreationOrder> RelaysByCreation;
+	set<EntryPos, ArrivalOrder> RelaysByArrival;
+	dense_hash_map<int, EntryPos> ByID;
+
+	BufferIndex(God *G, int ID);
+	~BufferIndex();
+	void enable(int idx);
+	void insert(EntryPos pos);
+	void remove(EntryPos pos);
+	bool lookup(int pktID, EntryPos *pos);
+	EntryPos oldest(void){return *(ByCreation.begin());};
+	EntryPos youngest(void){return *(ByCreation.rbegin());};
+	EntryPos oldestRelay(void){return *(RelaysByCreation.begin());};
+	EntryPos youngestRelay(void){return *(RelaysByCreation.rbegin());};
+	EntryPos firstRelay(void){return *(RelaysByArrival.begin());};
+	EntryPos lastRelay(void){return *(RelaysByArrival.rbegin());};
+};
@@ -156,3 +156,20 @@ bool ConnectionMap::AreConnected(int NodeA,int NodeB)
 		return false;
 	}
 }
+
+
+/* Checkpoint
+ * ----------
+ * Saves or restores the one hop neighborhood of every node.
+ */
+void ConnectionMap::Checkpoint(Snapshot *snap)
+{
+	snap->Section("CMAP");
+	snap->Match(this->NetworkNodes,"number of nodes");
+	for(int i=0;i<this->NetworkNodes;i++)
+	{
+		snap->Array(Map[i]->N,this->NetworkNodes);
+		snap->Value(Map[i]->NumberOfNodes);
+	}
+	return;
+}
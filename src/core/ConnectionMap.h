@@ -31,6 +31,11 @@
 	#include "Connection.h"
 #endif
 
+#ifndef SNAPSHOT_H
+	#define SNAPSHOT_H
+	#include "Snapshot.h"
+#endif
+
 /* ConnectionMap
  * -------------
  * This class contains the connections of all nodes of the network.
@@ -51,4 +56,5 @@ public:
 	int *GetReachableNodes(int NID);
 	void PrintConnections(int NodeID);
 	bool AreConnected(int NodeA,int NodeB);
+	void Checkpoint(Snapshot *snap);
 };
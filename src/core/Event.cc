@@ -135,6 +135,45 @@ void Transmission::printEvent(void)
 	return;
 }
 
+/* Constructor:Broadcast
+ * ---------------------
+ * Time: When transmission starts
+ * S: Sender
+ * R: Receivers (the event takes ownership of the list)
+ * num: Number of receivers
+ */
+Broadcast::Broadcast(double Time,int S,int *R,int num,int ID)
+{
+	this->EventID=5;
+	this->EventTime=Time;
+	this->NodeA=S;
+	this->NodeB=-1;
+	this->pktID=ID;
+	this->Receivers=R;
+	this->Remaining=num;
+	this->Next=NULL;
+}
+
+/* Destructor:Broadcast
+ * --------------------
+ * Frees the list of receivers.
+ */
+Broadcast::~Broadcast(void )
+{
+	free(this->Receivers);
+	return;
+}
+
+/* printEvent
+ * ----------
+ * For debugging purposes.
+ */
+void Broadcast::printEvent(void)
+{
+	printf("%f:%d transmitting to %d neighbors\n",this->EventTime,this->NodeA,this->Remaining);
+	return;
+}
+
 /* Constructor:CheckPoint
  * ----------------------
  * Only the second argument is used and corresponds to the line number of the last
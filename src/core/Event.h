@@ -96,6 +96,28 @@ public:
 	void setState(bool status){this->valid=status;};
 };
 
+/* Broadcast
+ * ---------
+ * This event describes the transmission of a packet to all the one hop neighbors
+ * of the sender. The receivers are served one at a time, starting from the last
+ * one of the list, so the event replaces one Transmission per receiver.
+ */
+class Broadcast:public Event
+{
+protected:
+	int pktID;
+	int *Receivers;
+	int Remaining;
+public:
+	Broadcast(double Time,int S,int *R,int num,int ID);
+	~Broadcast(void);
+	int getSender(void){return this->NodeA;};
+	int getpktID(void){return pktID;};
+	int NextReceiver(void){return Receivers[--Remaining];};
+	bool hasReceivers(void){return (Remaining > 0);};
+	virtual void printEvent(void);
+};
+
 /* CheckPoint
  * ---------
  * This event specifies that a new contact import from the trace file should 
@@ -108,6 +108,40 @@ void EventList::InsertEvent(Event* e)
 	return;
 }
 
+/* InsertBatch
+ * -----------
+ * Inserts a batch of events that is already in time order. Each event is placed after
+ * the events of the list with the same time value, so the whole batch is merged with a
+ * single pass over the list.
+ */
+void EventList::InsertBatch(Event **batch, int count)
+{
+	Event *prev=NULL;
+	Event *runner=Top;
+
+	for(int i=0;i<count;i++)
+	{
+		Event *e=batch[i];
+		while(runner != NULL && runner->getEventTime() <= e->getEventTime())
+		{
+			prev=runner;
+			runner=runner->Next;
+		}
+		e->Next=runner;
+		if(prev == NULL)
+		{
+			Top=e;
+		}
+		else
+		{
+			prev->Next=e;
+		}
+		prev=e;
+	}
+	this->NumberEvents+=count;
+	return;
+}
+
 /* PrintList
  * ---------
  * Events are printed (debugging purposes)
@@ -121,4 +155,4 @@ void EventList::PrintList(void )
 		runner->printEvent();
 		runner=runner->Next;
 	}
-}
\ No newline at end of file
+}
\ No newline at end of file
@@ -46,6 +46,9 @@ private:
 public:
 	EventList(void);
 	void InsertEvent(class Event *e);
+	void InsertBatch(class Event **batch, int count);
 	class Event *GetTop(void);
+	class Event *PeekTop(void){return Top;};
+	double getMinTime(void){return MinTime;};
 	void PrintList(void);
 };
@@ -47,9 +47,15 @@ God::God(Settings *S)
 	this->Set = S;
 	this->SimNodes = Set->getNN();
 	this->CurTime = 0.0;
+	this->Concurrent = false;
 
 	DeliveredPkts.clear();
 
+	HCustodians.set_empty_key(-1);
+	Holders.set_empty_key(-1);
+	Holders.set_deleted_key(-2);
+	this->NumReplicas = 0;
+
 	NodeFriends = (int **) malloc(this->SimNodes * sizeof(int *));
 	for(i = 0; i < this->SimNodes; i++)
 	{
@@ -88,15 +94,10 @@ God::God(Settings *S)
 
 God::~God()
 {
-	vector<CHUtil*>::iterator it;
-
-
 	free(NodeFriends);
 
-	for (it = HCustodians.begin(); it != HCustodians.end(); ++it)
-	{
-		free((*it));
-	}
+	HCustodians.clear();
+	Holders.clear();
 
 	this->pktStats.clear();
 
@@ -149,6 +150,9 @@ void God::InitDelivered(int NumberOfPackets )
  */
 void God::AddDelivered(int pktID)
 {
+	ServiceGuard guard(&(this->Lock), this->Concurrent);
+
+
 	DeliveredPkts.insert(pktID);
 	return;
 }
@@ -160,6 +164,7 @@ void God::AddDelivered(int pktID)
  */
 bool God::IsDelivered(int pktID)
 {
+	ServiceGuard guard(&(this->Lock), this->Concurrent);
 	set<int>::iterator it=DeliveredPkts.find(pktID);
 	
 	if(it == DeliveredPkts.end())
@@ -313,26 +318,26 @@ double God::getMeanRTTL(int nodeID, double interval)
  */
 void God::updateCustodian(int PID,int NID,double Util)
 {
-	vector<CHUtil*>::iterator it;
-	for (it = HCustodians.begin(); it != HCustodians.end(); ++it)
+	dense_hash_map<int,CHUtil>::iterator it;
+	CHUtil tmp;
+
+
+	it = HCustodians.find(PID);
+	if(it != HCustodians.end())
 	{
-		if((*it)->PID == PID)
+		if(Util > it->second.Util)
 		{
-			if(Util > (*it)->Util)
-			{
-				//printf("Packet %d has now util %f\n",(*it)->PID,Util);
-				(*it)->Util=Util;
-				(*it)->Node=NID;
-			}
-			return;
+			//printf("Packet %d has now util %f\n",PID,Util);
+			it->second.Util=Util;
+			it->second.Node=NID;
 		}
+		return;
 	}
 	//Not found - create a new entry now
-	CHUtil*tmp=(CHUtil*)malloc(sizeof(CHUtil));
-	tmp->PID=PID;
-	tmp->Node=NID;
-	tmp->Util=Util;
-	HCustodians.push_back(tmp);
+	tmp.PID=PID;
+	tmp.Node=NID;
+	tmp.Util=Util;
+	HCustodians[PID]=tmp;
 	return;
 }
 
@@ -345,14 +350,14 @@ void God::updateCustodian(int PID,int NID,double Util)
  */
 double God::getHighestUtil(int PID)
 {
-	vector<CHUtil*>::iterator it;
-	for (it = HCustodians.begin(); it != HCustodians.end(); ++it)
+	dense_hash_map<int,CHUtil>::iterator it;
+
+
+	it = HCustodians.find(PID);
+	if(it != HCustodians.end())
 	{
-		if((*it)->PID == PID)
-		{
-			//printf("Packet %d found and has max utility %f\n",(*it)->PID,(*it)->Util);
-			return ((*it)->Util);
-		}
+		//printf("Packet %d found and has max utility %f\n",PID,it->second.Util);
+		return (it->second.Util);
 	}
 	printf("We have a problem :)\n");
 	exit(1);
@@ -396,6 +401,7 @@ int *God::getFriends(int NID)
 
 void God::generatedPkt(int pktID, int srcID, int dstID, int genTime)
 {
+	ServiceGuard guard(&(this->Lock), this->Concurrent);
 	PacketStatistics tmpPktStats;
 
 
@@ -416,6 +422,7 @@ void God::generatedPkt(int pktID, int srcID, int dstID, int genTime)
 
 void God::forwardedPkt(int pktID)
 {
+	ServiceGuard guard(&(this->Lock), this->Concurrent);
 	list<PacketStatistics>::iterator it;
 
 
@@ -436,6 +443,7 @@ void God::forwardedPkt(int pktID)
 
 void God::deliveredPkt(int pktID, int numHops, double delTime)
 {
+	ServiceGuard guard(&(this->Lock), this->Concurrent);
 	list<PacketStatistics>::iterator it;
 
 
@@ -461,6 +469,7 @@ void God::deliveredPkt(int pktID, int numHops, double delTime)
 
 void God::updatePktStats(int pktID, int numHops, double delTime)
 {
+	ServiceGuard guard(&(this->Lock), this->Concurrent);
 	list<PacketStatistics>::iterator it;
 
 
@@ -482,6 +491,7 @@ void God::updatePktStats(int pktID, int numHops, double delTime)
 
 int God::getNumHops(int pktID)
 {
+	ServiceGuard guard(&(this->Lock), this->Concurrent);
 	list<PacketStatistics>::iterator it;
 
 
@@ -500,6 +510,7 @@ int God::getNumHops(int pktID)
 
 double God::getDelTime(int pktID)
 {
+	ServiceGuard guard(&(this->Lock), this->Concurrent);
 	list<PacketStatistics>::iterator it;
 
 
@@ -520,6 +531,7 @@ void God::writePktStats(string fileName)
 {
 	list<PacketStatistics>::iterator it;
 	FILE *pktStatsFile;
+	int dups;
 
 
 	this->pktStats.sort();
@@ -530,7 +542,7 @@ void God::writePktStats(string fileName)
 		exit(EXIT_FAILURE);
 	}
 
-	fprintf(pktStatsFile, "#1.Packet ID\t2.Source ID\t3.Destination ID\t4.Generation Time\t5.Number of Forwards\t6.Number of Hops\t7.Delivery Delay (seconds)\n");
+	fprintf(pktStatsFile, "#1.Packet ID\t2.Source ID\t3.Destination ID\t4.Generation Time\t5.Number of Forwards\t6.Number of Hops\t7.Delivery Delay (seconds)\t8.Number of Duplicates\n");
 
 	for(it = this->pktStats.begin(); it != this->pktStats.end(); ++it)
 	{
@@ -538,15 +550,20 @@ void God::writePktStats(string fileName)
 		{
 			/* Optimal Routing would avoid any redundant transmission */
 			(*it).numForwards = (*it).numHops;
+			dups = 0;
+		}
+		else
+		{
+			dups = (*SimulationNodes)[(*it).dstID]->Stat->getPktDuplicates((*it).pktID);
 		}
 
 		if((*it).reachedDst)
 		{
-			fprintf(pktStatsFile, "%d\t%d\t%d\t%f\t%d\t%d\t%f\n", (*it).pktID, (*it).srcID, (*it).dstID, (*it).genTime, (*it).numForwards, (*it).numHops, (*it).delTime);
+			fprintf(pktStatsFile, "%d\t%d\t%d\t%f\t%d\t%d\t%f\t%d\n", (*it).pktID, (*it).srcID, (*it).dstID, (*it).genTime, (*it).numForwards, (*it).numHops, (*it).delTime, dups);
 		}
 		else
 		{
-			fprintf(pktStatsFile, "%d\t%d\t%d\t%f\t%d\tinf\tinf\n", (*it).pktID, (*it).srcID, (*it).dstID, (*it).genTime, (*it).numForwards);
+			fprintf(pktStatsFile, "%d\t%d\t%d\t%f\t%d\tinf\tinf\t0\n", (*it).pktID, (*it).srcID, (*it).dstID, (*it).genTime, (*it).numForwards);
 		}
 	}
 
@@ -567,6 +584,9 @@ void God::writePktStats(string fileName)
  */
 void God::writeString(string outputData)
 {
+	ServiceGuard guard(&(this->Lock), this->Concurrent);
+
+
 	if(this->outFile != NULL)
 	{
 		fprintf(this->outFile, "%s", outputData.c_str());
@@ -578,15 +598,32 @@ void God::writeString(string outputData)
 
 /* deleteAllReplicas
  * -----------------
- * 
+ * Removes the packet with pktID from the buffers of all nodes that hold a replica.
  */
 void God::deleteAllReplicas(int pktID)
 {
+	unsigned int i;
 	int tmpNode;
+	vector<int> nodes;
+	dense_hash_map<int,vector<int> >::iterator it;
 
 
-	for(tmpNode = 0; tmpNode < SimNodes; tmpNode++)
+	it = Holders.find(pktID);
+	if(it == Holders.end())
+	{
+		return;
+	}
+
+	/* Removing the replicas updates the index, so work on a copy */
+	nodes = it->second;
+	tmpNode = -1;
+	for(i = 0; i < nodes.size(); i++)
 	{
+		if(nodes[i] == tmpNode)
+		{
+			continue;
+		}
+		tmpNode = nodes[i];
 		if((*SimulationNodes)[tmpNode]->Buffer->PacketExists(pktID))
 		{
 			(*SimulationNodes)[tmpNode]->Buffer->removePkt(pktID);
@@ -597,28 +634,83 @@ void God::deleteAllReplicas(int pktID)
 }
 
 
+/* replicaAdded
+ * ------------
+ * Informs God that node nodeID stored a replica of the packet with pktID (either as a
+ * native packet or as part of an encoded packet).
+ */
+void God::replicaAdded(int pktID, int nodeID)
+{
+	ServiceGuard guard(&(this->Lock), this->Concurrent);
+	vector<int> *nodes;
+
+
+	nodes = &(Holders[pktID]);
+	nodes->insert(lower_bound(nodes->begin(), nodes->end(), nodeID), nodeID);
+	this->NumReplicas++;
 
-/* optimizeDelay
- * -------------
- * 
+	return;
+}
+
+
+/* replicaRemoved
+ * --------------
+ * Informs God that node nodeID discarded a replica of the packet with pktID.
  */
-bool God::optimizeDelay()
+void God::replicaRemoved(int pktID, int nodeID)
 {
-	if(Set->ProfileExists())
+	ServiceGuard guard(&(this->Lock), this->Concurrent);
+	dense_hash_map<int,vector<int> >::iterator it;
+	vector<int>::iterator pos;
+
+
+	it = Holders.find(pktID);
+	if(it == Holders.end() || (pos = lower_bound(it->second.begin(), it->second.end(), nodeID)) == it->second.end() || (*pos) != nodeID)
 	{
-		if((Set->GetProfileAttribute("Optimal") == "none") || (Set->GetProfileAttribute("Optimal") == "Delay"))
-		{
-			return true;
-		}
-		else
-		{
-			return false;
-		}
+		printf("\n[Error]: (God::replicaRemoved) Node %d does not hold a replica of the packet with ID %d\n\n", nodeID, pktID);
+		exit(EXIT_FAILURE);
 	}
-	else
+
+	it->second.erase(pos);
+	if(it->second.empty())
 	{
-		return true;
+		Holders.erase(it);
+	}
+	this->NumReplicas--;
+
+	return;
+}
+
+
+/* getNumReplicas
+ * --------------
+ * Returns the number of replicas of the packet with pktID that are currently stored in
+ * the buffers of the network nodes.
+ */
+int God::getNumReplicas(int pktID)
+{
+	ServiceGuard guard(&(this->Lock), this->Concurrent);
+	dense_hash_map<int,vector<int> >::iterator it;
+
+
+	it = Holders.find(pktID);
+	if(it == Holders.end())
+	{
+		return 0;
 	}
+
+	return (int) it->second.size();
+}
+
+
+
+/* optimizeDelay
+ * -------------
+ * 
+ */
+bool God::optimizeDelay()
+{
+	return (Set->getOptimalObjective() == OPTIMIZE_DELAY);
 }
 
 
@@ -628,19 +720,56 @@ bool God::optimizeDelay()
  */
 bool God::optimizeForwards()
 {
-	if(Set->ProfileExists())
+	return (Set->getOptimalObjective() == OPTIMIZE_FORWARDS);
+}
+
+
+/* Checkpoint
+ * ----------
+ * Saves or restores the global knowledge about the delivered packets and the
+ * per packet statistics.
+ */
+void God::Checkpoint(Snapshot *snap)
+{
+	int num;
+	PacketStatistics ps = PacketStatistics();
+	list<PacketStatistics>::iterator it;
+
+
+	snap->Section("GOD ");
+	snap->Value(this->CurTime);
+	snap->Values(this->DeliveredPkts);
+	snap->Value(this->EncodingsTypeA);
+	snap->Value(this->EncodingsTypeB);
+	snap->Value(this->EncodedTransmissions);
+	if(!this->HCustodians.empty())
+	{
+		snap->Unsupported("custodian utilities");
+	}
+
+	num = (int) this->pktStats.size();
+	snap->Value(num);
+	it = this->pktStats.begin();
+	while(num-- > 0)
 	{
-		if(Set->GetProfileAttribute("Optimal") == "Forwards")
+		if(snap->isSaving())
 		{
-			return true;
+			ps = (*it);
+			++it;
 		}
-		else
+		snap->Value(ps.pktID);
+		snap->Value(ps.srcID);
+		snap->Value(ps.dstID);
+		snap->Value(ps.genTime);
+		snap->Value(ps.numForwards);
+		snap->Value(ps.numHops);
+		snap->Value(ps.delTime);
+		snap->Value(ps.reachedDst);
+		if(snap->isRestoring())
 		{
-			return false;
+			this->pktStats.push_back(ps);
 		}
 	}
-	else
-	{
-		return false;
-	}
+
+	return;
 }
@@ -27,6 +27,8 @@
 #include <set>
 #include <vector>
 #include <list>
+#include <algorithm>
+#include <google-sparsehash/google/dense_hash_map>
 
 #ifndef CONNECTIONMAP_H
 	#define CONNECTIONMAP_H
@@ -38,9 +40,15 @@
 	#include "Settings.h"
 #endif
 
+#ifndef SERVICEGUARD_H
+	#define SERVICEGUARD_H
+	#include "ServiceGuard.h"
+#endif
+
 
 class Node;
 using namespace std;
+using google::dense_hash_map;
 
 struct CustodianHighestUtil
 {
@@ -88,7 +96,11 @@ private:
 
 	ConnectionMap *ActiveConnections;
 	vector<Node*> *SimulationNodes;
-	vector<CHUtil*> HCustodians;
+	dense_hash_map<int,CHUtil> HCustodians;
+
+	//Original packet ID -> nodes that hold a replica of the packet (in ascending order)
+	dense_hash_map<int,vector<int> > Holders;
+	long int NumReplicas;
 
 	int **NodeFriends;
 
@@ -100,12 +112,16 @@ private:
 
 	string outputFilename;
 	FILE *outFile;
+
+	mutex Lock;
+	bool Concurrent;
 public:
 	God(Settings *S);
 	~God();
 	void setActiveConnections(ConnectionMap *Map);
 	void setSimulationNodes(vector<Node*> *N);
 	void setSimTime(double SimTime);
+	void setConcurrent(bool val){this->Concurrent=val;};
 	double getSimTime(void);
 	void InitDelivered(int NumberOfPackets);
 	void AddDelivered(int pktID);
@@ -118,9 +134,9 @@ public:
 	double getProjNetGrowth(int nodeID, double interval);
 	double getMeanRTTL(int nodeID, double interval);
 
-	void increaseEncodingsA(void){EncodingsTypeA++;};
-	void increaseEncodingsB(void){EncodingsTypeB++;};
-	void increaseCodedTransmissions(void){EncodedTransmissions++;};
+	void increaseEncodingsA(void){ServiceGuard guard(&(this->Lock), this->Concurrent); EncodingsTypeA++;};
+	void increaseEncodingsB(void){ServiceGuard guard(&(this->Lock), this->Concurrent); EncodingsTypeB++;};
+	void increaseCodedTransmissions(void){ServiceGuard guard(&(this->Lock), this->Concurrent); EncodedTransmissions++;};
 	void printCodingInfo(void);
 
 	//Custodian methods
@@ -141,7 +157,13 @@ public:
 	void writeString(string outputData);
 
 	void deleteAllReplicas(int pktID);
+	void replicaAdded(int pktID, int nodeID);
+	void replicaRemoved(int pktID, int nodeID);
+	int getNumReplicas(int pktID);
+	long int getNumReplicas(void){return this->NumReplicas;};
 	bool optimizeDelay();
 	bool optimizeForwards();
+
+	void Checkpoint(Snapshot *snap);
 };
 
@@ -27,15 +27,51 @@
 	#include "Header.h"
 #endif
 
-Header::Header(void)
+/* Replicate
+ * ---------
+ * Turns this header into the header of a duplicate of the packet with header "old". The
+ * header is copied as a whole and then the fields that the duplicate must not inherit are
+ * reset (the caller sets the original packet and the number of hops).
+ */
+void Header::Replicate(Header *old)
 {
+	*this=*old;
+	this->nextHop=-1;
+	this->OriginalPacket=0;
+	this->Replication=1;
+	this->GSC=false;
+	this->UtilWon=0.0;
+	this->DIUtilWon=0.0;
+	this->Uwon=NULL;
 	return;
 }
 
-Header::~Header(void)
+
+/* Checkpoint
+ * ----------
+ * Saves or restores the fields of the header.
+ */
+void Header::Checkpoint(Snapshot *snap)
 {
-// 	printf("Destructor of Header is being called!\n");
-	free(Uwon);
+	if(this->Uwon != NULL)
+	{
+		snap->Unsupported("headers that carry SimBetTS utilities");
+	}
+
+	snap->Value(this->Type);
+	snap->Value(this->Source);
+	snap->Value(this->Destination);
+	snap->Value(this->prevHop);
+	snap->Value(this->nextHop);
+	snap->Value(this->Hops);
+	snap->Value(this->HeaderSize);
+	snap->Value(this->OriginalPacket);
+	snap->Value(this->Replication);
+	snap->Value(this->GSC);
+	snap->Value(this->DirectDelivery);
+	snap->Value(this->UtilWon);
+	snap->Value(this->DIUtilWon);
+
 	return;
 }
 
@@ -59,16 +95,11 @@ SimpleHeader::SimpleHeader(int Source, int Destination, int pHop):Header()
 	this->GSC=false;
 	this->DirectDelivery=false;
 	this->UtilWon=0.0;
+	this->DIUtilWon=0.0;
 	this->Uwon=NULL;
 	return;
 }
 
-SimpleHeader::~SimpleHeader(void)
-{
-// 	printf("Destructor of SimpleHeader is being called!\n");
-	return;
-}
-
 
 /* Constructor:BasicHeader
  * -----------------------
@@ -90,48 +121,8 @@ BasicHeader::BasicHeader(int Source, int Destination):Header()
 	this->GSC=false;
 	this->DirectDelivery=false;
 	this->UtilWon=0.0;
+	this->DIUtilWon=0.0;
 	this->Uwon=NULL;
 	return;
 }
 
-BasicHeader::~BasicHeader(void)
-{
-// 	printf("Destructor of BasicHeader is being called!\n");
-	return;
-}
-
-
-/* SetOriginal
- * -----------
- * Sets the ID of the original packet. For each transmission a new packet duplicate is
- * constructed (both for single-copy and multi-copy routing protocols). All packets 
- * are linked to the original packet that holds all the information about the packet.
- */
-void SimpleHeader::SetOriginal(int ID)
-{
-	this->OriginalPacket=ID;
-	return;
-}
-
-/* GetOriginal
- * -----------
- * Gets the ID of the original packet.
- */
-int SimpleHeader::GetOriginal(void )
-{
-	return this->OriginalPacket;
-}
-
-/* IsDuplicate
- * -----------
- * Returns if the data packet that has the current header is a duplicate or the original
- * packet. 
- */
-bool SimpleHeader::IsDuplicate(void )
-{
-	if(this->OriginalPacket == 0)
-	{
-		return false;
-	}
-	return true;
-}
@@ -24,17 +24,29 @@
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <type_traits>
 
 #ifndef PACKET_ENTRY_H
 	#define PACKET_ENTRY_H
 	#include "PacketEntry.h"
 #endif
 
+#ifndef SNAPSHOT_H
+	#define SNAPSHOT_H
+	#include "Snapshot.h"
+#endif
+
+
+/* A packet whose header has not been set yet */
+#define NO_HEADER 0
+
 
 /* Header
  * ------
- * 
- * 
+ * The header of a packet. It is a flat structure that is embedded in every packet, so its
+ * fields are accessed through inline methods and a packet duplicate copies it as a single
+ * block of memory. The SimBetTS utilities are kept in an optional extension slot, which
+ * is owned by the packet and is not inherited by duplicates.
  */
 class Header
 {
@@ -55,50 +67,57 @@ protected:
 	struct SimBetTSmetrics *Uwon;
 	
 public:
-	Header(void);
-	virtual ~Header(void);
-	virtual void SetOriginal(int ID){return;};
-	virtual int GetOriginal(void){return 0;};
-	virtual bool IsDuplicate(void){return false;};
-	virtual int GetprevHop(void){return this->prevHop;};
-	virtual void SetprevHop(int ID){this->prevHop=ID;};
-	virtual int GetHops(void){return this->Hops;};
-	virtual void SetHops(int H){this->Hops=H;};
-	virtual int GetDestination(void){return this->Destination;};
-	virtual int GetHeaderSize(void){return this->HeaderSize;};
-	virtual void SetHeaderSize(int length){this->HeaderSize=length;};
-	virtual int GetSource(void){return this->Source;};
-	virtual int GetType(void){return this->Type;};
-	virtual int GetNextHop(void){return this->nextHop;};
-	virtual void SetNextHop(int next){this->nextHop=next;};
-	virtual int GetRep(void){return Replication;};
-	virtual void SetRep(int R){Replication=R;};
-	virtual void SetGSCon(void){this->GSC=true;};
-	virtual bool GetGSC(void){return this->GSC;};
-	virtual void SetDeliveryStatus(bool state){this->DirectDelivery=state;};
-	virtual bool GetDeliveryStatus(void){return this->DirectDelivery;};
-	virtual double getUtilWon(void){return this->UtilWon;};
-	virtual void setUtilWon(double u){this->UtilWon=u;};
-	virtual double getDIUtilWon(void){return this->DIUtilWon;};
-	virtual void setDIUtilWon(double u){this->DIUtilWon=u;};
-	virtual struct SimBetTSmetrics *getUtilsWon(void){return this->Uwon;};
-	virtual void setUtilsWon(struct SimBetTSmetrics *U){this->Uwon=U;};
+	Header(void){this->Type=NO_HEADER;this->Uwon=NULL;};
+	void SetOriginal(int ID){this->OriginalPacket=ID;};
+	int GetOriginal(void){return this->OriginalPacket;};
+	bool IsDuplicate(void){return (this->OriginalPacket != 0);};
+	int GetprevHop(void){return this->prevHop;};
+	void SetprevHop(int ID){this->prevHop=ID;};
+	int GetHops(void){return this->Hops;};
+	void SetHops(int H){this->Hops=H;};
+	int GetDestination(void){return this->Destination;};
+	int GetHeaderSize(void){return this->HeaderSize;};
+	void SetHeaderSize(int length){this->HeaderSize=length;};
+	int GetSource(void){return this->Source;};
+	int GetType(void){return this->Type;};
+	int GetNextHop(void){return this->nextHop;};
+	void SetNextHop(int next){this->nextHop=next;};
+	int GetRep(void){return Replication;};
+	void SetRep(int R){Replication=R;};
+	void SetGSCon(void){this->GSC=true;};
+	bool GetGSC(void){return this->GSC;};
+	void SetDeliveryStatus(bool state){this->DirectDelivery=state;};
+	bool GetDeliveryStatus(void){return this->DirectDelivery;};
+	double getUtilWon(void){return this->UtilWon;};
+	void setUtilWon(double u){this->UtilWon=u;};
+	double getDIUtilWon(void){return this->DIUtilWon;};
+	void setDIUtilWon(double u){this->DIUtilWon=u;};
+	struct SimBetTSmetrics *getUtilsWon(void){return this->Uwon;};
+	void setUtilsWon(struct SimBetTSmetrics *U){this->Uwon=U;};
+	void Replicate(Header *old);
+	void Checkpoint(Snapshot *snap);
 };
 
+static_assert(std::is_trivially_copyable<Header>::value, "Packet headers must be copied as plain memory");
+
+
+/* SimpleHeader
+ * ------------
+ * Header of data packets (either original packets or replicas).
+ */
 class SimpleHeader:public Header
 {
 public:
 	SimpleHeader(int Source,int Destination,int pHop);
-	~SimpleHeader(void);
-	virtual void SetOriginal(int ID);
-	virtual int GetOriginal(void);
-	virtual bool IsDuplicate(void);
 };
 
 
+/* BasicHeader
+ * -----------
+ * Header of the control packets that are exchanged during a contact.
+ */
 class BasicHeader:public Header
 {
 public:
 	BasicHeader(int Source,int Destination);
-	~BasicHeader(void);
 };
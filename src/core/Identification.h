@@ -126,3 +126,7 @@
 #define SAMPLE_TT 3
 #define PREDEFINED_TT 4
 #define LAST_ENTRY_TT 5 //this should always be the last one
+
+//Objectives of Optimal Routing
+#define OPTIMIZE_DELAY 1
+#define OPTIMIZE_FORWARDS 2
@@ -27,6 +27,66 @@
 	#include "MAC.h"
 #endif
 
+//The events created by a thread that simulates a group of nodes in parallel with other groups
+//are kept in the list of that thread (NULL: the event list of the simulation)
+static thread_local EventList *CascadeList=NULL;
+
+
+/* setCascadeList
+ * --------------
+ * Sets the list that keeps the events created by the calling thread.
+ */
+void MAC::setCascadeList(EventList *EL)
+{
+	CascadeList=EL;
+	return;
+}
+
+/* TargetList
+ * ----------
+ * Returns the list where the events of the calling thread are inserted.
+ */
+EventList *MAC::TargetList(void)
+{
+	if(CascadeList != NULL)
+	{
+		return CascadeList;
+	}
+	return this->EvList;
+}
+
+/* QueueDelivery
+ * -------------
+ * Keeps a transmission of the current time instant in the delivery queue.
+ */
+void MAC::QueueDelivery(int Sender,int Rec,int pktID)
+{
+	struct Delivery d;
+
+	d.Sender=Sender;
+	d.Receiver=Rec;
+	d.pktID=pktID;
+	this->Deliveries.push_back(d);
+	return;
+}
+
+/* NextDelivery
+ * ------------
+ * Returns the next transmission of the delivery queue (false if it is empty).
+ * The event list places a new event before the events with the same time, so
+ * the transmission queued last is delivered first to keep the same order.
+ */
+bool MAC::NextDelivery(struct Delivery *d)
+{
+	if(this->Deliveries.empty())
+	{
+		return false;
+	}
+	*d=this->Deliveries.back();
+	this->Deliveries.pop_back();
+	return true;
+}
+
 /* Constructor: Ideal
  * ------------------
  * This class implements a simple ideal MAC layer without bandwidth
@@ -47,19 +107,30 @@ Ideal::~Ideal()
 /* BroadcastPkt
  * ------------
  * This method broadcasts a packet with "pktID" and size "pktSize" to all 
- * one hop neighbors of Node "Sender" at time "Time"
+ * one hop neighbors of Node "Sender" at time "Time". A single Broadcast event
+ * is created for all the neighbors.
  */
 int Ideal::BroadcastPkt(double Time,int Sender,int pktSize,int pktID)
 {
 	int NumberNodes=this->Connections->NumberOfN(Sender);
 	int *NList=this->Connections->GetN(Sender);
 	Event *tmp=NULL;
-	for(int i=0;i<NumberNodes;i++)
+	if(this->Queueing && Time == EvList->getMinTime())
+	{//delivered at the current time instant
+		for(int i=0;i<NumberNodes;i++)
+		{
+			QueueDelivery(Sender,NList[i],pktID);
+		}
+		free(NList);
+		return NumberNodes;
+	}
+	if(NumberNodes == 0)
 	{
-		tmp=new Transmission(Time,Sender,NList[i],pktID);
-		EvList->InsertEvent(tmp);
+		free(NList);
+		return NumberNodes;
 	}
-	free(NList);
+	tmp=new Broadcast(Time,Sender,NList,NumberNodes,pktID);
+	TargetList()->InsertEvent(tmp);
 	return NumberNodes;
 }
 
@@ -70,8 +141,13 @@ int Ideal::BroadcastPkt(double Time,int Sender,int pktSize,int pktID)
  */
 void Ideal::SendPkt(double Time, int Sender, int Rec, int pktSize, int pktID)
 {
+	if(this->Queueing && Time == EvList->getMinTime())
+	{//delivered at the current time instant
+		QueueDelivery(Sender,Rec,pktID);
+		return;
+	}
 	Event *tmp=new Transmission(Time,Sender,Rec,pktID);
-	EvList->InsertEvent(tmp);
+	TargetList()->InsertEvent(tmp);
 	return;
 }
 
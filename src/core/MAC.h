@@ -43,21 +43,40 @@
 
 using namespace std;
 
+/* Delivery
+ * --------
+ * A transmission of the current time instant that is kept out of the event list.
+ */
+struct Delivery
+{
+	int Sender;
+	int Receiver;
+	int pktID;
+};
+
 /* Interface: MAC 
  * --------------
  */
 class MAC
 {
+protected:
+	bool Queueing;
+	vector<struct Delivery> Deliveries;
+	void QueueDelivery(int Sender,int Rec,int pktID);
 public:
 	double Bandwidth; // in Mbps
 	EventList *EvList;
-	MAC(){return;};
+	MAC(){this->Queueing=false;};
 	virtual ~MAC(){return;};
 	virtual int BroadcastPkt(double Time,int Sender,int pktSize,int pktID)=0;
 	virtual void SetBandwidth(double Mbps)=0;
 	virtual void SendPkt(double Time,int Sender,int Rec,int pktSize,int pktID)=0;
 	virtual double LastEvent(Event *e)=0;
 	virtual int GetParallelConnections(int Sender)=0;
+	static void setCascadeList(EventList *EL);
+	EventList *TargetList(void);
+	void setDeliveryQueue(bool status){this->Queueing=status;};
+	bool NextDelivery(struct Delivery *d);
 };
 
 /* Ideal
@@ -73,6 +73,10 @@ Node::Node(int NodeID, PacketPool *pktPool, MAC *mlayer, Statistics *St, Setting
 
 	this->Buffer = new PacketBuffer(this->ID, this->Stat, this->Gd, BufferSize, this->SimSet->getDroppingPolicy(), this->SimSet->getTTL());
 
+	#ifdef SPECIALIZED_BUILD
+	/* The routing protocol has been fixed at compile time (see Specialization.h) */
+	this->RLogic = new ROUTING_TYPE(this->Pool, this->macLayer, this->Buffer, this->ID, this->Stat, this->SimSet, this->Gd);
+	#else
 	switch(SimSet->getRT())
 	{
 		case DIRECT_RT:
@@ -163,6 +167,7 @@ Node::Node(int NodeID, PacketPool *pktPool, MAC *mlayer, Statistics *St, Setting
 			exit(EXIT_FAILURE);
 		}
 	}
+	#endif
 
 	return;
 }
@@ -212,9 +217,10 @@ void Node::ConUpdate(double CTime, int NodeID, bool status, bool history)
  * -----------
  * This method is called when a new packet is received from the application
  * layer. The packet has not been created yet. At this point, a new packet
- * must be created with the proper attributes.
+ * must be created with the proper attributes. The packet gets the identifier
+ * "pktID" if one has been reserved for it (otherwise NOTSET).
  */
-void Node::recvFromApp(double CurTime, int Dest)
+void Node::recvFromApp(double CurTime, int Dest, int pktID)
 {
 	Packet *tmp;
 	Header *h;
@@ -222,11 +228,18 @@ void Node::recvFromApp(double CurTime, int Dest)
 
 	/* Create a new data packet and initialize its header properly */
 	tmp = new DataPacket(CurTime, 0);
-	h = new SimpleHeader(this->ID, Dest, this->ID);
+	tmp->setHeader(SimpleHeader(this->ID, Dest, this->ID));
+	h = tmp->getHeader();
 	h->SetHops(0);
 	h->SetRep(SimSet->getReplicas());
-	tmp->setHeader(h);
-	Pool->AddOriginalPacket(tmp);
+	if(pktID == NOTSET)
+	{
+		Pool->AddOriginalPacket(tmp);
+	}
+	else
+	{
+		Pool->AddReservedPacket(tmp, pktID);
+	}
 
 
 	/* Send the new data packet to the network layer */
@@ -268,3 +281,18 @@ void Node::PrintBuffer(void)
 	Buffer->PrintPkts();
 	printf("-----------------------------\n");
 }
+
+
+/* Checkpoint
+ * ----------
+ * Saves or restores the state of the node (buffer contents and routing state).
+ */
+void Node::Checkpoint(Snapshot *snap)
+{
+	snap->Section("NODE");
+	snap->Match(this->ID, "node ID");
+	this->Buffer->Checkpoint(snap);
+	this->RLogic->Checkpoint(snap);
+
+	return;
+}
@@ -55,6 +55,11 @@
 	#include "../routing/RoutingProtocols.h"
 #endif
 
+#ifndef SPECIALIZATION_H
+	#define SPECIALIZATION_H
+	#include "Specialization.h"
+#endif
+
 
 
 /* Node
@@ -68,7 +73,7 @@ public:
 	PacketPool *Pool;
 	PacketBuffer *Buffer;
 	MAC *macLayer;
-	Routing *RLogic;
+	ROUTING_TYPE *RLogic;
 	Statistics *Stat;
 	Settings *SimSet;
 	God *Gd;
@@ -77,9 +82,10 @@ public:
 	virtual ~Node();
 
 	virtual void ConUpdate(double CTime, int NodeID, bool status, bool history);
-	virtual void recvFromApp(double CurTime, int Dest);
+	virtual void recvFromApp(double CurTime, int Dest, int pktID);
 	virtual void recv(int pktID, double CurTime);
 	virtual void PrintBuffer(void);
 	virtual void Finalize(void){this->RLogic->Finalize();};
 	virtual PacketBuffer *getPacketBuffer(void){return this->Buffer;};
+	virtual void Checkpoint(Snapshot *snap);
 };
@@ -0,0 +1,135 @@
+/*
+ *  Adyton: A Network Simulator for Opportunistic Networks
+ *  Copyright (C) 2015  Nikolaos Papanikos, Dimitrios-Georgios Akestoridis,
+ *  and Evangelos Papapetrou
+ *
+ *  This file is part of Adyton.
+ *
+ *  Adyton is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Adyton is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Adyton.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef NODE_LIST_H
+	#define NODE_LIST_H
+	#include "NodeList.h"
+#endif
+
+
+NodeList::NodeList()
+{
+	this->Size = 0;
+	this->Capacity = NODE_LIST_INLINE;
+	return;
+}
+
+NodeList::~NodeList()
+{
+	if(this->Capacity > NODE_LIST_INLINE)
+	{
+		free(this->Storage.Heap);
+	}
+	return;
+}
+
+/* reserve
+ * -------
+ * Makes room for at least n IDs. The capacity doubles each time the list has to grow.
+ */
+void NodeList::reserve(int n)
+{
+	int newCapacity;
+	int *newHeap;
+
+
+	if(n <= this->Capacity)
+	{
+		return;
+	}
+
+	newCapacity = this->Capacity;
+	while(newCapacity < n)
+	{
+		newCapacity *= 2;
+	}
+
+	newHeap = (int *) malloc(newCapacity * sizeof(int));
+	memcpy(newHeap, data(), this->Size * sizeof(int));
+	if(this->Capacity > NODE_LIST_INLINE)
+	{
+		free(this->Storage.Heap);
+	}
+	this->Storage.Heap = newHeap;
+	this->Capacity = newCapacity;
+
+	return;
+}
+
+bool NodeList::contains(int ID)
+{
+	int i;
+	int *IDs;
+
+
+	IDs = data();
+	for(i = 0; i < this->Size; i++)
+	{
+		if(IDs[i] == ID)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void NodeList::push_back(int ID)
+{
+	reserve(this->Size + 1);
+	data()[this->Size] = ID;
+	this->Size++;
+
+	return;
+}
+
+/* resize
+ * ------
+ * Sets the number of IDs in the list. New positions are not initialized.
+ */
+void NodeList::resize(int n)
+{
+	reserve(n);
+	this->Size = n;
+
+	return;
+}
+
+/* Checkpoint
+ * ----------
+ * Saves or restores the IDs of the list (in the same format as Snapshot::Values()).
+ */
+void NodeList::Checkpoint(Snapshot *snap)
+{
+	int n;
+
+
+	n = this->Size;
+	snap->Value(n);
+	resize(n);
+	if(n > 0)
+	{
+		snap->Array(data(), n);
+	}
+
+	return;
+}
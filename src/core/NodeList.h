@@ -0,0 +1,70 @@
+/*
+ *  Adyton: A Network Simulator for Opportunistic Networks
+ *  Copyright (C) 2015  Nikolaos Papanikos, Dimitrios-Georgios Akestoridis,
+ *  and Evangelos Papapetrou
+ *
+ *  This file is part of Adyton.
+ *
+ *  Adyton is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Adyton is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Adyton.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#ifndef SNAPSHOT_H
+	#define SNAPSHOT_H
+	#include "Snapshot.h"
+#endif
+
+using namespace std;
+
+#define NODE_LIST_INLINE 4
+
+
+/* NodeList
+ * --------
+ * A list of node IDs that stores up to NODE_LIST_INLINE IDs inside the object itself and
+ * moves them to the heap only when it grows further. Lists of forwarders or previous hops
+ * rarely exceed a few nodes, so most packet entries never allocate memory for them. The
+ * object takes as much space as an empty vector<int>.
+ */
+class NodeList
+{
+private:
+	int Size;
+	int Capacity;
+	union
+	{
+		int Inline[NODE_LIST_INLINE];
+		int *Heap;
+	} Storage;
+
+	void reserve(int n);
+	NodeList(const NodeList &other);
+	NodeList &operator=(const NodeList &other);
+
+public:
+	NodeList();
+	~NodeList();
+	int size(void){return this->Size;};
+	int *data(void){return (this->Capacity > NODE_LIST_INLINE)?(this->Storage.Heap):(this->Storage.Inline);};
+	int operator[](int pos){return data()[pos];};
+	bool contains(int ID);
+	void push_back(int ID);
+	void clear(void){this->Size = 0;};
+	void resize(int n);
+	void Checkpoint(Snapshot *snap);
+};
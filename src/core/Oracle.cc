@@ -0,0 +1,263 @@
+/*
+ *  Adyton: A Network Simulator for Opportunistic Networks
+ *  Copyright (C) 2015  Nikolaos Papanikos, Dimitrios-Georgios Akestoridis,
+ *  and Evangelos Papapetrou
+ *
+ *  This file is part of Adyton.
+ *
+ *  Adyton is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Adyton is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Adyton.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef ORACLE_H
+	#define ORACLE_H
+	#include "Oracle.h"
+#endif
+
+//#define ORACLE_DEBUG
+
+
+Oracle::Oracle(int nodes, bool forwards, int threads)
+{
+	this->NN = nodes;
+	this->minHops = forwards;
+	this->Threads = threads;
+
+	return;
+}
+
+
+Oracle::~Oracle()
+{
+	Contacts.clear();
+	Packets.clear();
+
+	return;
+}
+
+
+/* ContactUp
+ * ---------
+ * Records that NodeA was informed about its contact with NodeB. Optimal Routing only
+ * transfers packets when a node is informed about a contact, so these are the only
+ * events that the journeys need.
+ */
+void Oracle::ContactUp(double CTime, int NodeA, int NodeB)
+{
+	OracleContact c;
+
+
+	c.Time = CTime;
+	c.Sender = NodeA;
+	c.Receiver = NodeB;
+	Contacts.push_back(c);
+
+	return;
+}
+
+
+/* AddPacket
+ * ---------
+ * Registers a packet that was generated by the application layer and returns its ID.
+ * The packet can only be carried by the contacts recorded after this point.
+ */
+int Oracle::AddPacket(double CTime, int src, int dst, bool sample)
+{
+	OraclePacket p;
+
+
+	p.ID = (int) Packets.size() + 1;
+	p.Source = src;
+	p.Dest = dst;
+	p.Time = CTime;
+	p.First = (long int) Contacts.size();
+	p.Sample = sample;
+	p.Delivered = false;
+	p.Hops = 0;
+	p.Delay = 0.0;
+	p.Arrival = -1;
+	Packets.push_back(p);
+
+	return p.ID;
+}
+
+
+/* Journey
+ * -------
+ * Scans the contacts that follow the generation of the packet. A node that carries the
+ * packet hands a replica with one more hop to the node it meets, or lowers the hops of
+ * the replica that node already carries. Deliveries are judged as in
+ * Statistics::updateStats() and the scan stops as soon as the flood would have deleted
+ * all replicas (or could no longer improve the delivery).
+ */
+void Oracle::Journey(OraclePacket *pkt, int *Hops, int *Touched)
+{
+	long int k;
+	long int numContacts;
+	int numTouched;
+	int h;
+	double delay;
+	OracleContact *c;
+
+
+	numContacts = (long int) Contacts.size();
+	numTouched = 0;
+	Hops[pkt->Source] = 0;
+	Touched[numTouched++] = pkt->Source;
+
+	for(k = pkt->First; k < numContacts; k++)
+	{
+		c = &Contacts[k];
+		delay = c->Time - pkt->Time;
+
+		if(pkt->Delivered && !minHops && (delay - pkt->Delay > DBL_EPSILON))
+		{/* Any later delivery deletes all replicas */
+			break;
+		}
+
+		if(Hops[c->Sender] < 0)
+		{
+			continue;
+		}
+
+		h = Hops[c->Sender] + 1;
+		if(c->Receiver == pkt->Dest)
+		{
+			if(!pkt->Delivered)
+			{
+				pkt->Delivered = true;
+				pkt->Hops = h;
+				pkt->Delay = delay;
+				pkt->Arrival = k;
+			}
+			else if(h < pkt->Hops)
+			{
+				pkt->Hops = h;
+				pkt->Delay = delay;
+			}
+
+			if(minHops && pkt->Hops == 1)
+			{/* No other journey can use fewer hops */
+				break;
+			}
+		}
+		else if(Hops[c->Receiver] < 0)
+		{
+			Hops[c->Receiver] = h;
+			Touched[numTouched++] = c->Receiver;
+		}
+		else if(h < Hops[c->Receiver])
+		{
+			Hops[c->Receiver] = h;
+		}
+	}
+
+	while(numTouched > 0)
+	{
+		Hops[Touched[--numTouched]] = -1;
+	}
+
+	#ifdef ORACLE_DEBUG
+		printf("Packet %d (%d -> %d): delivered %d, hops %d, delay %f\n", pkt->ID, pkt->Source, pkt->Dest, pkt->Delivered, pkt->Hops, pkt->Delay);
+	#endif
+
+	return;
+}
+
+
+/* Journeys
+ * --------
+ * Computes the journeys of every step-th packet starting from the packet at position first.
+ */
+void Oracle::Journeys(int first, int step)
+{
+	int i;
+	int *Hops;
+	int *Touched;
+
+
+	Hops = (int *) malloc(NN * sizeof(int));
+	Touched = (int *) malloc(NN * sizeof(int));
+	for(i = 0; i < NN; i++)
+	{
+		Hops[i] = -1;
+	}
+
+	for(i = first; i < (int) Packets.size(); i += step)
+	{
+		if(Packets[i].Sample)
+		{
+			Journey(&Packets[i], Hops, Touched);
+		}
+	}
+
+	free(Hops);
+	free(Touched);
+
+	return;
+}
+
+
+static bool ArrivalOrder(const OraclePacket *a, const OraclePacket *b)
+{
+	return a->Arrival < b->Arrival;
+}
+
+
+/* Compute
+ * -------
+ * Finds the journeys of all the packets and passes the deliveries to the statistics of
+ * the destinations in the order that the flood would have made them.
+ */
+void Oracle::Compute(vector<Statistics*> *Stats)
+{
+	int i;
+	vector<thread> workers;
+	vector<OraclePacket *> deliveries;
+
+
+	if(Threads > 1)
+	{
+		for(i = 0; i < Threads; i++)
+		{
+			workers.push_back(thread(&Oracle::Journeys, this, i, Threads));
+		}
+
+		for(i = 0; i < Threads; i++)
+		{
+			workers[i].join();
+		}
+	}
+	else
+	{
+		Journeys(0, 1);
+	}
+
+	for(i = 0; i < (int) Packets.size(); i++)
+	{
+		if(Packets[i].Delivered)
+		{
+			deliveries.push_back(&Packets[i]);
+		}
+	}
+
+	stable_sort(deliveries.begin(), deliveries.end(), ArrivalOrder);
+
+	for(i = 0; i < (int) deliveries.size(); i++)
+	{
+		(*Stats)[deliveries[i]->Dest]->pktJourney(deliveries[i]->ID, deliveries[i]->Hops, deliveries[i]->Delay);
+	}
+
+	return;
+}
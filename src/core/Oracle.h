@@ -0,0 +1,90 @@
+/*
+ *  Adyton: A Network Simulator for Opportunistic Networks
+ *  Copyright (C) 2015  Nikolaos Papanikos, Dimitrios-Georgios Akestoridis,
+ *  and Evangelos Papapetrou
+ *
+ *  This file is part of Adyton.
+ *
+ *  Adyton is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Adyton is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Adyton.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <float.h>
+#include <vector>
+#include <thread>
+#include <algorithm>
+
+#ifndef STATS_H
+	#define STATS_H
+	#include "Statistics.h"
+#endif
+
+using namespace std;
+
+
+struct OracleContact
+{
+	double Time;
+	int Sender;
+	int Receiver;
+};
+
+
+struct OraclePacket
+{
+	int ID;
+	int Source;
+	int Dest;
+	double Time;
+	long int First;		/* first contact that can carry the packet */
+	bool Sample;		/* false for background traffic */
+	bool Delivered;
+	int Hops;
+	double Delay;
+	long int Arrival;	/* contact of the first delivery */
+};
+
+
+/* Oracle
+ * ------
+ * Computes the statistics of Optimal Routing without flooding replicas through the
+ * simulator. The contacts are recorded in the order the simulator processes them and
+ * the journey of every packet is then found with a single scan over the contacts that
+ * follow its generation. Each node keeps the minimum number of hops of the replica it
+ * carries, so the scan finds the earliest-arrival journey with the minimum number of
+ * hops (Optimal.Delay) or the minimum-hop journey that arrives first (Optimal.Forwards),
+ * exactly as the flood would. Journeys are independent and can be computed in parallel.
+ */
+class Oracle
+{
+private:
+	int NN;
+	bool minHops;
+	int Threads;
+	vector<OracleContact> Contacts;
+	vector<OraclePacket> Packets;
+
+	void Journey(OraclePacket *pkt, int *Hops, int *Touched);
+	void Journeys(int first, int step);
+
+public:
+	Oracle(int nodes, bool forwards, int threads);
+	~Oracle();
+	void ContactUp(double CTime, int NodeA, int NodeB);
+	int AddPacket(double CTime, int src, int dst, bool sample);
+	void Compute(vector<Statistics*> *Stats);
+	long int getContacts(void){return (long int)Contacts.size();};
+};
@@ -75,31 +75,10 @@
  * ------------------------------------------
  */
 
-Header *CopyHeader(Header *old)
-{
-	Header *h=NULL;
-	switch(old->GetType())
-	{
-		case 1:
-			h=new SimpleHeader(old->GetSource(),old->GetDestination(),old->GetprevHop());
-			h->SetHeaderSize(old->GetHeaderSize());
-			h->SetRep(1);
-			h->SetDeliveryStatus(old->GetDeliveryStatus());
-			break;
-		case 2:
-			h=new BasicHeader(old->GetSource(),old->GetDestination());
-			h->SetHeaderSize(old->GetHeaderSize());
-			h->SetDeliveryStatus(old->GetDeliveryStatus());
-			break;
-	}
-	return h;
-}
-
 Packet::Packet(double Time,int PID)
 {
 	this->UniqueID=PID;
 	this->StartTime=Time;
-	this->HD=NULL;
 	this->extraInfo=NULL;
 	this->SubType=0;
 }
@@ -107,6 +86,7 @@ Packet::Packet(double Time,int PID)
 Packet::~Packet(void )
 {
 	//printf("Destructor of Packet is called!\n");
+	free(this->HD.getUtilsWon());
 	return;
 }
 
@@ -136,6 +116,17 @@ void Packet::PrintPkt(void )
 	return;
 }
 
+
+/* Checkpoint
+ * ----------
+ * Only data packets outlive the instant they are transmitted, so they are the only
+ * packets that a snapshot of the packet pool needs to hold.
+ */
+void Packet::Checkpoint(Snapshot *snap)
+{
+	snap->Unsupported("control packets");
+}
+
 DataPacket::DataPacket(double Time, int PID): Packet(Time, PID)
 {
 	this->Type=DATA_PACKET;
@@ -147,14 +138,13 @@ DataPacket::DataPacket(double Time, int PID): Packet(Time, PID)
 DataPacket::~DataPacket(void)
 {
 // 	printf("Data packet %d is being deleted!\n",this->UniqueID);
-	delete HD;
 	return;
 }
 
 
 bool DataPacket::AccessPkt(void)
 {
-	if(this->HD->IsDuplicate() == true)
+	if(this->HD.IsDuplicate() == true)
 	{
 		this->access--;
 		if(this->access == 0)
@@ -172,27 +162,40 @@ void DataPacket::SetRecipients(int N)
 	return;
 }
 
+void DataPacket::Checkpoint(Snapshot *snap)
+{
+	if(this->extraInfo != NULL)
+	{
+		snap->Unsupported("data packets that carry congestion control information");
+	}
+	snap->Value(this->Pktsize);
+	snap->Value(this->SubType);
+	snap->Value(this->access);
+	this->HD.Checkpoint(snap);
+	return;
+}
+
 Packet *DataPacket::Duplicate(int hops)
 {
-	if(this->HD == NULL)
+	if(!this->hasHeader())
 	{
 		printf("Cannot duplicate a packet without header!\n");
 		exit(1);
 	}
 	Packet *p=new DataPacket(this->StartTime,0);
-	Header *h=CopyHeader(this->HD);
+	Header *h=p->getHeader();
+	h->Replicate(&(this->HD));
 
 	//Check if original packet is a duplicate too
-	if(this->HD->IsDuplicate() == true)
+	if(this->HD.IsDuplicate() == true)
 	{
-		h->SetOriginal(this->HD->GetOriginal());
+		h->SetOriginal(this->HD.GetOriginal());
 	}
 	else
 	{
 		h->SetOriginal(this->getID());
 	}
 	h->SetHops(hops+1);
-	p->setHeader(h);
 	return p;
 }
 
@@ -210,7 +213,6 @@ Encoded::Encoded(double Time, int PID): Packet(Time, PID)
 
 Encoded::~Encoded(void )
 {
-	delete HD;
 	free(this->PIDs);
 	free(this->RepVals);
 	return;
@@ -219,7 +221,7 @@ Encoded::~Encoded(void )
 
 bool Encoded::AccessPkt(void)
 {
-	if(this->HD->IsDuplicate() == true)
+	if(this->HD.IsDuplicate() == true)
 	{
 		this->access--;
 		if(this->access == 0)
@@ -266,7 +268,6 @@ SummaryPacket::SummaryPacket(double Time, int PID): Packet(Time, PID)
 
 SummaryPacket::~SummaryPacket(void )
 {
-	delete HD;
 	free(this->IDs);
 	return;
 }
@@ -296,7 +297,6 @@ EnhancedSummaryPacket::EnhancedSummaryPacket(double Time, int PID): Packet(Time,
 
 EnhancedSummaryPacket::~EnhancedSummaryPacket()
 {
-	delete HD;
 	free(pktData);
 
 	return;
@@ -328,7 +328,6 @@ ActivationPacket::ActivationPacket(double Time, int PID): Packet(Time, PID)
 
 ActivationPacket::~ActivationPacket(void )
 {
-	delete HD;
 	free(this->IDs);
 	free(this->RVs);
 	return;
@@ -356,7 +355,6 @@ DirectSummaryPacket::DirectSummaryPacket(double Time, int PID): Packet(Time, PID
 
 DirectSummaryPacket::~DirectSummaryPacket(void )
 {
-	delete HD;
 	free(this->IDs);
 	return;
 }
@@ -384,7 +382,6 @@ SocialSummary::SocialSummary(double Time, int PID): Packet(Time, PID)
 
 SocialSummary::~SocialSummary(void )
 {
-	delete HD;
 	free(this->IDs);
 	return;
 }
@@ -411,7 +408,6 @@ EBRequest::EBRequest(double Time, int PID): Packet(Time, PID)
 
 EBRequest::~EBRequest(void )
 {
-	delete HD;
 	free(this->IDs);
 	return;
 }
@@ -439,7 +435,6 @@ RequestPacket::RequestPacket(double Time, int PID): Packet(Time, PID)
 
 RequestPacket::~RequestPacket(void )
 {
-	delete HD;
 	free(this->IDs);
 	return;
 }
@@ -467,7 +462,6 @@ MarkedRequestPacket::MarkedRequestPacket(double Time, int PID): Packet(Time, PID
 
 MarkedRequestPacket::~MarkedRequestPacket(void )
 {
-	delete HD;
 	free(this->IDs);
 	free(this->marked);
 	return;
@@ -495,7 +489,6 @@ EnRequestPacket::EnRequestPacket(double Time, int PID): Packet(Time, PID)
 
 EnRequestPacket::~EnRequestPacket(void )
 {
-	delete HD;
 	free(this->IDs);
 	free(this->Extras);
 	return;
@@ -522,7 +515,6 @@ DirectRequestPacket::DirectRequestPacket(double Time, int PID): Packet(Time, PID
 
 DirectRequestPacket::~DirectRequestPacket(void )
 {
-	delete HD;
 	free(this->IDs);
 	return;
 }
@@ -548,7 +540,6 @@ ReqContacts::ReqContacts(double Time, int PID): Packet(Time, PID)
 
 ReqContacts::~ReqContacts(void )
 {
-	delete HD;
 	return;
 }
 
@@ -562,7 +553,6 @@ Contacts::Contacts(double Time, int PID): Packet(Time, PID)
 
 Contacts::~Contacts(void)
 {
-	delete HD;
 	free(this->NodeIDs);
 	return;
 }
@@ -590,7 +580,6 @@ DstAvail::DstAvail(double Time, int PID): Packet(Time, PID)
 
 DstAvail::~DstAvail(void )
 {
-	delete HD;
 	free(this->NodeIDs);
 	return;
 }
@@ -617,7 +606,6 @@ PktDests::PktDests(double Time, int PID): Packet(Time, PID)
 
 PktDests::~PktDests(void )
 {
-	delete HD;
 	free((struct PktDest *)this->PktInfo);
 	return;
 }
@@ -642,7 +630,6 @@ PktUtils::PktUtils(double Time, int PID): Packet(Time, PID)
 
 PktUtils::~PktUtils(void )
 {
-	delete HD;
 	free((struct PktUtil *)this->PktInfo);
 	return;
 }
@@ -667,7 +654,6 @@ PktMultiUtils::PktMultiUtils(double Time, int PID): Packet(Time, PID)
 
 PktMultiUtils::~PktMultiUtils(void )
 {
-	delete HD;
 	free((struct PktMultiUtil *)this->PktInfo);
 	return;
 }
@@ -692,7 +678,6 @@ DPs::DPs(double Time, int PID): Packet(Time, PID)
 
 DPs::~DPs(void )
 {
-	delete HD;
 	free(DP);
 	return;
 }
@@ -721,7 +706,6 @@ DPsEnhanced::DPsEnhanced(double Time, int PID): Packet(Time, PID)
 
 DPsEnhanced::~DPsEnhanced(void )
 {
-	delete HD;
 	free(this->DP);
 	free(this->IDs);
 	free(this->DirectDP);
@@ -772,7 +756,6 @@ IntiFreq::IntiFreq(double Time, int PID): Packet(Time, PID)
 
 IntiFreq::~IntiFreq(void )
 {
-	delete HD;
 	free(this->FreqIntimacy);
 	return;
 }
@@ -798,7 +781,6 @@ Destinations::Destinations(double Time, int PID): Packet(Time, PID)
 
 Destinations::~Destinations(void )
 {
-	delete HD;
 	free(this->DestInfo);
 	return;
 }
@@ -834,7 +816,6 @@ DstUtils::DstUtils(double Time, int PID): Packet(Time, PID)
 
 DstUtils::~DstUtils(void )
 {
-	delete HD;
 	free(this->DestInfo);
 	return;
 }
@@ -860,7 +841,6 @@ RequestPacketUtils::RequestPacketUtils(double Time, int PID): Packet(Time, PID)
 
 RequestPacketUtils::~RequestPacketUtils(void )
 {
-	delete HD;
 	free(this->DestInfo);
 	return;
 }
@@ -891,7 +871,6 @@ ReqDestinations::ReqDestinations(double Time, int PID): Packet(Time, PID)
 
 ReqDestinations::~ReqDestinations(void )
 {
-	delete HD;
 	free(this->pktsForDest);
 	free(this->AlreadyOwned);
 	free(this->senderUtils);
@@ -961,7 +940,6 @@ ReqLCandFS::ReqLCandFS(double Time, int PID): Packet(Time, PID)
 
 ReqLCandFS::~ReqLCandFS(void )
 {
-	delete HD;
 	return;
 }
 
@@ -979,7 +957,6 @@ LCandFS::LCandFS(double Time, bool *LC, bool **FS, int PID): Packet(Time, PID)
 
 LCandFS::~LCandFS(void)
 {
-	delete HD;
 	for(int i = 0; i < maxN; i++)
 	{
 		free(this->familiarSets[i]);
@@ -1006,7 +983,6 @@ BubbleSummary::BubbleSummary(double Time, int numPkts, struct PktDest* sumVec, b
 
 BubbleSummary::~BubbleSummary(void)
 {
-	delete HD;
 	free(this->summaryVector);
 	free(this->localCommunity);
 	return;
@@ -1023,7 +999,6 @@ AntiPacket::AntiPacket(double Time, int PID): Packet(Time, PID)
 
 AntiPacket::~AntiPacket(void )
 {
-	delete HD;
 	free(this->IDs);
 	return;
 }
@@ -1050,7 +1025,6 @@ AntiPacketResponse::AntiPacketResponse(double Time, int PID): Packet(Time, PID)
 
 AntiPacketResponse::~AntiPacketResponse(void )
 {
-	delete HD;
 	free(this->IDs);
 	return;
 }
@@ -1076,7 +1050,6 @@ ReqRSPM::ReqRSPM(double Time, int PID): Packet(Time, PID)
 
 ReqRSPM::~ReqRSPM(void )
 {
-	delete HD;
 	return;
 }
 
@@ -1090,7 +1063,6 @@ IndRSPM::IndRSPM(double Time, int PID): Packet(Time, PID)
 
 IndRSPM::~IndRSPM(void)
 {
-	delete HD;
 	free(this->Dests);
 	return;
 }
@@ -1115,7 +1087,6 @@ BufferRequest::BufferRequest(double Time, int PID): Packet(Time, PID)
 
 BufferRequest::~BufferRequest(void )
 {
-	delete HD;
 	return;
 }
 
@@ -1130,7 +1101,6 @@ BufferReply::BufferReply(double Time, int PID): Packet(Time, PID)
 
 BufferReply::~BufferReply(void )
 {
-	delete HD;
 	free(this->bufInfo);
 	return;
 }
@@ -1157,7 +1127,6 @@ PktUpd::PktUpd(double Time, int PID): Packet(Time, PID)
 
 PktUpd::~PktUpd(void )
 {
-	delete HD;
 	free((struct PktUtilDDandDI *)this->PktInfo);
 	return;
 }
@@ -1182,7 +1151,6 @@ MultUtils::MultUtils(double Time, int PID): Packet(Time, PID)
 
 MultUtils::~MultUtils(void )
 {
-	delete HD;
 	free((struct PktUtilDDandDI *)this->PktInfo);
 	return;
 }
@@ -1206,7 +1174,6 @@ AckPack::AckPack(double Time, int PID): Packet(Time, PID)
 }
 AckPack::~AckPack(void )
 {
-	delete HD;
 	free((struct Kouf_util *)this->PktInfo);
 	return;
 }
@@ -161,7 +161,7 @@ protected:
 	int SubType;
 	int Pktsize;//in Bytes
 	double StartTime;
-	Header *HD;
+	Header HD;
 	void *extraInfo;
 public:
 	Packet(double Time,int PID);
@@ -174,8 +174,9 @@ public:
 	void setID(int ID){this->UniqueID=ID;};
 	int getType(void){return this->Type;};
 	void PrintPkt(void);
-	void setHeader(Header *head){this->HD=head;};
-	Header *getHeader(void){return this->HD;};
+	void setHeader(const Header &head){this->HD=head;};
+	Header *getHeader(void){return &(this->HD);};
+	bool hasHeader(void){return (this->HD.GetType() != NO_HEADER);};
 	void setExtraInfo(void *info);
 	void *getExtraInfo();
 	virtual Packet *Duplicate(int hops)=0;
@@ -186,6 +187,7 @@ public:
 	virtual int GetSubType(void){return this->SubType;};
 	virtual int getAvailSpace(void){return 0;};
 	virtual double *getQWvalues(void){return NULL;};
+	virtual void Checkpoint(Snapshot *snap);
 };
 
 /* DataPacket
@@ -204,6 +206,7 @@ public:
 	virtual Packet *Duplicate(int hops);
 	virtual bool AccessPkt(void);
 	virtual void SetRecipients(int N);
+	virtual void Checkpoint(Snapshot *snap);
 };
 
 /* SummaryPacket
@@ -57,56 +57,64 @@ PacketBuffer::PacketBuffer(int ID, Statistics *St, God *G, int BSize, int droppi
 	this->SGod = G;
 	this->NID = ID;
 	this->bufferRecording = false;
+	this->History = NULL;
 	this->numPacketDrops = 0;
+	this->NextSeq = 0;
+	this->Index = new BufferIndex(G, ID);
 
+	/* The dropping policy enables the buffer orderings it needs */
+	#ifdef SPECIALIZED_BUILD
+	this->DropPol = new DROPPING_TYPE(&Entries, this->Index, this->Stat);
+	#else
 	switch(droppingPolicyID)
 	{
 		case DF_DP:
 		{
-			this->DropPol = new DropFront(&Entries, this->Stat);
+			this->DropPol = new DropFront(&Entries, this->Index, this->Stat);
 			break;
 		}
 		case DT_DP:
 		{
-			this->DropPol = new DropTail(&Entries, this->Stat);
+			this->DropPol = new DropTail(&Entries, this->Index, this->Stat);
 			break;
 		}
 		case DO_DP:
 		{
-			this->DropPol = new DropOldest(&Entries, this->Stat);
+			this->DropPol = new DropOldest(&Entries, this->Index, this->Stat);
 			break;
 		}
 		case DY_DP:
 		{
-			this->DropPol = new DropYoungest(&Entries, this->Stat);
+			this->DropPol = new DropYoungest(&Entries, this->Index, this->Stat);
 			break;
 		}
 		case DFASP_DP:
 		{
-			this->DropPol = new DropFrontASP(&Entries, this->Stat);
+			this->DropPol = new DropFrontASP(&Entries, this->Index, this->Stat);
 			break;
 		}
 		case DTASP_DP:
 		{
-			this->DropPol = new DropTailASP(&Entries, this->Stat);
+			this->DropPol = new DropTailASP(&Entries, this->Index, this->Stat);
 			break;
 		}
 		case DOASP_DP:
 		{
-			this->DropPol = new DropOldestASP(&Entries, this->Stat);
+			this->DropPol = new DropOldestASP(&Entries, this->Index, this->Stat);
 			break;
 		}
 		case DYASP_DP:
 		{
-			this->DropPol = new DropYoungestASP(&Entries, this->Stat);
+			this->DropPol = new DropYoungestASP(&Entries, this->Index, this->Stat);
 			break;
 		}
 		default:
 		{
-			this->DropPol = new DropFront(&Entries, this->Stat);
+			this->DropPol = new DropFront(&Entries, this->Index, this->Stat);
 			break;
 		}
 	}
+	#endif
 
 	return;
 }
@@ -122,28 +130,146 @@ PacketBuffer::~PacketBuffer()
 	}
 	Entries.clear();
  	
-	while(!Records.empty())
-	{
-		delete Records.front();
-		Records.pop_front();
-	}
-	Records.clear();
+	delete History;
 	
 	delete DropPol;
+	delete Index;
+	return;
+}
+
+/* appendEntry
+ * -----------
+ * Inserts an entry at the end of the buffer and registers it to the buffer orderings.
+ */
+void PacketBuffer::appendEntry(PacketEntry *entry)
+{
+	entry->InsSeq = NextSeq++;
+	Entries.push_back(entry);
+	Index->insert(--Entries.end());
+	return;
+}
+
+/* eraseEntry
+ * ----------
+ * Discards the entry at the given position of the buffer. Returns the position of the
+ * next entry. Note that the packet counter is not updated.
+ */
+list<PacketEntry*>::iterator PacketBuffer::eraseEntry(list<PacketEntry*>::iterator pos)
+{
+	Index->remove(pos);
+	delete (*pos);
+	return Entries.erase(pos);
+}
+
+
+/* Checkpoint
+ * ----------
+ * Saves or restores the buffer contents. The entries are restored in their original
+ * order and keep their insertion sequence numbers, so that all buffer orderings are
+ * rebuilt exactly as they were. Encoded entries are not supported.
+ */
+void PacketBuffer::Checkpoint(Snapshot *snap)
+{
+	int num;
+	int i;
+	PacketEntry *entry;
+	list<PacketEntry*>::iterator it;
+
+
+	entry=NULL;
+
+	snap->Section("BUFF");
+	snap->Match(this->BufferSize,"buffer size");
+	snap->Value(this->PacketNum);
+	snap->Value(this->EncodedNum);
+	snap->Value(this->numPacketDrops);
+	snap->Value(this->bufferRecording);
+	if(this->EncodedNum > 0)
+	{
+		snap->Unsupported("encoded packets");
+	}
+
+	num=(int)Entries.size();
+	snap->Value(num);
+	it=Entries.begin();
+	for(i=0;i<num;i++)
+	{
+		if(snap->isSaving())
+		{
+			entry=(*it);
+			++it;
+			if(entry->Encoded || entry->MaxUtils != NULL)
+			{
+				snap->Unsupported("encoded or multi-utility buffer entries");
+			}
+		}
+		else
+		{
+			entry=new PacketEntry(-1,-1,-1,0,0,-1,0.0);
+		}
+		entry->FWused.Checkpoint(snap);
+		entry->NodesCovered.Checkpoint(snap);
+		entry->AllprevHop.Checkpoint(snap);
+		snap->Value(entry->MaxUtil);
+		snap->Value(entry->MaxUtilDestDep);
+		snap->Value(entry->MaxUtilDestInd);
+		snap->Value(entry->CreationTime);
+		snap->Value(entry->InsTime);
+		snap->Value(entry->InsSeq);
+		snap->Value(entry->pktID);
+		snap->Value(entry->Hops);
+		snap->Value(entry->Source);
+		snap->Value(entry->Destination);
+		snap->Value(entry->prevHop);
+		snap->Value(entry->Replicas);
+		snap->Value(entry->Forwarded);
+		snap->Value(entry->mimic);
+		if(snap->isRestoring())
+		{
+			/* appendEntry() assigns the next sequence number */
+			this->NextSeq=entry->InsSeq;
+			appendEntry(entry);
+		}
+	}
+	snap->Value(this->NextSeq);
+
+	if(this->bufferRecording)
+	{
+		this->History->Checkpoint(snap);
+	}
 	return;
 }
 
 /* enableBufferRecording
  * ---------------------
  * If buffer recording is enabled, then more information regarding packet forwards/drops is
- * recorded in order to enable additional statistics.
+ * recorded in order to enable additional statistics. The statistics cover periods that start
+ * at most horizon seconds in the past (see BufferHistory.h).
  */
-void PacketBuffer::enableBufferRecording()
+void PacketBuffer::enableBufferRecording(double horizon)
 {
+	if(!this->bufferRecording)
+	{
+		this->History = new BufferHistory(horizon);
+	}
 	this->bufferRecording = true;
 	return;
 }
 
+/* releaseBufferRecords
+ * --------------------
+ * Informs the buffer that the statistics of periods starting before the given time are no
+ * longer needed.
+ */
+void PacketBuffer::releaseBufferRecords(double before)
+{
+	if(this->bufferRecording)
+	{
+		this->History->release(before);
+	}
+	return;
+}
+
 /* addPkt
  * ------
  * Adds a new packet to the buffer. In the case of full buffer a packet is discarded 
@@ -151,10 +277,7 @@ void PacketBuffer::enableBufferRecording()
  */
 bool PacketBuffer::addPkt(int pktID, int Dest,int Src,double CurTime, int hops, int prev, double CrtTime)
 {
-	double drpCrtTime;
 	PacketEntry *tmp;
-	PacketRecord *rec1;
-	PacketRecord *rec2;
 	list<PacketEntry*>::iterator it;
 
 
@@ -175,38 +298,28 @@ bool PacketBuffer::addPkt(int pktID, int Dest,int Src,double CurTime, int hops,
 	/* In case that the buffer is finite, check if it is full */
 	if(isFull())
 	{
-		drpCrtTime = DropPol->Drop();
+		DropPol->Drop();
 		PacketNum--;
 		numPacketDrops++;
 
 		if(bufferRecording)
 		{
 			/* Keep a record of this action */
-			if(TTL == 0)
-			{
-				rec1 = new PacketRecord(SGod->getSimTime(), -1, false, true, false);
-				Records.push_back(rec1);
-			}
-			else
-			{
-				rec1 = new PacketRecord(SGod->getSimTime(), TTL - (SGod->getSimTime() - drpCrtTime), false, true, false);
-				Records.push_back(rec1);
-			}
+			History->recordDrop(SGod->getSimTime());
 		}
 	}
 
 
 	/* Add the new packet */
 	tmp = new PacketEntry(pktID, Dest,Src, CurTime, hops, prev, CrtTime);
-	Entries.push_back(tmp);
+	appendEntry(tmp);
 	PacketNum++;
 // 	printf("%d:Added packet %d to the buffer\n",this->NID,pktID);
 
 	if(bufferRecording)
 	{
 		/* Keep a record of this action */
-		rec2 = new PacketRecord(SGod->getSimTime(), getRTTL(pktID), true, false, false);
-		Records.push_back(rec2);
+		History->recordInsertion(SGod->getSimTime(), (TTL == 0)?(-1):(TTL - (SGod->getSimTime() - CrtTime)));
 	}
 
 	return true;
@@ -218,10 +331,7 @@ bool PacketBuffer::addPkt(int pktID, int Dest,int Src,double CurTime, int hops,
  */
 bool PacketBuffer::addPkt(int pktID, int Dest, int Src, double CurTime, int hops, int prev, double CrtTime, SimBetTSmetrics* Umetrics)
 {
-	double drpCrtTime;
 	PacketEntry *tmp;
-	PacketRecord *rec1;
-	PacketRecord *rec2;
 	list<PacketEntry*>::iterator it;
 
 
@@ -242,37 +352,27 @@ bool PacketBuffer::addPkt(int pktID, int Dest, int Src, double CurTime, int hops
 	/* In case that the buffer is finite, check if it is full */
 	if(isFull())
 	{
-		drpCrtTime = DropPol->Drop();
+		DropPol->Drop();
 		PacketNum--;
 		numPacketDrops++;
 
 		if(bufferRecording)
 		{
 			/* Keep a record of this action */
-			if(TTL == 0)
-			{
-				rec1 = new PacketRecord(SGod->getSimTime(), -1, false, true, false);
-				Records.push_back(rec1);
-			}
-			else
-			{
-				rec1 = new PacketRecord(SGod->getSimTime(), TTL - (SGod->getSimTime() - drpCrtTime), false, true, false);
-				Records.push_back(rec1);
-			}
+			History->recordDrop(SGod->getSimTime());
 		}
 	}
 
 
 	/* Add the new packet */
 	tmp = new PacketEntry(pktID, Dest,Src, CurTime, hops, prev, CrtTime,Umetrics);
-	Entries.push_back(tmp);
+	appendEntry(tmp);
 	PacketNum++;
 
 	if(bufferRecording)
 	{
 		/* Keep a record of this action */
-		rec2 = new PacketRecord(SGod->getSimTime(), getRTTL(pktID), true, false, false);
-		Records.push_back(rec2);
+		History->recordInsertion(SGod->getSimTime(), (TTL == 0)?(-1):(TTL - (SGod->getSimTime() - CrtTime)));
 	}
 
 	return true;
@@ -301,7 +401,7 @@ bool PacketBuffer::match(int *pktID,int depth)
 					found=false;
 					for(int j=0;j<depth;j++)
 					{
-						if(pktID[i] == (*it)->EncodedPktIDs[j])
+						if(pktID[i] == (*it)->Enc->PktIDs[j])
 						{
 							found=true;
 							break;
@@ -341,32 +441,21 @@ bool PacketBuffer::addEncoded(int* pktID, int* Dest, int* Src, int depth, double
 		return false;
 	}
 	/* In case that the buffer is finite, check if it is full */
-	double drpCrtTime=0.0;
-	PacketRecord *rec1;
 	if(isFull())
 	{
-		drpCrtTime = DropPol->Drop();
+		DropPol->Drop();
 		PacketNum--;
 		numPacketDrops++;
 
 		if(bufferRecording)
 		{
 			/* Keep a record of this action */
-			if(TTL == 0)
-			{
-				rec1 = new PacketRecord(SGod->getSimTime(), -1, false, true, false);
-				Records.push_back(rec1);
-			}
-			else
-			{
-				rec1 = new PacketRecord(SGod->getSimTime(), TTL - (SGod->getSimTime() - drpCrtTime), false, true, false);
-				Records.push_back(rec1);
-			}
+			History->recordDrop(SGod->getSimTime());
 		}
 	}
 	/* Add the new packet */
 	PacketEntry *tmp = new PacketEntry(pktID, Dest,Src,depth,CrtTime,CurTime, prev,mimic);
-	Entries.push_back(tmp);
+	appendEntry(tmp);
 	PacketNum++;
 	return true;
 }
@@ -386,32 +475,21 @@ bool PacketBuffer::addEncoded(int* pktID, int* Dest, int* Src, double *Utils,int
 		return false;
 	}
 	/* In case that the buffer is finite, check if it is full */
-	double drpCrtTime=0.0;
-	PacketRecord *rec1;
 	if(isFull())
 	{
-		drpCrtTime = DropPol->Drop();
+		DropPol->Drop();
 		PacketNum--;
 		numPacketDrops++;
 
 		if(bufferRecording)
 		{
 			/* Keep a record of this action */
-			if(TTL == 0)
-			{
-				rec1 = new PacketRecord(SGod->getSimTime(), -1, false, true, false);
-				Records.push_back(rec1);
-			}
-			else
-			{
-				rec1 = new PacketRecord(SGod->getSimTime(), TTL - (SGod->getSimTime() - drpCrtTime), false, true, false);
-				Records.push_back(rec1);
-			}
+			History->recordDrop(SGod->getSimTime());
 		}
 	}
 	/* Add the new packet */
 	PacketEntry *tmp = new PacketEntry(pktID, Dest,Src,Utils,Rep,depth,CrtTime,CurTime, prev,mimic);
-	Entries.push_back(tmp);
+	appendEntry(tmp);
 	PacketNum++;
 	return true;
 }
@@ -476,7 +554,7 @@ void PacketBuffer::keepAsEncoded(int PID1, int PID2, double CurTime)
 	this->removeNativePkt(PID2);
 	/* Add the new packet */
 	PacketEntry *tmp = new PacketEntry(IDs,D,S,U,R,2,T,CurTime,NID,-1);
-	Entries.push_back(tmp);
+	appendEntry(tmp);
 	PacketNum++;
 	return;
 }
@@ -487,7 +565,6 @@ void PacketBuffer::keepAsEncoded(int PID1, int PID2, double CurTime)
  */
 bool PacketBuffer::removeNativePkt(int pktID)
 {
-	PacketRecord *rec;
 	list<PacketEntry*>::iterator it;
 	
 	
@@ -501,11 +578,9 @@ bool PacketBuffer::removeNativePkt(int pktID)
 			if(bufferRecording)
 			{
 				/* Keep a record of this action */
-				rec = new PacketRecord(SGod->getSimTime(), getRTTL(pktID), false, false, false);
-				Records.push_back(rec);
+				History->recordRemoval(SGod->getSimTime());
 			}
-			delete (*it);
-			Entries.erase(it);
+			eraseEntry(it);
 			PacketNum--;
 			return true;
 		}
@@ -521,7 +596,6 @@ bool PacketBuffer::removeNativePkt(int pktID)
  */
 bool PacketBuffer::removePkt(int pktID)
 {
-	PacketRecord *rec;
 	list<PacketEntry*>::iterator it= Entries.begin();
 	
 	
@@ -536,14 +610,12 @@ bool PacketBuffer::removePkt(int pktID)
 			if(bufferRecording)
 			{
 				/* Keep a record of this action */
-				rec = new PacketRecord(SGod->getSimTime(), getRTTL(pktID), false, false, false);
-				Records.push_back(rec);
+				History->recordRemoval(SGod->getSimTime());
 			}
 			#ifdef PACKET_BUFFER_DEBUG
 			printf("Native!\n");
 			#endif
-			delete (*it);
-			Entries.erase(it++);
+			it = eraseEntry(it);
 			PacketNum--;
 			deleted=true;
 			//return true;
@@ -552,13 +624,12 @@ bool PacketBuffer::removePkt(int pktID)
 		{
 			if((*it)->mimic != -1)
 			{
-				if((*it)->EncodedPktIDs[(*it)->mimic] == pktID)
+				if((*it)->Enc->PktIDs[(*it)->mimic] == pktID)
 				{
 					#ifdef PACKET_BUFFER_DEBUG
-					printf("Encoded (with %d)!-Full delete.\n",(*it)->EncodedPktIDs[swapPos((*it)->mimic)]);
+					printf("Encoded (with %d)!-Full delete.\n",(*it)->Enc->PktIDs[swapPos((*it)->mimic)]);
 					#endif
-					delete (*it);
-					Entries.erase(it++);
+					it = eraseEntry(it);
 					PacketNum--;
 					deleted=true;
 					//return true;
@@ -568,7 +639,7 @@ bool PacketBuffer::removePkt(int pktID)
 			{
 				for(int i=0;i<(*it)->CodingDepth;i++)
 				{
-					if((*it)->EncodedPktIDs[i] == pktID)
+					if((*it)->Enc->PktIDs[i] == pktID)
 					{
 						#ifdef PACKET_BUFFER_DEBUG
 						printf("Encoded!-partial delete.\n");
@@ -641,6 +712,26 @@ int PacketBuffer::getDistanceFromEnd(int ID)
 }
 
 
+/* getInsertionSeq
+ * ----------------
+ * Returns the insertion sequence number of the packet with ID (-1 if the packet does
+ * not exist). Packets are appended to the buffer, so a packet with a smaller sequence
+ * number is closer to the beginning of the buffer.
+ */
+long int PacketBuffer::getInsertionSeq(int ID)
+{
+	EntryPos pos;
+
+
+	if(!Index->lookup(ID, &pos))
+	{
+		return -1;
+	}
+
+	return (long int) (*pos)->InsSeq;
+}
+
+
 /* removeEncoded
  * -------------
  * Discards an encoded packet that contains a packet with pktID.
@@ -663,7 +754,7 @@ bool PacketBuffer::removeEncoded(int* pktID, int depth)
 					found=false;
 					for(int j=0;j<depth;j++)
 					{
-						if(pktID[i] == (*it)->EncodedPktIDs[j])
+						if(pktID[i] == (*it)->Enc->PktIDs[j])
 						{
 							found=true;
 							break;
@@ -683,8 +774,7 @@ bool PacketBuffer::removeEncoded(int* pktID, int depth)
 		}
 		if(match)
 		{
-			delete (*it);
-			Entries.erase(it);
+			eraseEntry(it);
 			PacketNum--;
 			return true;
 		}
@@ -794,7 +884,7 @@ bool PacketBuffer::PacketExists(int ID)
 			{
 				for(int i=0;i<(*it)->CodingDepth;i++)
 				{
-					if((*it)->EncodedPktIDs[i] == ID)
+					if((*it)->Enc->PktIDs[i] == ID)
 					{
 						return true;
 					}
@@ -802,7 +892,7 @@ bool PacketBuffer::PacketExists(int ID)
 			}
 			else
 			{
-				if((*it)->EncodedPktIDs[(*it)->mimic] == ID)
+				if((*it)->Enc->PktIDs[(*it)->mimic] == ID)
 				{
 					return true;
 				}
@@ -842,7 +932,7 @@ bool PacketBuffer::PacketExistsAsExtra(int ID)
 					{
 						continue;
 					}
-					if((*it)->EncodedPktIDs[i] == ID)
+					if((*it)->Enc->PktIDs[i] == ID)
 					{
 						return true;
 					}
@@ -961,7 +1051,9 @@ void PacketBuffer::SetHops(int pktID, int updHops)
 	{
 		if(((*it)->pktID == pktID) && !((*it)->Encoded))
 		{
+			Index->remove(it);
 			(*it)->setHops(updHops);
+			Index->insert(it);
 
 			return;
 		}
@@ -1019,9 +1111,9 @@ int PacketBuffer::GetPktDestination(int pktID)
 		{
 			for(int i=0;i<(*it)->CodingDepth;i++)
 			{
-				if((*it)->EncodedPktIDs[i] == pktID)
+				if((*it)->Enc->PktIDs[i] == pktID)
 				{
-					return (*it)->EncodedPktDest[i];
+					return (*it)->Enc->PktDest[i];
 				}
 			}
 		}
@@ -1100,7 +1192,7 @@ double PacketBuffer::getProjNetGrowth(double interval)
 	double projNetGrowth;
 	unsigned long insertedPackets;
 	unsigned long removedPackets;
-	list<PacketRecord*>::reverse_iterator rit;
+	struct BufferActivity act;
 
 
 	/* Delete the outdated packets because of the TTL value */
@@ -1109,23 +1201,11 @@ double PacketBuffer::getProjNetGrowth(double interval)
 	insertedPackets = 0;
 	removedPackets = 0;
 
-	for(rit = Records.rbegin(); rit != Records.rend(); ++rit)
+	if(bufferRecording)
 	{
-		if(((*rit)->getRegistrationTime() >= (SGod->getSimTime() - interval)) || ((*rit)->getPacketRTTL() == -1))
-		{
-			if((*rit)->getInsertedPacket())
-			{
-				insertedPackets++;
-			}
-			else if(!(*rit)->getDroppedPacket() && !(*rit)->getDeadPacket())
-			{
-				removedPackets++;
-			}
-		}
-		else if((*rit)->getRegistrationTime() < (SGod->getSimTime() - interval))
-		{
-			break;
-		}
+		act = recentActivity(interval);
+		insertedPackets = act.Inserted;
+		removedPackets = act.Removed;
 	}
 
 	if(interval > DBL_EPSILON)
@@ -1151,7 +1231,7 @@ double PacketBuffer::getMeanRTTL(double interval)
 	double meanRTTL;
 	double sumRTTL;
 	unsigned long insertedPackets;
-	list<PacketRecord*>::reverse_iterator rit;
+	struct BufferActivity act;
 
 
 	/* Delete the outdated packets because of the TTL value */
@@ -1160,20 +1240,11 @@ double PacketBuffer::getMeanRTTL(double interval)
 	insertedPackets = 0;
 	sumRTTL = 0.0;
 
-	for(rit = Records.rbegin(); rit != Records.rend(); ++rit)
+	if(bufferRecording)
 	{
-		if(((*rit)->getRegistrationTime() >= (SGod->getSimTime() - interval)) || ((*rit)->getPacketRTTL() == -1))
-		{
-			if((*rit)->getInsertedPacket())
-			{
-				insertedPackets++;
-				sumRTTL += (*rit)->getPacketRTTL();
-			}
-		}
-		else if((*rit)->getRegistrationTime() < (SGod->getSimTime() - interval))
-		{
-			break;
-		}
+		act = recentActivity(interval);
+		insertedPackets = act.Inserted;
+		sumRTTL = (double) act.SumRTTL;
 	}
 
 	if(insertedPackets == 0)
@@ -1188,6 +1259,21 @@ double PacketBuffer::getMeanRTTL(double interval)
 	return meanRTTL;
 }
 
+/* recentActivity
+ * --------------
+ * Returns the activity of the buffer during the last interval seconds. Without a TTL value
+ * the remaining TTL of every record is unknown and the whole history is taken into account.
+ */
+struct BufferActivity PacketBuffer::recentActivity(double interval)
+{
+	if(TTL == 0)
+	{
+		return History->getTotalActivity();
+	}
+
+	return History->getActivity(SGod->getSimTime() - interval, DBL_MAX);
+}
+
 /* getAllPackets
  * -------------
  * Returns an array that contains all the packet IDs (both native and encoded) that exist 
@@ -1218,11 +1304,11 @@ int *PacketBuffer::getAllPackets(void)
 			{
 				for(int i=0;i<(*it)->CodingDepth;i++)
 				{
-					if(!(this->exists(pkts,(*it)->EncodedPktIDs[i])))
+					if(!(this->exists(pkts,(*it)->Enc->PktIDs[i])))
 					{
 						pos++;
 						pkts = (int *) realloc(pkts, (pos + 1) * sizeof(int));
-						pkts[pos] = (*it)->EncodedPktIDs[i];
+						pkts[pos] = (*it)->Enc->PktIDs[i];
 						pkts[0] = pos;
 					}
 				}
@@ -1231,7 +1317,7 @@ int *PacketBuffer::getAllPackets(void)
 			{
 				pos++;
 				pkts = (int *) realloc(pkts, (pos + 1) * sizeof(int));
-				pkts[pos] = (*it)->EncodedPktIDs[(*it)->mimic];
+				pkts[pos] = (*it)->Enc->PktIDs[(*it)->mimic];
 				pkts[0] = pos;
 			}
 				
@@ -1275,11 +1361,11 @@ int *PacketBuffer::getPacketsNotDestinedTo(int destination)
 // 			{
 // 				for(int i=0;i<(*it)->CodingDepth;i++)
 // 				{
-// 					if(!(this->exists(pkts,(*it)->EncodedPktIDs[i])))
+// 					if(!(this->exists(pkts,(*it)->Enc->PktIDs[i])))
 // 					{
 // 						pos++;
 // 						pkts = (int *) realloc(pkts, (pos + 1) * sizeof(int));
-// 						pkts[pos] = (*it)->EncodedPktIDs[i];
+// 						pkts[pos] = (*it)->Enc->PktIDs[i];
 // 						pkts[0] = pos;
 // 					}
 // 				}
@@ -1288,7 +1374,7 @@ int *PacketBuffer::getPacketsNotDestinedTo(int destination)
 // 			{
 // 				pos++;
 // 				pkts = (int *) realloc(pkts, (pos + 1) * sizeof(int));
-// 				pkts[pos] = (*it)->EncodedPktIDs[(*it)->mimic];
+// 				pkts[pos] = (*it)->Enc->PktIDs[(*it)->mimic];
 // 				pkts[0] = pos;
 // 			}
 // 				
@@ -1606,19 +1692,19 @@ int *PacketBuffer::getPackets(int *Destinations)
 				{
 					for(int j=0;j<(*it)->CodingDepth;j++)
 					{
-						if(Destinations[i] == (*it)->EncodedPktDest[j] && !this->exists(pkts,(*it)->EncodedPktIDs[j]))
+						if(Destinations[i] == (*it)->Enc->PktDest[j] && !this->exists(pkts,(*it)->Enc->PktIDs[j]))
 						{
 							flag=true;
-							PID=(*it)->EncodedPktIDs[j];
+							PID=(*it)->Enc->PktIDs[j];
 						}
 					}
 				}
 				else
 				{
-					if(Destinations[i] == (*it)->EncodedPktDest[(*it)->mimic] && !this->exists(pkts,(*it)->EncodedPktIDs[(*it)->mimic]))
+					if(Destinations[i] == (*it)->Enc->PktDest[(*it)->mimic] && !this->exists(pkts,(*it)->Enc->PktIDs[(*it)->mimic]))
 					{
 						flag=true;
-						PID=(*it)->EncodedPktIDs[(*it)->mimic];
+						PID=(*it)->Enc->PktIDs[(*it)->mimic];
 					}
 				}
 			}
@@ -2322,17 +2408,17 @@ void PacketBuffer::UpdateLowUtil(int *p, double *Utils)
 					{
 						for(int j=0;j<(*it)->CodingDepth;j++)
 						{
-							if((*it)->EncodedPktIDs[j] == p[i] && Utils[i] > (*it)->EncodedMaxUtil[j])
+							if((*it)->Enc->PktIDs[j] == p[i] && Utils[i] > (*it)->Enc->MaxUtil[j])
 							{
-								(*it)->EncodedMaxUtil[j]=Utils[i];
+								(*it)->Enc->MaxUtil[j]=Utils[i];
 							}
 						}
 					}
 					else
 					{
-						if((*it)->EncodedPktIDs[(*it)->mimic] == p[i] && Utils[i] > (*it)->EncodedMaxUtil[(*it)->mimic])
+						if((*it)->Enc->PktIDs[(*it)->mimic] == p[i] && Utils[i] > (*it)->Enc->MaxUtil[(*it)->mimic])
 						{
-							(*it)->EncodedMaxUtil[(*it)->mimic]=Utils[i];
+							(*it)->Enc->MaxUtil[(*it)->mimic]=Utils[i];
 						}
 					}
 				}
@@ -2348,7 +2434,6 @@ void PacketBuffer::UpdateLowUtil(int *p, double *Utils)
  */
 void PacketBuffer::DropDeadPackets(void)
 {
-	PacketRecord *rec;
 	list<PacketEntry*>::iterator it;
 	
 	
@@ -2367,7 +2452,7 @@ void PacketBuffer::DropDeadPackets(void)
 			delflag=false;
 			for(int i=0;i<(*it)->CodingDepth;i++)
 			{
-				if((SGod->getSimTime() - (*it)->EncodedCreationTime[i]) > TTL)
+				if((SGod->getSimTime() - (*it)->Enc->CreationTime[i]) > TTL)
 				{
 					if((*it)->mimic == -1)
 					{
@@ -2383,9 +2468,8 @@ void PacketBuffer::DropDeadPackets(void)
 			}
 			if(delflag)
 			{
-				Stat->incPktsDied((*it)->EncodedCreationTime[pos]);
-				delete (*it);
-				it = Entries.erase(it);
+				Stat->incPktsDied((*it)->Enc->CreationTime[pos]);
+				it = eraseEntry(it);
 				PacketNum--;
 			}
 			else
@@ -2397,16 +2481,8 @@ void PacketBuffer::DropDeadPackets(void)
 		{
 			if((SGod->getSimTime() - (*it)->CreationTime) > TTL)
 			{
-				if(bufferRecording)
-				{
-					/* Keep a record of this action */
-					rec = new PacketRecord(SGod->getSimTime(), 0.0, false, false, true);
-					Records.push_back(rec);
-				}
-				
 				Stat->incPktsDied((*it)->CreationTime);
-				delete (*it);
-				it = Entries.erase(it);
+				it = eraseEntry(it);
 				PacketNum--;
 			}
 			else
@@ -2552,7 +2628,7 @@ void PacketBuffer::PrintPkts(void)
 		}
 		else
 		{
-			printf("(Encoded)pkt IDs:%d-%d mimic:%d\tSource:%d-%d\tDestination:%d-%d\tReplicas:%d-%d\tMaxUtil:%f-%f\n", (*it)->EncodedPktIDs[0], (*it)->EncodedPktIDs[1],(*it)->mimic,(*it)->EncodedPktSource[0],(*it)->EncodedPktSource[1],(*it)->EncodedPktDest[0],(*it)->EncodedPktDest[1],(*it)->EncodedReplicationValue[0],(*it)->EncodedReplicationValue[1],(*it)->EncodedMaxUtil[0],(*it)->EncodedMaxUtil[1]);
+			printf("(Encoded)pkt IDs:%d-%d mimic:%d\tSource:%d-%d\tDestination:%d-%d\tReplicas:%d-%d\tMaxUtil:%f-%f\n", (*it)->Enc->PktIDs[0], (*it)->Enc->PktIDs[1],(*it)->mimic,(*it)->Enc->PktSource[0],(*it)->Enc->PktSource[1],(*it)->Enc->PktDest[0],(*it)->Enc->PktDest[1],(*it)->Enc->ReplicationValue[0],(*it)->Enc->ReplicationValue[1],(*it)->Enc->MaxUtil[0],(*it)->Enc->MaxUtil[1]);
 		}
 	}
 	
@@ -2622,7 +2698,7 @@ int PacketBuffer::getEncodedDepth(int PID)
 		{
 			for(int i=0;i<(*it)->CodingDepth;i++)
 			{
-				if((*it)->EncodedPktIDs[i] == PID)
+				if((*it)->Enc->PktIDs[i] == PID)
 				{
 					return (*it)->CodingDepth;
 				}
@@ -2648,9 +2724,9 @@ int *PacketBuffer::getEncodedIDs(int PID)
 		{
 			for(int i=0;i<(*it)->CodingDepth;i++)
 			{
-				if((*it)->EncodedPktIDs[i] == PID)
+				if((*it)->Enc->PktIDs[i] == PID)
 				{
-					return (*it)->EncodedPktIDs;
+					return (*it)->Enc->PktIDs;
 				}
 			}
 		}
@@ -2675,9 +2751,9 @@ int PacketBuffer::getRepVal(int PID)
 		{
 			for(int i=0;i<(*it)->CodingDepth;i++)
 			{
-				if((*it)->EncodedPktIDs[i] == PID)
+				if((*it)->Enc->PktIDs[i] == PID)
 				{
-					return (*it)->EncodedReplicationValue[i];
+					return (*it)->Enc->ReplicationValue[i];
 				}
 			}
 		}
@@ -2706,9 +2782,9 @@ int PacketBuffer::getEncRepVal(int PID, int pos)
 		{
 			for(int i=0;i<(*it)->CodingDepth;i++)
 			{
-				if((*it)->EncodedPktIDs[i] == PID)
+				if((*it)->Enc->PktIDs[i] == PID)
 				{
-					return (*it)->EncodedReplicationValue[pos];
+					return (*it)->Enc->ReplicationValue[pos];
 				}
 			}
 		}
@@ -2733,9 +2809,9 @@ void PacketBuffer::setEncRepVal(int PID, int pos, int val)
 		{
 			for(int i=0;i<(*it)->CodingDepth;i++)
 			{
-				if((*it)->EncodedPktIDs[i] == PID)
+				if((*it)->Enc->PktIDs[i] == PID)
 				{
-					(*it)->EncodedReplicationValue[pos]=val;
+					(*it)->Enc->ReplicationValue[pos]=val;
 					return;
 				}
 			}
@@ -2761,9 +2837,9 @@ int PacketBuffer::getEncRepVal(int PID)
 		{
 			for(int i=0;i<(*it)->CodingDepth;i++)
 			{
-				if((*it)->EncodedPktIDs[i] == PID)
+				if((*it)->Enc->PktIDs[i] == PID)
 				{
-					return (*it)->EncodedReplicationValue[i];
+					return (*it)->Enc->ReplicationValue[i];
 				}
 			}
 		}
@@ -2787,9 +2863,9 @@ void PacketBuffer::setEncRepVal(int PID, int val)
 		{
 			for(int i=0;i<(*it)->CodingDepth;i++)
 			{
-				if((*it)->EncodedPktIDs[i] == PID)
+				if((*it)->Enc->PktIDs[i] == PID)
 				{
-					(*it)->EncodedReplicationValue[i]=val;
+					(*it)->Enc->ReplicationValue[i]=val;
 					return;
 				}
 			}
@@ -2814,9 +2890,9 @@ int *PacketBuffer::getEncodedRepVals(int PID)
 		{
 			for(int i=0;i<(*it)->CodingDepth;i++)
 			{
-				if((*it)->EncodedPktIDs[i] == PID)
+				if((*it)->Enc->PktIDs[i] == PID)
 				{
-					return (*it)->EncodedReplicationValue;
+					return (*it)->Enc->ReplicationValue;
 				}
 			}
 		}
@@ -2841,7 +2917,7 @@ int PacketBuffer::getMimic(int PID)
 		{
 			for(int i=0;i<(*it)->CodingDepth;i++)
 			{
-				if((*it)->EncodedPktIDs[i] == PID)
+				if((*it)->Enc->PktIDs[i] == PID)
 				{
 					return (*it)->mimic;
 				}
@@ -2872,9 +2948,9 @@ int PacketBuffer::getPacketDest(int PID)
 		{
 			for(int i=0;i<(*it)->CodingDepth;i++)
 			{
-				if((*it)->EncodedPktIDs[i] == PID)
+				if((*it)->Enc->PktIDs[i] == PID)
 				{
-					return (*it)->EncodedPktDest[i];
+					return (*it)->Enc->PktDest[i];
 				}
 			}
 		}
@@ -2903,9 +2979,9 @@ int PacketBuffer::getPacketSource(int PID)
 		{
 			for(int i=0;i<(*it)->CodingDepth;i++)
 			{
-				if((*it)->EncodedPktIDs[i] == PID)
+				if((*it)->Enc->PktIDs[i] == PID)
 				{
-					return (*it)->EncodedPktSource[i];
+					return (*it)->Enc->PktSource[i];
 				}
 			}
 		}
@@ -2933,7 +3009,7 @@ bool PacketBuffer::isEncoded(int PID)
 		{
 			for(int i=0;i<(*it)->CodingDepth;i++)
 			{
-				if((*it)->EncodedPktIDs[i] == PID)
+				if((*it)->Enc->PktIDs[i] == PID)
 				{
 					return true;
 				}
@@ -2960,7 +3036,7 @@ void PacketBuffer::ActivatePackets(int *IDs)
 			if((*it)->mimic != -1)
 			{
 				candidate=swapPos((*it)->mimic);
-				if(exists(IDs, (*it)->EncodedPktIDs[candidate]))
+				if(exists(IDs, (*it)->Enc->PktIDs[candidate]))
 				{
 					(*it)->mimic=-1;
 				}
@@ -2988,12 +3064,12 @@ void PacketBuffer::ActivatePackets(int *IDs, double *Utils)
 			if((*it)->mimic != -1)
 			{
 				candidate=swapPos((*it)->mimic);
-				if((pos=position(IDs, (*it)->EncodedPktIDs[candidate])) != -1)
+				if((pos=position(IDs, (*it)->Enc->PktIDs[candidate])) != -1)
 				{
 					(*it)->mimic=-1;
-					if(Utils[pos] > (*it)->EncodedMaxUtil[candidate])
+					if(Utils[pos] > (*it)->Enc->MaxUtil[candidate])
 					{
-						(*it)->EncodedMaxUtil[candidate]=Utils[pos];
+						(*it)->Enc->MaxUtil[candidate]=Utils[pos];
 					}
 				}
 			}
@@ -3019,10 +3095,10 @@ void PacketBuffer::ActivatePackets(int *IDs, int *RV)
 			if((*it)->mimic != -1)
 			{
 				candidate=swapPos((*it)->mimic);
-				if((pos=position(IDs, (*it)->EncodedPktIDs[candidate])) != -1)
+				if((pos=position(IDs, (*it)->Enc->PktIDs[candidate])) != -1)
 				{
 					(*it)->mimic=-1;
-					(*it)->EncodedReplicationValue[candidate]=RV[pos];
+					(*it)->Enc->ReplicationValue[candidate]=RV[pos];
 				}
 			}
 		}
@@ -3059,30 +3135,15 @@ unsigned int PacketBuffer::getNumPacketDrops()
  */
 unsigned int PacketBuffer::getNumPacketDrops(double startTime, double endTime)
 {
-	unsigned long droppedPackets;
-	list<PacketRecord*>::reverse_iterator rit;
-
-
 	/* Delete the outdated packets because of the TTL value */
 	DropDeadPackets();
 
-	droppedPackets = 0;
-	for(rit = Records.rbegin(); rit != Records.rend(); ++rit)
+	if(!bufferRecording)
 	{
-		if(((*rit)->getRegistrationTime() >= startTime) && ((*rit)->getRegistrationTime() < endTime))
-		{
-			if((*rit)->getDroppedPacket())
-			{
-				droppedPackets++;
-			}
-		}
-		else if((*rit)->getRegistrationTime() < startTime)
-		{
-			break;	
-		}
+		return 0;
 	}
 
-	return droppedPackets;
+	return History->getActivity(startTime, endTime).Dropped;
 }
 
 bool PacketBuffer::isBackgroundTraffic(int pktID)
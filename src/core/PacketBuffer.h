@@ -33,9 +33,14 @@
 	#include "PacketEntry.h"
 #endif
 
-#ifndef PACKET_RECORD_H
-	#define PACKET_RECORD_H
-	#include "PacketRecord.h"
+#ifndef BUFFER_INDEX_H
+	#define BUFFER_INDEX_H
+	#include "BufferIndex.h"
+#endif
+
+#ifndef BUFFER_HISTORY_H
+	#define BUFFER_HISTORY_H
+	#include "BufferHistory.h"
 #endif
 
 #ifndef STATS_H
@@ -48,11 +53,21 @@
 	#include "God.h"
 #endif
 
+#ifndef SNAPSHOT_H
+	#define SNAPSHOT_H
+	#include "Snapshot.h"
+#endif
+
 #ifndef DROPPING_POLICIES_H
 	#define DROPPING_POLICIES_H
 	#include "../dropping-policies/DroppingPolicies.h"
 #endif
 
+#ifndef SPECIALIZATION_H
+	#define SPECIALIZATION_H
+	#include "Specialization.h"
+#endif
+
 using namespace std;
 
 struct PktsWon
@@ -66,10 +81,11 @@ class PacketBuffer
 {
 public:
 	list<PacketEntry*> Entries;
-	list<PacketRecord*> Records;
+	BufferIndex *Index;
+	BufferHistory *History;
 	Statistics *Stat;
 	God *SGod;
-	DroppingPolicy *DropPol;
+	DROPPING_TYPE *DropPol;
 	int PacketNum;
 	int BufferSize;
 	int EncodedNum;
@@ -77,16 +93,21 @@ public:
 	int NID;
 	bool bufferRecording;
 	unsigned int numPacketDrops;
+	unsigned long NextSeq;
 
 	PacketBuffer(int ID, Statistics *St, God *G, int BSize, int droppingPolicyID, double TimeToLive);
 	~PacketBuffer();
 	bool addPkt(int pktID, int Dest,int Src, double CurTime, int hops, int prev, double CrtTime);
 	bool addPkt(int pktID, int Dest,int Src, double CurTime, int hops, int prev, double CrtTime,struct SimBetTSmetrics *Umetrics);
 	bool removePkt(int pktID);
+	void appendEntry(PacketEntry *entry);
+	list<PacketEntry*>::iterator eraseEntry(list<PacketEntry*>::iterator pos);
+	void Checkpoint(Snapshot *snap);
 	bool PacketExists(int ID);
 	bool NativePacketExists(int ID);
 	int getDistanceFromBegin(int ID);
 	int getDistanceFromEnd(int ID);
+	long int getInsertionSeq(int ID);
 	bool forwardedPkt(int pktID);//SDP related
 	bool isForwardedPkt(int pktID);//SDP related
 	bool UpdatePrevHop(int ID, int prev);
@@ -101,6 +122,7 @@ public:
 	double getRTTL(int pktID);
 	double getProjNetGrowth(double interval);
 	double getMeanRTTL(double interval);
+	struct BufferActivity recentActivity(double interval);
 	int *getAllPackets(void);
 	int *getPacketsNotDestinedTo(int destination);
 	struct PktIDandHops *getPktIDsandHopsNotDestinedTo(int destination);
@@ -135,7 +157,8 @@ public:
 	int getRepVal(int PID);
 	bool removeNativePkt(int pktID);
 	void UpdateLowUtil(int *p, double *Utils);
-	void enableBufferRecording();
+	void enableBufferRecording(double horizon);
+	void releaseBufferRecords(double before);
 	void printBufferContents();
 	unsigned int getNumPacketDrops();
 	unsigned int getNumPacketDrops(double startTime, double endTime);
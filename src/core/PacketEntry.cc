@@ -36,6 +36,7 @@ void PacketEntry::init(int ID, int Dest,int Src, int Itime, int hops, int prev,
 	this->pktID=ID;
 	this->CreationTime=CrtTime;
 	this->InsTime=Itime;
+	this->InsSeq=0;
 	this->Hops=hops;
 	this->Source=Src;
 	this->Destination=Dest;
@@ -50,12 +51,7 @@ void PacketEntry::init(int ID, int Dest,int Src, int Itime, int hops, int prev,
 	this->MaxUtilDestInd=0.0;
 	this->Encoded=false;
 	this->CodingDepth=0;
-	this->EncodedPktIDs=NULL;
-	this->EncodedPktDest=NULL;
-	this->EncodedCreationTime=NULL;
-	this->EncodedMaxUtil=NULL;
-	this->EncodedReplicationValue=NULL;
-	this->EncodedPktSource=NULL;
+	this->Enc=NULL;
 	this->mimic=-1;
 	this->MaxUtils=NULL;
 	return;
@@ -80,10 +76,13 @@ PacketEntry::PacketEntry(int *ID,int *Dest,int *Src,int depth,double *CrtTime,in
 	this->init(-1,-1,-1,Itime,0,prev,-1.0);
 	this->Encoded=true;
 	this->CodingDepth=depth;
-	this->EncodedPktIDs=ID;
-	this->EncodedPktSource=Src;
-	this->EncodedPktDest=Dest;
-	this->EncodedCreationTime=CrtTime;
+	this->Enc=(struct EncodedComponents *)malloc(sizeof(struct EncodedComponents));
+	this->Enc->PktIDs=ID;
+	this->Enc->PktSource=Src;
+	this->Enc->PktDest=Dest;
+	this->Enc->CreationTime=CrtTime;
+	this->Enc->MaxUtil=NULL;
+	this->Enc->ReplicationValue=NULL;
 	this->mimic=mimic;
 	return;
 }
@@ -98,13 +97,14 @@ PacketEntry::PacketEntry(int *ID,int *Dest,int *Src,double *Utils,int *Rep,int d
 	this->init(-1,-1,-1,Itime,0,prev,-1.0);
 	this->Encoded=true;
 	this->CodingDepth=depth;
-	this->EncodedPktIDs=ID;
-	this->EncodedPktSource=Src;
-	this->EncodedPktDest=Dest;
-	this->EncodedCreationTime=CrtTime;
+	this->Enc=(struct EncodedComponents *)malloc(sizeof(struct EncodedComponents));
+	this->Enc->PktIDs=ID;
+	this->Enc->PktSource=Src;
+	this->Enc->PktDest=Dest;
+	this->Enc->CreationTime=CrtTime;
+	this->Enc->MaxUtil=Utils;
+	this->Enc->ReplicationValue=Rep;
 	this->mimic=mimic;
-	this->EncodedMaxUtil=Utils;
-	this->EncodedReplicationValue=Rep;
 	return;
 }
 
@@ -126,16 +126,16 @@ PacketEntry::PacketEntry(int ID, int Dest, int Src, int Itime, int hops, int pre
  */
 PacketEntry::~PacketEntry()
 {
-	FWused.clear();
-	NodesCovered.clear();
-	AllprevHop.clear();
-	
-	free(EncodedPktIDs);
-	free(EncodedPktSource);
-	free(EncodedPktDest);
-	free(EncodedCreationTime);
-	free(EncodedMaxUtil);
-	free(EncodedReplicationValue);
+	if(Enc)
+	{
+		free(Enc->PktIDs);
+		free(Enc->PktSource);
+		free(Enc->PktDest);
+		free(Enc->CreationTime);
+		free(Enc->MaxUtil);
+		free(Enc->ReplicationValue);
+		free(Enc);
+	}
 	free(MaxUtils);
 	return;
 }
@@ -146,10 +146,13 @@ PacketEntry::~PacketEntry()
  */
 void PacketEntry::freeMem(void)
 {
-	free(EncodedPktIDs);
-	free(EncodedPktDest);
-	free(EncodedCreationTime);
-	free(EncodedMaxUtil);
+	if(Enc)
+	{
+		free(Enc->PktIDs);
+		free(Enc->PktDest);
+		free(Enc->CreationTime);
+		free(Enc->MaxUtil);
+	}
 	free(MaxUtils);
 	return;
 }
@@ -164,7 +167,7 @@ int PacketEntry::getDestination(void)
 	{
 		return this->Destination;
 	}
-	return this->EncodedPktDest[0];
+	return this->Enc->PktDest[0];
 }
 
 /* getDestination
@@ -177,7 +180,7 @@ int PacketEntry::getSource(void)
 	{
 		return this->Source;
 	}
-	return this->EncodedPktSource[0];
+	return this->Enc->PktSource[0];
 }
 
 /* SetReplicas
@@ -228,14 +231,7 @@ void PacketEntry::AddPrevHop(int prev)
  */
 bool PacketEntry::DupPrevHop(int prev)
 {
-	for(unsigned int i=0;i<(this->AllprevHop.size());i++)
-	{
-		if(this->AllprevHop[i] == prev)
-		{
-			return true;
-		}
-	}
-	return false;
+	return this->AllprevHop.contains(prev);
 }
 
 /* GetAllPrevHops
@@ -245,10 +241,10 @@ bool PacketEntry::DupPrevHop(int prev)
  */
 int *PacketEntry::GetAllPrevHops(void )
 {
-	int *res=(int *)malloc(sizeof(int)*(this->AllprevHop.size())+1);
+	int *res=(int *)malloc(sizeof(int)*(this->AllprevHop.size()+1));
 	res[0]=this->AllprevHop.size();
 	int pos=1;
-	for(unsigned int i=0;i<AllprevHop.size();i++)
+	for(int i=0;i<AllprevHop.size();i++)
 	{
 		res[pos]=this->AllprevHop[i];
 		pos++;
@@ -276,14 +272,7 @@ void PacketEntry::AddForwarder(int ID)
  */
 bool PacketEntry::IsOldForwarder(int ID)
 {
-	for(unsigned int i=0;i<(this->FWused.size());i++)
-	{
-		if(this->FWused[i] == ID)
-		{
-			return true;
-		}
-	}
-	return false;
+	return this->FWused.contains(ID);
 }
 
 /* GetAllFWs
@@ -293,10 +282,10 @@ bool PacketEntry::IsOldForwarder(int ID)
  */
 int *PacketEntry::GetAllFWs(void )
 {
-	int *res=(int *)malloc(sizeof(int)*(this->FWused.size())+1);
+	int *res=(int *)malloc(sizeof(int)*(this->FWused.size()+1));
 	res[0]=this->FWused.size();
 	int pos=1;
-	for(unsigned int i=0;i<FWused.size();i++)
+	for(int i=0;i<FWused.size();i++)
 	{
 		res[pos]=this->FWused[i];
 		pos++;
@@ -332,7 +321,7 @@ int *PacketEntry::getCovered(void )
 	int *res=(int *)malloc(sizeof(int)*(this->NodesCovered.size()+1));
 	res[0]=this->NodesCovered.size();
 	int pos=1;
-	for(unsigned int i=0;i<(this->NodesCovered.size());i++)
+	for(int i=0;i<(this->NodesCovered.size());i++)
 	{
 		res[pos]=this->NodesCovered[i];
 		pos++;
@@ -346,14 +335,7 @@ int *PacketEntry::getCovered(void )
  */
 bool PacketEntry::IsCovered(int ID)
 {
-	for(unsigned int i=0;i<(this->NodesCovered.size());i++)
-	{
-		if(this->NodesCovered[i] == ID)
-		{
-			return true;
-		}
-	}
-	return false;
+	return this->NodesCovered.contains(ID);
 }
 
 /* getEncodedRepVal
@@ -364,7 +346,7 @@ bool PacketEntry::IsCovered(int ID)
  */
 int PacketEntry::getEncodedRepVal(int pos)
 {
-	return this->EncodedReplicationValue[pos];
+	return this->Enc->ReplicationValue[pos];
 }
 
 /* setEncodedRepVal
@@ -374,7 +356,7 @@ int PacketEntry::getEncodedRepVal(int pos)
  */
 void PacketEntry::setEncodedRepVal(int pos, int val)
 {
-	this->EncodedReplicationValue[pos]=val;
+	this->Enc->ReplicationValue[pos]=val;
 }
 
 /* GetMaxUtil
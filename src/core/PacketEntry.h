@@ -24,9 +24,13 @@
 
 #include <stdlib.h>
 #include <stdio.h>
-#include <vector>
 #include <string>
 
+#ifndef NODE_LIST_H
+	#define NODE_LIST_H
+	#include "NodeList.h"
+#endif
+
 
 using namespace std;
 
@@ -39,25 +43,25 @@ struct SimBetTSmetrics
 	double Frequency;
 };
 
+/* Native packets that were combined into an encoded packet */
+struct EncodedComponents
+{
+	int *PktIDs;
+	int *PktSource;
+	int *PktDest;
+	double *CreationTime;
+	double *MaxUtil;
+	int *ReplicationValue;
+};
+
+/* The attributes that are read while scanning the buffer come first and are kept
+ * together. Lists of nodes are stored inline while short (see NodeList.h) and the
+ * attributes of encoded packets and of SimBetTS are allocated only for the entries
+ * that use them.
+ */
 class PacketEntry
 {
 public:
-	//Marks Nodes that used as FWers for this packet
-	vector<int> FWused;
-	//Mark Nodes that are covered (with previous FW)
-	vector<int> NodesCovered;
-	vector<int> AllprevHop;
-	
-	//Maximum utility values - This packet was replicated to a node that has these utility values
-	struct SimBetTSmetrics *MaxUtils;
-	
-	//Maximum utility value - This packet was replicated to a node that had this utility value
-	double MaxUtil;
-	double MaxUtilDestDep;
-	double MaxUtilDestInd;
-	
-	double CreationTime;
-	double InsTime;
 	int pktID;
 	int Hops;
 	int Source;
@@ -69,18 +73,33 @@ public:
 	//Used for SC Routing Algorithms
 	bool Forwarded;
 	
-	
 	//used for encoded packets
 	bool Encoded;
 	int CodingDepth;
-	int *EncodedPktIDs;
-	int *EncodedPktSource;
-	int *EncodedPktDest;
-	double *EncodedCreationTime;
-	double *EncodedMaxUtil;
-	int *EncodedReplicationValue;
 	int mimic; //-1: means do not mimic - 0:mimic slot 0 component  - 1:mimic slot 1 component
 	
+	//Insertion sequence number (assigned by the buffer)
+	unsigned long InsSeq;
+	double CreationTime;
+	double InsTime;
+	
+	//Maximum utility value - This packet was replicated to a node that had this utility value
+	double MaxUtil;
+	double MaxUtilDestDep;
+	double MaxUtilDestInd;
+	
+	//Marks Nodes that used as FWers for this packet
+	NodeList FWused;
+	//Mark Nodes that are covered (with previous FW)
+	NodeList NodesCovered;
+	NodeList AllprevHop;
+	
+	//Maximum utility values - This packet was replicated to a node that has these utility values
+	struct SimBetTSmetrics *MaxUtils;
+	
+	//Components of an encoded packet (NULL for native packets)
+	struct EncodedComponents *Enc;
+	
 	PacketEntry(int ID,int Dest,int Src,int Itime,int hops,int prev,double CrtTime);
 	PacketEntry(int *ID,int *Dest,int *Src,int depth,double *CrtTime,int Itime,int prev,int mimic);
 	PacketEntry(int *ID,int *Dest,int *Src,double *Utils,int *Rep,int depth,double *CrtTime,int Itime,int prev,int mimic);
@@ -39,6 +39,7 @@ PacketPool::PacketPool(int trafficLoad)
 	this->numPkts = trafficLoad;
 	this->originalIDs = 0;
 	this->variousIDs = trafficLoad + 1;
+	this->Concurrent = false;
 
 	packets.set_empty_key(-1);
 	packets.set_deleted_key(-2);
@@ -63,6 +64,88 @@ PacketPool::~PacketPool()
 }
 
 
+/* Checkpoint
+ * ----------
+ * Saves or restores the ID counters and the data packets of the pool.
+ */
+void PacketPool::Checkpoint(Snapshot *snap)
+{
+	int num;
+	int ID;
+	double startTime;
+	Packet *pkt;
+	dense_hash_map<int,Packet*>::iterator it;
+
+
+	snap->Section("POOL");
+	snap->Value(this->originalIDs);
+	snap->Value(this->variousIDs);
+
+	if(snap->isSaving())
+	{
+		num = 0;
+		for(it = packets.begin(); it != packets.end(); ++it)
+		{
+			if(it->second->getType() == DATA_PACKET)
+			{
+				num++;
+			}
+		}
+		snap->Value(num);
+
+		for(it = packets.begin(); it != packets.end(); ++it)
+		{
+			if(it->second->getType() == DATA_PACKET)
+			{
+				ID = it->first;
+				startTime = it->second->GetStartTime();
+				snap->Value(ID);
+				snap->Value(startTime);
+				it->second->Checkpoint(snap);
+			}
+		}
+	}
+	else
+	{
+		snap->Value(num);
+		while(num-- > 0)
+		{
+			snap->Value(ID);
+			snap->Value(startTime);
+			pkt = new DataPacket(startTime, ID);
+			pkt->setHeader(SimpleHeader(-1, -1, -1));
+			pkt->Checkpoint(snap);
+			packets[ID] = pkt;
+		}
+	}
+
+	return;
+}
+
+
+/* ReserveOriginalID
+ * -----------------
+ * Returns the global identifier of the next packet that is generated at a source
+ * node. Reserving the identifiers in advance allows packets that are generated
+ * concurrently to get the same identifiers as in a sequential simulation.
+ */
+int PacketPool::ReserveOriginalID(void)
+{
+	ServiceGuard guard(&(this->Lock), this->Concurrent);
+
+
+	this->originalIDs++;
+
+	if(this->originalIDs > this->numPkts)
+	{
+		printf("\n[Error]: (PacketPool::ReserveOriginalID) The number of generated packets exceeded the expected traffic load (%d)\n\n", this->numPkts);
+		exit(EXIT_FAILURE);
+	}
+
+	return this->originalIDs;
+}
+
+
 /* AddOriginalPacket
  * -----------------
  * Adds a new packet "pkt" (given as argument) inside the hash map. This packet
@@ -71,26 +154,38 @@ PacketPool::~PacketPool()
  */
 void PacketPool::AddOriginalPacket(Packet* pkt)
 {
-	if(pkt->getHeader() == NULL)
+	if(!pkt->hasHeader())
 	{
 		printf("\n[Error]: (PacketPool::AddOriginalPacket) Cannot add a packet without a header in the packet pool\n\n");
 		exit(EXIT_FAILURE);
 	}
 
-	this->originalIDs++;
+	this->AddReservedPacket(pkt, this->ReserveOriginalID());
 
-	if(this->originalIDs > this->numPkts)
+	return;
+}
+
+
+/* AddReservedPacket
+ * -----------------
+ * Adds a new packet "pkt" (given as argument) inside the hash map, using the
+ * identifier "pktID" that was reserved for it with ReserveOriginalID().
+ */
+void PacketPool::AddReservedPacket(Packet* pkt, int pktID)
+{
+	ServiceGuard guard(&(this->Lock), this->Concurrent);
+
+
+	if(!pkt->hasHeader())
 	{
-		printf("\n[Error]: (PacketPool::AddOriginalPacket) The number of generated packets exceeded the expected traffic load (%d)\n\n", this->numPkts);
+		printf("\n[Error]: (PacketPool::AddReservedPacket) Cannot add a packet without a header in the packet pool\n\n");
 		exit(EXIT_FAILURE);
 	}
-	else
-	{
-		pkt->setID(this->originalIDs);
-		this->packets[this->originalIDs] = pkt;
 
-		return;
-	}
+	pkt->setID(pktID);
+	this->packets[pktID] = pkt;
+
+	return;
 }
 
 
@@ -102,7 +197,10 @@ void PacketPool::AddOriginalPacket(Packet* pkt)
  */
 void PacketPool::AddPacket(Packet* pkt)
 {
-	if(pkt->getHeader() == NULL)
+	ServiceGuard guard(&(this->Lock), this->Concurrent);
+
+
+	if(!pkt->hasHeader())
 	{
 		printf("\n[Error]: (PacketPool::AddPacket) Cannot add a packet without a header in the packet pool\n\n");
 		exit(EXIT_FAILURE);
@@ -131,6 +229,7 @@ void PacketPool::AddPacket(Packet* pkt)
  */
 bool PacketPool::ErasePacket(int pktID)
 {
+	ServiceGuard guard(&(this->Lock), this->Concurrent);
 	Packet *pkt;
 
 
@@ -156,5 +255,8 @@ bool PacketPool::ErasePacket(int pktID)
  */
 Packet* PacketPool::GetPacket(int pktID)
 {
+	ServiceGuard guard(&(this->Lock), this->Concurrent);
+
+
 	return this->packets[pktID];
 }
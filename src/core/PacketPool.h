@@ -32,6 +32,11 @@
 	#include "Packet.h"
 #endif
 
+#ifndef SERVICEGUARD_H
+	#define SERVICEGUARD_H
+	#include "ServiceGuard.h"
+#endif
+
 const int min_int = std::numeric_limits<int>::min();
 const int max_int = std::numeric_limits<int>::max();
 
@@ -50,12 +55,18 @@ private:
 	int originalIDs;
 	int variousIDs;
 	dense_hash_map<int,Packet*> packets;
+	mutex Lock;
+	bool Concurrent;
 
 public:
 	PacketPool(int trafficLoad);
 	~PacketPool();
+	void setConcurrent(bool val){this->Concurrent=val;};
+	int ReserveOriginalID(void);
 	void AddOriginalPacket(Packet* pkt);
+	void AddReservedPacket(Packet* pkt, int pktID);
 	void AddPacket(Packet *pkt);
 	bool ErasePacket(int pktID);
 	Packet *GetPacket(int pktID);
+	void Checkpoint(Snapshot *snap);
 };
@@ -0,0 +1,380 @@
+/*
+ *  Adyton: A Network Simulator for Opportunistic Networks
+ *  Copyright (C) 2015  Nikolaos Papanikos, Dimitrios-Georgios Akestoridis,
+ *  and Evangelos Papapetrou
+ *
+ *  This file is part of Adyton.
+ *
+ *  Adyton is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Adyton is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Adyton.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef SIMULATOR_H
+	#define SIMULATOR_H
+	#include "Simulator.h"
+#endif
+
+
+/* Constructor: ParallelEngine
+ * ---------------------------
+ * Starts the worker threads. The thread that calls Run() simulates groups too,
+ * so only "threads - 1" worker threads are started.
+ */
+ParallelEngine::ParallelEngine(Simulator *S, ConnectionMap *Map, PacketPool *P, int nodes, int threads, bool deterministic)
+{
+	int i;
+
+
+	this->Sim = S;
+	this->CMap = Map;
+	this->Pool = P;
+	this->NN = nodes;
+	this->Threads = threads;
+	this->Deterministic = deterministic;
+
+	this->Parent = (int *) malloc(this->NN * sizeof(int));
+	this->Visited = (int *) malloc(this->NN * sizeof(int));
+	this->Group = (int *) malloc(this->NN * sizeof(int));
+	for(i = 0; i < this->NN; i++)
+	{
+		this->Parent[i] = i;
+		this->Visited[i] = 0;
+		this->Group[i] = NOTSET;
+	}
+	this->Stamp = 0;
+
+	this->Batch = NULL;
+	this->Cascade = new EventList();
+	this->Round = 0;
+	this->Open = false;
+	this->Stop = false;
+	this->Busy = 0;
+	this->Remaining = 0;
+	this->NextGroup = 0;
+
+	for(i = 1; i < this->Threads; i++)
+	{
+		this->Workers.push_back(thread(&ParallelEngine::Worker, this));
+	}
+
+	return;
+}
+
+
+ParallelEngine::~ParallelEngine()
+{
+	unsigned int i;
+
+
+	{
+		unique_lock<mutex> guard(this->Lock);
+		this->Stop = true;
+	}
+	this->WorkReady.notify_all();
+
+	for(i = 0; i < this->Workers.size(); i++)
+	{
+		this->Workers[i].join();
+	}
+	this->Workers.clear();
+
+	delete this->Cascade;
+	free(this->Parent);
+	free(this->Visited);
+	free(this->Group);
+
+	return;
+}
+
+
+/* Touch
+ * -----
+ * Adds a node to the nodes that are involved in the current time instant.
+ */
+void ParallelEngine::Touch(int node)
+{
+	if(this->Visited[node] != this->Stamp)
+	{
+		this->Visited[node] = this->Stamp;
+		this->Parent[node] = node;
+		this->Group[node] = NOTSET;
+		this->Touched.push_back(node);
+	}
+
+	return;
+}
+
+
+/* Find
+ * ----
+ * Returns the representative node of the component of "node".
+ */
+int ParallelEngine::Find(int node)
+{
+	while(this->Parent[node] != node)
+	{
+		this->Parent[node] = this->Parent[this->Parent[node]];
+		node = this->Parent[node];
+	}
+
+	return node;
+}
+
+
+/* Join
+ * ----
+ * Merges the components of two nodes.
+ */
+void ParallelEngine::Join(int nodeA, int nodeB)
+{
+	nodeA = this->Find(nodeA);
+	nodeB = this->Find(nodeB);
+	if(nodeA != nodeB)
+	{
+		this->Parent[nodeB] = nodeA;
+	}
+
+	return;
+}
+
+
+/* Partition
+ * ---------
+ * Divides the events of the current time instant into groups of events whose
+ * nodes cannot reach each other during this instant. The events of each group
+ * keep their order. Returns false if the events must be simulated sequentially.
+ */
+bool ParallelEngine::Partition(void)
+{
+	unsigned int i;
+	int j;
+	int node;
+	int *row;
+	Event *e;
+
+
+	this->Stamp++;
+	this->Touched.clear();
+	this->Groups.clear();
+
+	for(i = 0; i < this->Batch->size(); i++)
+	{
+		e = (*this->Batch)[i];
+		if(e->getEventID() == 1 || e->getEventID() == 3)
+		{//Contact up or down
+			this->Touch(e->getNodeA());
+			this->Touch(e->getNodeB());
+			this->Join(e->getNodeA(), e->getNodeB());
+		}
+		else if(e->getEventID() == 2 && ((Transmission *)e)->getSender() == APPLICATION)
+		{//A new packet is generated
+			this->Touch(((Transmission *)e)->getReceiver());
+		}
+		else
+		{//Loading of contacts (or any other event) is simulated sequentially
+			return false;
+		}
+	}
+
+	//During this instant a node can reach every node of its connected component
+	for(i = 0; i < this->Touched.size(); i++)
+	{
+		node = this->Touched[i];
+		row = this->CMap->Map[node]->N;
+		for(j = 0; j < this->NN; j++)
+		{
+			if(row[j] == 1)
+			{
+				this->Touch(j);
+				this->Join(node, j);
+			}
+		}
+	}
+
+	for(i = 0; i < this->Batch->size(); i++)
+	{
+		e = (*this->Batch)[i];
+		if(e->getEventID() == 2)
+		{
+			node = this->Find(((Transmission *)e)->getReceiver());
+		}
+		else
+		{
+			node = this->Find(e->getNodeA());
+		}
+
+		if(this->Group[node] == NOTSET)
+		{
+			this->Group[node] = (int) this->Groups.size();
+			this->Groups.push_back(vector<int>());
+		}
+		this->Groups[this->Group[node]].push_back(i);
+	}
+
+	return (this->Groups.size() > 1);
+}
+
+
+/* Run
+ * ---
+ * Simulates the events of a time instant with all the threads. Returns false
+ * (without simulating anything) if the events cannot be divided into more
+ * than one group, in which case they must be simulated sequentially.
+ */
+bool ParallelEngine::Run(vector<Event*> *Events)
+{
+	unsigned int i;
+	Event *e;
+
+
+	this->Batch = Events;
+	if(!this->Partition())
+	{
+		return false;
+	}
+
+	//Packets get the identifiers they would get in a sequential simulation
+	this->Reserved.assign(this->Batch->size(), NOTSET);
+	if(this->Deterministic)
+	{
+		for(i = 0; i < this->Batch->size(); i++)
+		{
+			e = (*this->Batch)[i];
+			if(e->getEventID() == 2)
+			{
+				this->Reserved[i] = this->Pool->ReserveOriginalID();
+			}
+		}
+	}
+
+	{
+		unique_lock<mutex> guard(this->Lock);
+		this->Round++;
+		this->NextGroup = 0;
+		this->Remaining = (int) this->Groups.size();
+		this->Open = true;
+	}
+	this->WorkReady.notify_all();
+
+	this->RunGroups(this->Cascade);
+
+	{
+		unique_lock<mutex> guard(this->Lock);
+		while(this->Remaining > 0 || this->Busy > 0)
+		{
+			this->WorkDone.wait(guard);
+		}
+		this->Open = false;
+	}
+
+	return true;
+}
+
+
+/* Worker
+ * ------
+ * Main loop of a worker thread. Each worker keeps the transmissions of the
+ * group it simulates in its own event list.
+ */
+void ParallelEngine::Worker(void)
+{
+	EventList *List = new EventList();
+	unsigned long seen = 0;
+	unique_lock<mutex> guard(this->Lock);
+
+
+	while(true)
+	{
+		while(!this->Stop && !(this->Open && this->Round != seen))
+		{
+			this->WorkReady.wait(guard);
+		}
+		if(this->Stop)
+		{
+			break;
+		}
+		seen = this->Round;
+		this->Busy++;
+		guard.unlock();
+
+		this->RunGroups(List);
+
+		guard.lock();
+		this->Busy--;
+		if(this->Busy == 0 && this->Remaining == 0)
+		{
+			this->WorkDone.notify_all();
+		}
+	}
+
+	guard.unlock();
+	delete List;
+
+	return;
+}
+
+
+/* RunGroups
+ * ---------
+ * Simulates groups of the current time instant until no group is left.
+ */
+void ParallelEngine::RunGroups(EventList *List)
+{
+	int g;
+
+
+	MAC::setCascadeList(List);
+	while((g = this->NextGroup++) < (int) this->Groups.size())
+	{
+		this->RunGroup(this->Groups[g], List);
+
+		unique_lock<mutex> guard(this->Lock);
+		this->Remaining--;
+		if(this->Remaining == 0)
+		{
+			this->WorkDone.notify_all();
+		}
+	}
+	MAC::setCascadeList(NULL);
+
+	return;
+}
+
+
+/* RunGroup
+ * --------
+ * Simulates the events of a group. After each event, the transmissions it
+ * causes (at the same time instant) are simulated before the next event, as
+ * in the sequential simulation.
+ */
+void ParallelEngine::RunGroup(vector<int> &Events, EventList *List)
+{
+	unsigned int i;
+	Event *e;
+
+
+	for(i = 0; i < Events.size(); i++)
+	{
+		this->Sim->ProcessEvent((*this->Batch)[Events[i]], this->Reserved[Events[i]]);
+		while((e = List->GetTop()) != NULL)
+		{
+			if(this->Sim->ProcessEvent(e, NOTSET))
+			{
+				delete e;
+			}
+		}
+	}
+
+	return;
+}
@@ -0,0 +1,114 @@
+/*
+ *  Adyton: A Network Simulator for Opportunistic Networks
+ *  Copyright (C) 2015  Nikolaos Papanikos, Dimitrios-Georgios Akestoridis,
+ *  and Evangelos Papapetrou
+ *
+ *  This file is part of Adyton.
+ *
+ *  Adyton is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Adyton is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Adyton.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+#ifndef EVENT_H
+	#define EVENT_H
+	#include "Event.h"
+#endif
+
+#ifndef EVENT_LIST_H
+	#define EVENT_LIST_H
+	#include "EventList.h"
+#endif
+
+#ifndef CONNECTIONMAP_H
+	#define CONNECTIONMAP_H
+	#include "ConnectionMap.h"
+#endif
+
+#ifndef PACKETPOOL_H
+	#define PACKETPOOL_H
+	#include "PacketPool.h"
+#endif
+
+using namespace std;
+
+class Simulator;
+
+
+/* ParallelEngine
+ * --------------
+ * Simulates the events of the same time instant with multiple threads. Packets are
+ * transmitted without delay, so during a time instant a node can only reach the nodes
+ * of its connected component (the current contacts plus the contacts that come up at
+ * that instant). The events are divided into groups whose nodes belong to different
+ * components and each group is simulated by a single thread, together with all the
+ * transmissions that its events cause, in the same order as the sequential simulation.
+ * In deterministic mode, the identifiers of the generated packets are reserved in the
+ * order of the events, so the results are identical to the ones of a single thread.
+ */
+class ParallelEngine
+{
+private:
+	Simulator *Sim;
+	ConnectionMap *CMap;
+	PacketPool *Pool;
+	int NN;
+	int Threads;
+	bool Deterministic;
+
+	//Groups of nodes (union-find)
+	int *Parent;
+	int *Visited;
+	int *Group;
+	int Stamp;
+	vector<int> Touched;
+
+	//Events of the current time instant
+	vector<Event*> *Batch;
+	vector<int> Reserved;
+	vector< vector<int> > Groups;
+	EventList *Cascade;
+
+	//Worker threads
+	vector<thread> Workers;
+	mutex Lock;
+	condition_variable WorkReady;
+	condition_variable WorkDone;
+	unsigned long Round;
+	bool Open;
+	bool Stop;
+	int Busy;
+	int Remaining;
+	atomic<int> NextGroup;
+
+	void Touch(int node);
+	int Find(int node);
+	void Join(int nodeA, int nodeB);
+	bool Partition(void);
+	void Worker(void);
+	void RunGroups(EventList *List);
+	void RunGroup(vector<int> &Events, EventList *List);
+
+public:
+	ParallelEngine(Simulator *S, ConnectionMap *Map, PacketPool *P, int nodes, int threads, bool deterministic);
+	~ParallelEngine();
+	bool Run(vector<Event*> *Events);
+};
@@ -318,6 +318,7 @@ void Results::writeDetailedResults()
 	unsigned long ReplicasCreated;
 	unsigned long TotalPktsDropped;
 	unsigned long TotalPktsDied;
+	unsigned long SkippedHandshakes;
 	unsigned long sumHops;
 	char detailedFilename[256];
 	FILE *detailedResFile;
@@ -333,7 +334,7 @@ void Results::writeDetailedResults()
 			exit(EXIT_FAILURE);
 		}
 
-		fprintf(detailedResFile, "#1.SID\t2.Delivery Ratio\t3.Overhead Ratio\t4.Delivery Cost\t5.Average Number of Hops\t6.Redundancy Ratio\t7.Wastage Index\t8.Average Delay (seconds)\t9.Drop Ratio\t10.Average Replication\t11.Total Number of Forwards\t12.Total Number of Packet Drops\t13.Total Number of Packet Timeouts\t14.Total Number of Duplicates\t15.Total Number of Packets in the Traffic Sample\n");
+		fprintf(detailedResFile, "#1.SID\t2.Delivery Ratio\t3.Overhead Ratio\t4.Delivery Cost\t5.Average Number of Hops\t6.Redundancy Ratio\t7.Wastage Index\t8.Average Delay (seconds)\t9.Drop Ratio\t10.Average Replication\t11.Total Number of Forwards\t12.Total Number of Packet Drops\t13.Total Number of Packet Timeouts\t14.Total Number of Duplicates\t15.Total Number of Packets in the Traffic Sample\t16.Total Number of Skipped Handshakes\n");
 
 		if(fclose(detailedResFile) == EOF)
 		{
@@ -358,6 +359,7 @@ void Results::writeDetailedResults()
 	ReplicasCreated = 0;
 	TotalPktsDropped = 0;
 	TotalPktsDied = 0;
+	SkippedHandshakes = 0;
 	sumHops = 0;
 
 	for(i = 0; i < Set->getNN(); i++)
@@ -375,6 +377,7 @@ void Results::writeDetailedResults()
 		ReplicasCreated += (*Stats)[i]->getRepCreated();
 		TotalPktsDropped += (*Stats)[i]->getPktsDropped();
 		TotalPktsDied += (*Stats)[i]->getPktsDied();
+		SkippedHandshakes += (*Stats)[i]->getSkippedHandshakes();
 	}
 
 	if(Set->getRT() == OPTIMAL_RT)
@@ -400,7 +403,7 @@ void Results::writeDetailedResults()
 		exit(EXIT_FAILURE);
 	}
 
-	fprintf(detailedResFile, "%llu\t%f\t%f\t%f\t%f\t%f\t%f\t%f\t%f\t%f\t%lu\t%lu\t%lu\t%lu\t%d\n", this->simID, DRatio, overheadRatio, deliveryCost, avgHops, redundancyRatio, wastageIndex, avgDelay, dropRatio, avgRep, TotalForw, TotalPktsDropped, TotalPktsDied, Dups, Traffic->getTotalStatPkts());
+	fprintf(detailedResFile, "%llu\t%f\t%f\t%f\t%f\t%f\t%f\t%f\t%f\t%f\t%lu\t%lu\t%lu\t%lu\t%d\t%lu\n", this->simID, DRatio, overheadRatio, deliveryCost, avgHops, redundancyRatio, wastageIndex, avgDelay, dropRatio, avgRep, TotalForw, TotalPktsDropped, TotalPktsDied, Dups, Traffic->getTotalStatPkts(), SkippedHandshakes);
 
 	if(fclose(detailedResFile) == EOF)
 	{
@@ -707,6 +710,7 @@ void Results::printBasicRes(bool writeToFile)
 	unsigned long ReplicasCreated;
 	unsigned long TotalPktsDropped;
 	unsigned long TotalPktsDied;
+	unsigned long SkippedHandshakes;
 	unsigned long sumHops;
 
 
@@ -726,6 +730,7 @@ void Results::printBasicRes(bool writeToFile)
 	ReplicasCreated = 0;
 	TotalPktsDropped = 0;
 	TotalPktsDied = 0;
+	SkippedHandshakes = 0;
 	sumHops = 0;
 
 	for(i = 0; i < Set->getNN(); i++)
@@ -743,6 +748,7 @@ void Results::printBasicRes(bool writeToFile)
 		ReplicasCreated += (*Stats)[i]->getRepCreated();
 		TotalPktsDropped += (*Stats)[i]->getPktsDropped();
 		TotalPktsDied += (*Stats)[i]->getPktsDied();
+		SkippedHandshakes += (*Stats)[i]->getSkippedHandshakes();
 	}
 
 	if(Set->getRT() == OPTIMAL_RT)
@@ -778,6 +784,7 @@ void Results::printBasicRes(bool writeToFile)
 		printf("Total Number of Packet Drops: %lu\n", TotalPktsDropped);
 		printf("Total Number of Packet Timeouts: %lu\n", TotalPktsDied);
 		printf("Total Number of Duplicates: %lu\n", Dups);
+		printf("Total Number of Skipped Handshakes: %lu\n", SkippedHandshakes);
 	}
 	else
 	{
@@ -803,6 +810,7 @@ void Results::printBasicRes(bool writeToFile)
 		fprintf(GUIres,"Total Number of Packet Drops: %lu\n", TotalPktsDropped);
 		fprintf(GUIres,"Total Number of Packet Timeouts: %lu\n", TotalPktsDied);
 		fprintf(GUIres,"Total Number of Duplicates: %lu\n", Dups);
+		fprintf(GUIres,"Total Number of Skipped Handshakes: %lu\n", SkippedHandshakes);
 		
 		if(fclose(GUIres)==EOF)
 		{
@@ -17,32 +17,27 @@
  *
  *  You should have received a copy of the GNU General Public License
  *  along with Adyton.  If not, see <http://www.gnu.org/licenses/>.
- *
- *  Written by Dimitrios-Georgios Akestoridis.
  */
 
 
-#include <stdlib.h>
-#include <stdio.h>
+#include <mutex>
 
 using namespace std;
 
 
-class PacketRecord
+/* ServiceGuard
+ * ------------
+ * Locks the mutex of a service that is shared by all nodes (e.g., the packet
+ * pool) for the lifetime of the guard. The mutex is locked only if the service
+ * is accessed by more than one thread, so that the sequential simulation does
+ * not pay for the locking.
+ */
+class ServiceGuard
 {
 private:
-	double registrationTime;
-	double packetRTTL;
-	bool insertedPacket;
-	bool droppedPacket;
-	bool deadPacket;
-	
+	mutex *Lock;
+
 public:
-	PacketRecord(double regTime, double pktRTTL, bool insPacket, bool drpPacket, bool ddPacket);
-	~PacketRecord();
-	double getRegistrationTime();
-	double getPacketRTTL();
-	bool getInsertedPacket();
-	bool getDroppedPacket();
-	bool getDeadPacket();
+	ServiceGuard(mutex *M, bool Concurrent){this->Lock=(Concurrent)?(M):(NULL); if(this->Lock != NULL) this->Lock->lock();};
+	~ServiceGuard(){if(this->Lock != NULL) this->Lock->unlock();};
 };
@@ -27,10 +27,17 @@
 	#include "Settings.h"
 #endif
 
+#ifndef SPECIALIZATION_H
+	#define SPECIALIZATION_H
+	#include "Specialization.h"
+#endif
+
 
 Settings::Settings()
 {
 	/* Default settings */
+	this->OptimalOracle = false;
+	this->OracleThreads = 1;
 	setTraceDirectory("../trc/");
 	setContactTrace(MILANO_TR);
 	setRT(DIRECT_RT);
@@ -41,6 +48,7 @@ Settings::Settings()
 	setOUT(T1_OUT);
 	setTrafficType(UNIFORM_TT);
 	setTrafficLoad(10000);
+	setTrafficFilename("../utils/traffic-scenarios/Debugging-traffic.txt");
 	setTTL(INFINITE);
 	setBuffer(INFINITE);
 	setReplicas(1);
@@ -48,8 +56,15 @@ Settings::Settings()
 	setSeed(time(NULL));
 	setResultsDirectory("../res/");
 	setBatchmode(false);
+	setSnapshotTime(NOTSET);
+	setRestoreFilename("");
+	setThreads(1);
+	setDeterministic(true);
+	setDeliveryQueue(false);
+	setEarlyStop(true);
 
 	this->ProfileName = "none";
+	this->OptimalObjective = OPTIMIZE_DELAY;
 
 	setGUI(false);
 	this->copyMode = true;
@@ -549,35 +564,44 @@ void Settings::setRT(int Rout)
 		}
 		case OPTIMAL_RT:
 		{
+			if(this->OptimalObjective == OPTIMIZE_FORWARDS)
+			{
+				suffix = ".Forwards";
+			}
+			else
+			{
+				suffix = ".Delay";
+			}
+
+			this->RTname.assign("Optimal" + suffix);
+
+			/* The oracle computes the same statistics without flooding any replica */
+			this->OptimalOracle = false;
+			this->OracleThreads = 1;
 			if(this->ProfileExists())
 			{
-				if((profileAttribute = this->GetProfileAttribute("Optimal")) != "none")
+				if((profileAttribute = this->GetProfileAttribute("Engine")) != "none")
 				{
-					if(profileAttribute == "Delay")
+					if(profileAttribute == "Oracle")
 					{
-						suffix = ".Delay";
+						this->OptimalOracle = true;
 					}
-					else if(profileAttribute == "Forwards")
+					else if(profileAttribute != "Flood")
 					{
-						suffix = ".Forwards";
-					}
-					else
-					{
-						printf("\n[Error]: Unknown version of Optimal Routing (%s) \n\n", profileAttribute.c_str());
+						printf("\n[Error]: Unknown engine of Optimal Routing (%s) \n\n", profileAttribute.c_str());
 						exit(EXIT_FAILURE);
 					}
 				}
-				else
+
+				if((profileAttribute = this->GetProfileAttribute("OracleThreads")) != "none")
 				{
-					suffix = ".Delay";
+					if((this->OracleThreads = atoi(profileAttribute.c_str())) < 1)
+					{
+						printf("\n[Error]: Invalid number of oracle threads (%s) \n\n", profileAttribute.c_str());
+						exit(EXIT_FAILURE);
+					}
 				}
 			}
-			else
-			{
-				suffix = ".Delay";
-			}
-
-			this->RTname.assign("Optimal" + suffix);
 			break;
 		}
 		default:
@@ -715,6 +739,14 @@ void Settings::setTrafficLoad(int pkts)
 }
 
 
+void Settings::setTrafficFilename(string filename)
+{
+	this->trafficFilename = filename;
+
+	return;
+}
+
+
 void Settings::setTTL(double time)
 {
 	this->TTL = time;
@@ -755,6 +787,33 @@ void Settings::setSeed(int S)
 }
 
 
+void Settings::setSnapshotTime(double time)
+{
+	this->snapshotTime = time;
+
+	return;
+}
+
+
+void Settings::setRestoreFilename(string filename)
+{
+	this->restoreFilename = filename;
+
+	return;
+}
+
+
+string Settings::getSnapshotFilename()
+{
+	char buf[64];
+
+
+	sprintf(buf, "Snapshot_%.0f.bin", this->snapshotTime);
+
+	return this->resultsDirectory + string(buf);
+}
+
+
 void Settings::setResultsDirectory(string resDir)
 {
 	if(resDir.back() != '/')
@@ -770,6 +829,38 @@ void Settings::setResultsDirectory(string resDir)
 }
 
 
+void Settings::setThreads(int num)
+{
+	this->Threads = num;
+
+	return;
+}
+
+
+void Settings::setDeterministic(bool val)
+{
+	this->Deterministic = val;
+
+	return;
+}
+
+
+void Settings::setDeliveryQueue(bool val)
+{
+	this->DeliveryQueue = val;
+
+	return;
+}
+
+
+void Settings::setEarlyStop(bool val)
+{
+	this->EarlyStop = val;
+
+	return;
+}
+
+
 void Settings::setBatchmode(bool val)
 {
 	this->Batchmode = val;
@@ -825,6 +916,16 @@ void Settings::lastCheck()
 	}
 
 
+	#ifdef SPECIALIZED_BUILD
+	/* A specialized binary simulates only the combination it was built for (nothing is
+	 * dropped from an infinite buffer, so then the dropping policy does not matter) */
+	if((this->RT != FIXED_RT_ID) || (this->SchedulingPolicy != FIXED_SP_ID) || ((this->BufferSize != 0) && (this->DropPol != FIXED_DP_ID)))
+	{
+		printf("[Error]: This binary has been specialized for the %s routing protocol, the %s scheduling policy and the %s dropping policy (use the generic binary for other combinations)\n\n", SPECIALIZED_NAME(FIXED_RT), SPECIALIZED_NAME(FIXED_SP), SPECIALIZED_NAME(FIXED_DP));
+		exit(EXIT_FAILURE);
+	}
+	#endif
+
 	/* Check for combinations that are not supported */
 	if((this->BufferSize == 0) && (this->CongestionControlMechanism != NOCC_CC))
 	{
@@ -877,6 +978,61 @@ void Settings::lastCheck()
 				this->DM = JUSTTTL_DM;
 			}
 		}
+
+		if(this->OptimalOracle && this->TTL != INFINITE)
+		{
+			printf("[Error]: The oracle of Optimal Routing does not support packet expiration (TTL)\n\n");
+			exit(EXIT_FAILURE);
+		}
+	}
+
+	if((this->snapshotTime != NOTSET) || !this->restoreFilename.empty())
+	{
+		if(this->OptimalOracle)
+		{
+			printf("[Error]: The oracle of Optimal Routing does not support snapshots\n\n");
+			exit(EXIT_FAILURE);
+		}
+
+		if(this->outType == T5_OUT)
+		{
+			printf("[Error]: Snapshots are not supported by output type 5\n\n");
+			exit(EXIT_FAILURE);
+		}
+
+		/* Rejected here, before the simulation runs up to the snapshot time */
+		if(!this->supportsSnapshots())
+		{
+			printf("[Error]: Snapshots are not supported by this combination of routing protocol, congestion control mechanism and deletion mechanism (see `./Adyton -help SNAPSHOT')\n\n");
+			exit(EXIT_FAILURE);
+		}
+	}
+
+	if(this->Threads > 1)
+	{
+		if(this->RT == OPTIMAL_RT)
+		{
+			printf("[Error]: Optimal Routing cannot be simulated by more than one thread (the oracle has its own threads)\n\n");
+			exit(EXIT_FAILURE);
+		}
+
+		if(this->outType == T5_OUT)
+		{
+			printf("[Error]: Output type 5 cannot be produced by more than one thread\n\n");
+			exit(EXIT_FAILURE);
+		}
+
+		if(this->Deterministic && this->DM == CATACLYSM_DM)
+		{
+			printf("[Error]: The Cataclysm deletion mechanism cannot be simulated deterministically by more than one thread (use -DETERMINISTIC off)\n\n");
+			exit(EXIT_FAILURE);
+		}
+
+		if(this->DeliveryQueue)
+		{
+			printf("[Error]: The delivery queue cannot be used by more than one thread\n\n");
+			exit(EXIT_FAILURE);
+		}
 	}
 
 	//Check congestion control support
@@ -906,6 +1062,10 @@ void Settings::printSettings()
 	printf("Total Number of Active Nodes: %d\n", this->ActiveNodes);
 	printf("Duration: %f days\n", this->Duration / 86400.0);
 	printf("Routing Protocol: %s\n", this->RTname.c_str());
+	if(this->OptimalOracle)
+	{
+		printf("Routing Engine: Oracle (%d threads)\n", this->OracleThreads);
+	}
 	printf("Replicas: %d\n", this->Replicas);
 	printf("Congestion Control Mechanism: %s\n", this->CCname.c_str());
 
@@ -951,6 +1111,11 @@ void Settings::printSettings()
 
 	printf("Traffic Load: %d packets\n", this->TrafficLoad);
 
+	if(this->TrafficType == PREDEFINED_TT)
+	{
+		printf("Traffic File: \"%s\"\n", this->trafficFilename.c_str());
+	}
+
 	printf("Seed: %d\n",this->Seed);
 
 	if(this->ProfileExists())
@@ -965,6 +1130,26 @@ void Settings::printSettings()
 
 	printf("Results Directory: \"%s\"\n", this->resultsDirectory.c_str());
 
+	if(this->snapshotTime != NOTSET)
+	{
+		printf("Snapshot: \"%s\" (at %f seconds)\n", this->getSnapshotFilename().c_str(), this->snapshotTime);
+	}
+
+	if(!this->restoreFilename.empty())
+	{
+		printf("Restored From: \"%s\"\n", this->restoreFilename.c_str());
+	}
+
+	if(this->Threads > 1)
+	{
+		printf("Threads: %d (%s)\n", this->Threads, (this->Deterministic) ? "deterministic" : "non-deterministic");
+	}
+
+	if(this->DeliveryQueue)
+	{
+		printf("Delivery Queue: on\n");
+	}
+
 
 	if(this->SplitValue != -1)
 	{
@@ -1287,6 +1472,75 @@ bool Settings::isSingleCopy(void)
 }
 
 
+/* countsSkippedHandshakes
+ * -----------------------
+ * Returns true for the protocols that count the contacts in which the summary
+ * vector exchange was skipped. Their count depends on every remaining contact
+ * of the trace, so the simulation cannot stop early for them.
+ */
+bool Settings::countsSkippedHandshakes(void)
+{
+	switch(this->RT)
+	{
+		case EPIDEMIC_RT:
+		case SW_RT:
+		case MSFSW_RT:
+		case EBR_RT:
+		{
+			return true;
+		}
+		default:
+		{
+			return false;
+		}
+	}
+}
+
+
+/* supportsSnapshots
+ * -----------------
+ * Returns true if the state of the selected routing protocol, congestion control
+ * mechanism and deletion mechanism can be stored in a snapshot (see the Checkpoint
+ * methods of these modules).
+ */
+bool Settings::supportsSnapshots(void)
+{
+	switch(this->RT)
+	{
+		case SIMBET_RT:
+		case SIMBETTS_RT:
+		{
+			//the MF and MR contact aggregations (selected by a density) are not supported
+			if(this->ProfileExists() && (this->GetProfileAttribute("Density") != "none"))
+			{
+				return false;
+			}
+			break;
+		}
+		case DIRECT_RT:
+		case EPIDEMIC_RT:
+		case PROPHET_RT:
+		case BUBBLERAP_RT:
+		case SW_RT:
+		case OPTIMAL_RT:
+		{
+			break;
+		}
+		default:
+		{
+			return false;
+		}
+	}
+
+	if(this->CongestionControlMechanism != NOCC_CC)
+	{
+		return false;
+	}
+
+	return (this->DM != VACCINE_DM);
+}
+
+
 bool Settings::usesLimitedReplication(void)
 {
 	switch(this->RT)
@@ -1432,6 +1686,69 @@ void Settings::LoadProfile(string Fname)
 		printf("ERROR: could not close file %s",Fname.c_str());
 		exit(1);
 	}
+
+	compileProfile();
+	return;
+}
+
+
+/* ProfileAttributeNames
+ * ---------------------
+ * The attributes that the simulator understands. The profile is validated against this
+ * table and every lookup of an attribute must use one of these names, so a new attribute
+ * has to be added here before it can be read.
+ */
+static const char *ProfileAttributeNames[] = {"AggregationType", "Density", "DeltaFunction", "DPT", "DPT_agingTimeUnit", "DPT_beta", "DPT_delta", "DPT_gamma", "DPT_Pinit", "DPT_Pmax", "DPT_Pmin", "Engine", "familiarSetThreshold", "FixedDelta", "GodOutput", "kappa", "multi-copy", "Optimal", "OracleThreads", "TC", "UniformBuffer", "update", "Utility", NULL};
+
+
+static bool IsProfileAttribute(const string &AttributeName)
+{
+	for(int i = 0; ProfileAttributeNames[i] != NULL; i++)
+	{
+		if(AttributeName == ProfileAttributeNames[i])
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+
+/* compileProfile
+ * --------------
+ * Checks that every attribute of the loaded profile is known and stores the attributes
+ * that are consulted during the simulation as typed values, so that no string has to be
+ * searched or compared after the initialization.
+ */
+void Settings::compileProfile()
+{
+	string profileAttribute;
+	vector<ProfileAttribute>::iterator it;
+
+
+	for(it = this->ProfileAttributes.begin(); it != this->ProfileAttributes.end(); ++it)
+	{
+		if(!IsProfileAttribute(it->Attribute))
+		{
+			printf("\n[Error]: Unknown attribute \"%s\" in profile (%s)\n\n", it->Attribute.c_str(), this->ProfileName.c_str());
+			exit(EXIT_FAILURE);
+		}
+	}
+
+	this->OptimalObjective = OPTIMIZE_DELAY;
+	if((profileAttribute = this->GetProfileAttribute("Optimal")) != "none")
+	{
+		if(profileAttribute == "Forwards")
+		{
+			this->OptimalObjective = OPTIMIZE_FORWARDS;
+		}
+		else if(profileAttribute != "Delay")
+		{
+			printf("\n[Error]: Unknown version of Optimal Routing (%s) \n\n", profileAttribute.c_str());
+			exit(EXIT_FAILURE);
+		}
+	}
+
 	return;
 }
 
@@ -1441,6 +1758,11 @@ string Settings::GetProfileAttribute(string AttributeName)
 	string val="none";
 	vector<ProfileAttribute>::iterator it;
 	
+	if(!IsProfileAttribute(AttributeName))
+	{
+		printf("\n[Error]: The profile attribute \"%s\" is not in the table of known attributes (Settings.cc)\n\n", AttributeName.c_str());
+		exit(EXIT_FAILURE);
+	}
 	for(it = this->ProfileAttributes.begin() ; it != this->ProfileAttributes.end(); ++it)
 	{
 		if(it->Attribute == AttributeName)
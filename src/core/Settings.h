@@ -70,6 +70,13 @@ protected:
 	string resultsDirectory;
 	bool Batchmode;
 
+	string trafficFilename; /* predefined traffic filename + path */
+	double snapshotTime; /* time at which the state of the simulation is saved (NOTSET: never) */
+	string restoreFilename; /* snapshot to restore the simulation from (empty: start from the beginning) */
+	int Threads; /* threads that process the independent events of the same time instant */
+	bool Deterministic; /* reproduce the results of the sequential simulation */
+	bool DeliveryQueue; /* deliver the transmissions of the current time instant without the event list */
+	bool EarlyStop; /* stop the simulation once no packet can change state */
 	string ProfileName; /* profile filename + path */
 	vector<ProfileAttribute> ProfileAttributes; /* Holds the names of the extra attributes (for the protocol) */
 	vector<string> ProfileValues; /* Holds the values of the extra attributes (for the protocol)*/
@@ -87,12 +94,16 @@ protected:
 	double scanningInterval;
 
 	string RTname;
+	int OptimalObjective; /* what Optimal Routing optimizes (parsed once from the profile) */
+	bool OptimalOracle; /* compute Optimal Routing with the oracle instead of a flood */
+	int OracleThreads;
 
 	string CCname;
 	bool bufferInfoSupport;
 	string processingTime;
 	
 	int askToImportTrace();
+	void compileProfile();
 
 public:
 	Settings();
@@ -108,6 +119,7 @@ public:
 	void setOUT(int OUTval);
 	void setTrafficType(int type);
 	void setTrafficLoad(int pkts);
+	void setTrafficFilename(string filename);
 	void setTTL(double time);
 	void setBuffer(int Buf);
 	void setReplicas(int Rep);
@@ -115,6 +127,12 @@ public:
 	void setSeed(int S);
 	void setResultsDirectory(string resDir);
 	void setBatchmode(bool val);
+	void setSnapshotTime(double time);
+	void setRestoreFilename(string filename);
+	void setThreads(int num);
+	void setDeterministic(bool val);
+	void setDeliveryQueue(bool val);
+	void setEarlyStop(bool val);
 	void lastCheck();
 
 	void setGUI(bool status){this->GUI=status;};
@@ -129,6 +147,7 @@ public:
 	int getOUT(){return this->outType;};
 	int getTrafficType(){return this->TrafficType;};
 	int getTrafficLoad(){return this->TrafficLoad;};
+	string getTrafficFilename(){return this->trafficFilename;};
 	double getTTL(){return this->TTL;};
 	int getBuffer(){return this->BufferSize;};
 	int getReplicas(){return this->Replicas;};
@@ -138,6 +157,13 @@ public:
 	string getResultsDirectory(){return this->resultsDirectory;};
 	string getTraceDirectory(){return this->traceDirectory;};
 	bool getBatchmode(){return this->Batchmode;};
+	double getSnapshotTime(){return this->snapshotTime;};
+	string getRestoreFilename(){return this->restoreFilename;};
+	string getSnapshotFilename();
+	int getThreads(){return this->Threads;};
+	bool isDeterministic(){return this->Deterministic;};
+	bool useDeliveryQueue(){return this->DeliveryQueue;};
+	bool useEarlyStop(){return this->EarlyStop;};
 
 	void printSettings();
 
@@ -162,7 +188,12 @@ public:
 	double getScanningInterval(void){return this->scanningInterval;};
 	bool isSingleCopy(void);
 	bool usesLimitedReplication(void);
+	bool countsSkippedHandshakes(void);
+	bool supportsSnapshots(void);
 	bool needsBufferInformation(void){return this->bufferInfoSupport;};
 	bool GUIon(void){return this->GUI;};
 	bool getCopyMode(void){return this->copyMode;};
+	int getOptimalObjective(void){return this->OptimalObjective;};
+	bool useOracle(void){return this->OptimalOracle;};
+	int getOracleThreads(void){return this->OracleThreads;};
 };
@@ -40,16 +40,26 @@ Simulator::Simulator(Settings *S)
 	CurrentTime=0.0;
 	//create God
 	SimGod=new God(Set);
-	//create the packet pool
-	Pool=new PacketPool(Set->getTrafficLoad());
 	//create a new event list
 	SimList=new EventList();
 	//create the traffic generator
 	Traffic = new TrafficGen(Set->getSeed(), Set->getNN(), Set->getTraceDuration(), Set->getPresenceFilename(), SimList);
+	//create the packet pool (large enough for all the packets of a predefined traffic file)
+	int poolSize=Set->getTrafficLoad();
+	if(Set->getTrafficType() == PREDEFINED_TT)
+	{
+		Traffic->OpenTrafficFile(Set->getTrafficFilename());
+		if(Traffic->getFilePackets() > poolSize)
+		{
+			poolSize=(int)Traffic->getFilePackets();
+		}
+	}
+	Pool=new PacketPool(poolSize);
 	//create a new Connection Map
 	CMap=new ConnectionMap(Set->getNN());
 	//create a new mac layer (ideal)
 	MAClayer=new Ideal(2,SimList,CMap);
+	MAClayer->setDeliveryQueue(Set->useDeliveryQueue());
 	//create Nodelist
 	Node *tmp=NULL;
 	Statistics *st=NULL;
@@ -68,6 +78,26 @@ Simulator::Simulator(Settings *S)
 	SimGod->setSimulationNodes(&Nodes);
 	
 	Res=new Results(&Stats,&Nodes,S,SimGod,Traffic);
+	//create the oracle that replaces the flood of Optimal Routing
+	if(Set->getRT() == OPTIMAL_RT && Set->useOracle())
+	{
+		Orc=new Oracle(Set->getNN(),SimGod->optimizeForwards(),Set->getOracleThreads());
+	}
+	else
+	{
+		Orc=NULL;
+	}
+	//create the engine that simulates the independent events of a time instant in parallel
+	if(Set->getThreads() > 1)
+	{
+		Engine=new ParallelEngine(this,CMap,Pool,Set->getNN(),Set->getThreads(),Set->isDeterministic());
+		Pool->setConcurrent(true);
+		SimGod->setConcurrent(true);
+	}
+	else
+	{
+		Engine=NULL;
+	}
 	//set attributes for partial trace reading
 	if(S->getSplit() != -1)
 	{
@@ -77,15 +107,25 @@ Simulator::Simulator(Settings *S)
 	}
 	else
 	{
+		this->CurrentReadBlock=0;
 		this->NumberReadBlocks=0;
 		this->ReadBlockSize=0;
 	}
+	//a snapshot is saved once, just before the first event at or after the requested time
+	this->SnapshotPending=(S->getSnapshotTime() != NOTSET);
+	//the time series of output type 5, the oracle, the skipped handshakes and a snapshot need the complete trace
+	this->StopWhenQuiescent=(S->useEarlyStop() && S->getOUT() != T5_OUT && Orc == NULL && !S->countsSkippedHandshakes() && !this->SnapshotPending);
+	this->StoppedAt=NOTSET;
 	return;
 }
 
 
 Simulator::~Simulator()
 {
+	if(Engine != NULL)
+	{
+		delete Engine;
+	}
 	delete SimGod;
 	delete Pool;
 	delete SimList;
@@ -93,6 +133,10 @@ Simulator::~Simulator()
 	delete MAClayer;
 	delete Res;
 	delete Traffic;
+	if(Orc != NULL)
+	{
+		delete Orc;
+	}
 
 	for(int i=0;i<Set->getNN();i++)
 	{
@@ -109,14 +153,21 @@ Simulator::~Simulator()
 /* performSimulation
  * -----------------
  * Writes the simulation settings, loads the traffic scenario and the contacts
- * of the trace, and then starts the simulation.
+ * of the trace (or the state of a snapshot), and then starts the simulation.
  */
 void Simulator::performSimulation()
 {
 	Res->writeSimulationSettings();
 
 	this->LoadTraffic();
-	this->LoadContacts();
+	if(Set->getRestoreFilename().empty())
+	{
+		this->LoadContacts();
+	}
+	else
+	{
+		this->RestoreSnapshot();
+	}
 
 	this->startSimulation();
 
@@ -130,8 +181,7 @@ void Simulator::performSimulation()
  */
 void Simulator::startSimulation()
 {
-	Event *e=SimList->GetTop();
-	Node *Current=NULL;
+	Event *e=NextEvent();
 
 	if(!Set->GUIon())
 	{
@@ -143,6 +193,10 @@ void Simulator::startSimulation()
 
 	while(e != NULL)
 	{
+		if(this->SnapshotPending && e->getEventTime() >= Set->getSnapshotTime())
+		{
+			this->SaveSnapshot(e);
+		}
 		if(Set->getOUT() == T5_OUT)
 		{
 			Res->updateAll(e->getEventTime());
@@ -152,71 +206,35 @@ void Simulator::startSimulation()
 		//Inform God about the new Simulation Time
 		this->SimGod->setSimTime(this->CurrentTime);
 		//printf("Sim Time:%f\n",this->CurrentTime);
-		if(e->getEventID() == 1)
-		{//Contact up
-			//Check if already connected
-			bool oldstateA=this->CMap->AreConnected(((ContactUp *)e)->getNodeA(),((ContactUp *)e)->getNodeB());
-			//bool oldstateB=this->CMap->AreConnected(((ContactUp *)e)->getNodeB(),((ContactUp *)e)->getNodeA());
-			//Inform Connection Map
-			this->CMap->SetConnection(((ContactUp *)e)->getNodeA(),((ContactUp *)e)->getNodeB());
-			//bidirectional
-			this->CMap->SetConnection(((ContactUp *)e)->getNodeB(),((ContactUp *)e)->getNodeA());
-			#ifdef SIMULATOR_DEBUG
-			//print connections
-			this->CMap->PrintConnections(((ContactUp *)e)->getNodeA());
-			this->CMap->PrintConnections(((ContactUp *)e)->getNodeB());
-			#endif
-			//Inform Node
-			Current=Nodes[((ContactUp *)e)->getNodeA()];
-			Current->ConUpdate(this->CurrentTime,((ContactUp *)e)->getNodeB(),true,oldstateA);
-		}
-		else if(e->getEventID() == 3)
-		{//Contact down
-			//Inform Connection Map
-			this->CMap->UnSetConnection(((ContactDown *)e)->getNodeA(),((ContactDown *)e)->getNodeB());
-			//bidirectional
-			this->CMap->UnSetConnection(((ContactDown *)e)->getNodeB(),((ContactDown *)e)->getNodeA());
-			#ifdef SIMULATOR_DEBUG
-			//print connections
-			this->CMap->PrintConnections(((ContactDown *)e)->getNodeA());
-			this->CMap->PrintConnections(((ContactDown *)e)->getNodeB());
-			#endif
-			//Inform Node
-			Current=Nodes[((ContactDown *)e)->getNodeA()];
-			Current->ConUpdate(this->CurrentTime,((ContactDown *)e)->getNodeB(),false,false);
-		}
-		else if(e->getEventID() == 2)
-		{//Transmission
-			#ifdef SIMULATOR_DEBUG
-			printf("%f:Transmission event Sender:%d Receiver:%d packet id:%d\n",this->CurrentTime,((Transmission *)e)->getSender(),((Transmission *)e)->getReceiver(),((Transmission *)e)->getpktID());
-			#endif
-			Current=Nodes[((Transmission *)e)->getReceiver()];
-			if(((Transmission *)e)->getSender() == APPLICATION)
-			{//The packet comes from application layer
-				//The packet ID holds information about final destination of the packet
-				//Note: This is done only for application layer packets
-				Current->recvFromApp(this->CurrentTime,((Transmission *)e)->getpktID());
-			}
-			else
-			{//Normal packet transmission
-				if(Check((Transmission *)e))
-				{
-					Current->recv(((Transmission *)e)->getpktID(),this->CurrentTime);
-				}
-			}
+		if(Orc != NULL)
+		{//Only record the contacts and the packets for the oracle
+			OracleEvent(e);
+		}
+		else if(Engine != NULL)
+		{//Simulate all the events of this time instant
+			ProcessInstant(e);
 		}
 		else
 		{
-			#ifdef SIMULATOR_DEBUG
-			printf("Continue loading trace file into memory..\n");
-			#endif
-			//printf("Check Point Reached. Have to continue uploading from line %d\n",((CheckPoint *)e)->GetLine());
-			//SimList->PrintList();
-			//printf("---------------\n");
-			this->LoadPartialContacts();
+			if(!ProcessEvent(e,NOTSET))
+			{//The event has been put back to the list
+				e=NextEvent();
+				continue;
+			}
+			DeliverQueued();
 		}
 		delete e;
-		e=SimList->GetTop();
+		if(this->StopWhenQuiescent && this->Quiescent())
+		{
+			this->StoppedAt=this->CurrentTime;
+			break;
+		}
+		e=NextEvent();
+	}
+
+	if(Orc != NULL)
+	{
+		Orc->Compute(&Stats);
 	}
 
 	for(int i=0;i<Set->getNN();i++)
@@ -239,6 +257,14 @@ void Simulator::startSimulation()
 		}
 		else
 		{
+			if(this->StoppedAt != NOTSET)
+			{
+				if(this->CurrentReadBlock < this->NumberReadBlocks)
+				{//the progress line of the trace loading is still open
+					printf("\n");
+				}
+				printf("\nNo packet can change state after %f seconds (the remaining contacts were not simulated)\n", this->StoppedAt);
+			}
 			Res->printBasicRes(false);
 			printf("\nSimulation Ended!\n");
 			fflush(stdout);
@@ -253,6 +279,185 @@ void Simulator::startSimulation()
 }
 
 
+/* ProcessEvent
+ * ------------
+ * Simulates a single event. Application layer transmissions create a packet
+ * with the identifier "pktID" if one has been reserved for it (otherwise NOTSET).
+ * Returns false if the event has been put back to the event list, so it must not
+ * be deleted yet (a broadcast with receivers that are still to be served).
+ */
+bool Simulator::ProcessEvent(Event *e, int pktID)
+{
+	Node *Current=NULL;
+	bool done=true;
+
+
+	if(e->getEventID() == 1)
+	{//Contact up
+		//Check if already connected
+		bool oldstateA=this->CMap->AreConnected(((ContactUp *)e)->getNodeA(),((ContactUp *)e)->getNodeB());
+		//bool oldstateB=this->CMap->AreConnected(((ContactUp *)e)->getNodeB(),((ContactUp *)e)->getNodeA());
+		//Inform Connection Map
+		this->CMap->SetConnection(((ContactUp *)e)->getNodeA(),((ContactUp *)e)->getNodeB());
+		//bidirectional
+		this->CMap->SetConnection(((ContactUp *)e)->getNodeB(),((ContactUp *)e)->getNodeA());
+		#ifdef SIMULATOR_DEBUG
+		//print connections
+		this->CMap->PrintConnections(((ContactUp *)e)->getNodeA());
+		this->CMap->PrintConnections(((ContactUp *)e)->getNodeB());
+		#endif
+		//Inform Node
+		Current=Nodes[((ContactUp *)e)->getNodeA()];
+		Current->ConUpdate(this->CurrentTime,((ContactUp *)e)->getNodeB(),true,oldstateA);
+	}
+	else if(e->getEventID() == 3)
+	{//Contact down
+		//Inform Connection Map
+		this->CMap->UnSetConnection(((ContactDown *)e)->getNodeA(),((ContactDown *)e)->getNodeB());
+		//bidirectional
+		this->CMap->UnSetConnection(((ContactDown *)e)->getNodeB(),((ContactDown *)e)->getNodeA());
+		#ifdef SIMULATOR_DEBUG
+		//print connections
+		this->CMap->PrintConnections(((ContactDown *)e)->getNodeA());
+		this->CMap->PrintConnections(((ContactDown *)e)->getNodeB());
+		#endif
+		//Inform Node
+		Current=Nodes[((ContactDown *)e)->getNodeA()];
+		Current->ConUpdate(this->CurrentTime,((ContactDown *)e)->getNodeB(),false,false);
+	}
+	else if(e->getEventID() == 2)
+	{//Transmission
+		#ifdef SIMULATOR_DEBUG
+		printf("%f:Transmission event Sender:%d Receiver:%d packet id:%d\n",this->CurrentTime,((Transmission *)e)->getSender(),((Transmission *)e)->getReceiver(),((Transmission *)e)->getpktID());
+		#endif
+		Current=Nodes[((Transmission *)e)->getReceiver()];
+		if(((Transmission *)e)->getSender() == APPLICATION)
+		{//The packet comes from application layer
+			//The packet ID holds information about final destination of the packet
+			//Note: This is done only for application layer packets
+			Current->recvFromApp(this->CurrentTime,((Transmission *)e)->getpktID(),pktID);
+		}
+		else
+		{//Normal packet transmission
+			if(Check((Transmission *)e))
+			{
+				Current->recv(((Transmission *)e)->getpktID(),this->CurrentTime);
+			}
+		}
+	}
+	else if(e->getEventID() == 5)
+	{//Broadcast
+		Broadcast *b=(Broadcast *)e;
+		int Receiver=b->NextReceiver();
+		#ifdef SIMULATOR_DEBUG
+		printf("%f:Transmission event Sender:%d Receiver:%d packet id:%d\n",this->CurrentTime,b->getSender(),Receiver,b->getpktID());
+		#endif
+		if(b->hasReceivers())
+		{//The events caused by this reception come before the remaining receivers
+			MAClayer->TargetList()->InsertEvent(b);
+			done=false;
+		}
+		if(CMap->AreConnected(b->getSender(),Receiver))
+		{
+			Nodes[Receiver]->recv(b->getpktID(),this->CurrentTime);
+		}
+	}
+	else
+	{
+		#ifdef SIMULATOR_DEBUG
+		printf("Continue loading trace file into memory..\n");
+		#endif
+		//printf("Check Point Reached. Have to continue uploading from line %d\n",((CheckPoint *)e)->GetLine());
+		//SimList->PrintList();
+		//printf("---------------\n");
+		this->LoadPartialContacts();
+	}
+
+	return done;
+}
+
+
+/* ProcessInstant
+ * --------------
+ * Simulates all the events of the time instant of event "first" with the
+ * parallel engine. If the events cannot be simulated in parallel, they are
+ * simulated one after the other, each one followed by the transmissions it
+ * causes, exactly as in the sequential simulation.
+ */
+void Simulator::ProcessInstant(Event *first)
+{
+	vector<Event*> Batch;
+	Event *e;
+
+
+	Batch.push_back(first);
+	while(SimList->PeekTop() != NULL && SimList->PeekTop()->getEventTime() == first->getEventTime())
+	{
+		Batch.push_back(SimList->GetTop());
+	}
+
+	if(!Engine->Run(&Batch))
+	{
+		for(unsigned int i=0;i<Batch.size();i++)
+		{
+			ProcessEvent(Batch[i],NOTSET);
+			//the events of this instant that are now in the list were caused by this event
+			while(SimList->PeekTop() != NULL && SimList->PeekTop()->getEventTime() == first->getEventTime())
+			{
+				e=SimList->GetTop();
+				if(ProcessEvent(e,NOTSET))
+				{
+					delete e;
+				}
+			}
+		}
+	}
+
+	for(unsigned int i=1;i<Batch.size();i++)
+	{
+		delete Batch[i];
+	}
+
+	return;
+}
+
+
+/* OracleEvent
+ * -----------
+ * Handles an event when the oracle computes the statistics of Optimal Routing.
+ * Contacts are recorded in the order they are processed, while packets that come
+ * from the application layer are registered without being created.
+ */
+void Simulator::OracleEvent(Event *e)
+{
+	int Source;
+	int Dest;
+	int pktID;
+
+
+	if(e->getEventID() == 1)
+	{//Contact up
+		Orc->ContactUp(this->CurrentTime,((ContactUp *)e)->getNodeA(),((ContactUp *)e)->getNodeB());
+	}
+	else if(e->getEventID() == 2)
+	{//Transmission (only the application layer transmits)
+		if(((Transmission *)e)->getSender() == APPLICATION)
+		{
+			Source=((Transmission *)e)->getReceiver();
+			Dest=((Transmission *)e)->getpktID();
+			pktID=Orc->AddPacket(this->CurrentTime,Source,Dest,!Stats[Dest]->isBackgroundTraffic(this->CurrentTime));
+			Stats[Source]->pktGen(pktID,Source,Dest,this->CurrentTime);
+		}
+	}
+	else if(e->getEventID() != 3)
+	{
+		this->LoadPartialContacts();
+	}
+
+	return;
+}
+
+
 /* LoadContacts
  * ------------
  * Loads contacts from disk. If the split method is enabled, then 
@@ -573,6 +778,240 @@ void Simulator::LoadTraffic()
 }
 
 
+/* NextEvent
+ * ---------
+ * Returns the next event of the simulation. Application events are handed to the
+ * event list by the traffic generator just before they are due.
+ */
+Event *Simulator::NextEvent(void)
+{
+	while(Traffic->hasPendingTraffic() && (SimList->PeekTop() == NULL || SimList->PeekTop()->getEventTime() >= Traffic->nextTrafficTime()))
+	{
+		Traffic->ReleaseTraffic();
+	}
+
+	return SimList->GetTop();
+}
+
+
+/* SaveSnapshot
+ * ------------
+ * Saves the state of the simulation just before the given event is processed.
+ * The simulation continues normally afterwards.
+ */
+void Simulator::SaveSnapshot(Event *next)
+{
+	Snapshot *snap=new Snapshot(Set->getSnapshotFilename(),true);
+
+	if(!Set->getBatchmode() && !Set->GUIon())
+	{
+		printf("\nSaving snapshot to \"%s\"... ",snap->getFilename().c_str());
+		fflush(stdout);
+	}
+
+	this->Checkpoint(snap,next);
+	delete snap;
+	this->SnapshotPending=false;
+
+	if(!Set->getBatchmode() && !Set->GUIon())
+	{
+		printf("Done!\n");
+		fflush(stdout);
+	}
+
+	return;
+}
+
+
+/* RestoreSnapshot
+ * ---------------
+ * Replaces the loading of the contacts: the event list and the state of every
+ * module are restored from the snapshot, so the simulation resumes from the
+ * point it was saved.
+ */
+void Simulator::RestoreSnapshot(void)
+{
+	Snapshot *snap=new Snapshot(Set->getRestoreFilename(),false);
+
+	if(!Set->getBatchmode() && !Set->GUIon())
+	{
+		printf("Restoring snapshot \"%s\"... ",snap->getFilename().c_str());
+		fflush(stdout);
+	}
+
+	this->Checkpoint(snap,NULL);
+	delete snap;
+
+	if(!Set->getBatchmode() && !Set->GUIon())
+	{
+		printf("Done!\nStarting Simulation...\n");
+		fflush(stdout);
+	}
+
+	return;
+}
+
+
+/* Checkpoint
+ * ----------
+ * Saves or restores the complete state of the simulation. The settings that shape
+ * the simulated scenario must be the same as the ones of the saved simulation. The
+ * packets of the application layer are not saved: the restored simulation generates
+ * the same traffic and skips the packets that were created before the snapshot.
+ */
+void Simulator::Checkpoint(Snapshot *snap, Event *next)
+{
+	double resumeTime;
+
+
+	snap->Section("SIM ");
+	snap->Match(Set->getNN(),"number of nodes");
+	snap->Match(Set->getContactTrace(),"contact trace");
+	snap->Match(Set->getRT(),"routing protocol");
+	snap->Match(Set->getCongestionControl(),"congestion control mechanism");
+	snap->Match(Set->getSchedulingPolicy(),"scheduling policy");
+	snap->Match(Set->getDroppingPolicy(),"dropping policy");
+	snap->Match(Set->getDM(),"deletion mechanism");
+	snap->Match(Set->getTrafficType(),"traffic type");
+	snap->Match(Set->getTrafficLoad(),"traffic load");
+	snap->Match(Set->getTTL(),"TTL");
+	snap->Match(Set->getBuffer(),"buffer size");
+	snap->Match(Set->getReplicas(),"replication number");
+	snap->Match((int)Set->getSplit(),"number of pieces of the contact trace");
+	snap->Match(Set->getSeed(),"seed");
+	if(Set->getTrafficType() == PREDEFINED_TT)
+	{
+		snap->Match(Set->getTrafficFilename(),"traffic file");
+	}
+
+	resumeTime=(next != NULL)?(next->getEventTime()):(0.0);
+	snap->Value(this->CurrentTime);
+	snap->Value(resumeTime);
+	snap->Value(this->CurrentReadBlock);
+
+	this->CheckpointEvents(snap,next);
+	this->CMap->Checkpoint(snap);
+	this->Pool->Checkpoint(snap);
+	this->SimGod->Checkpoint(snap);
+	for(int i=0;i<Set->getNN();i++)
+	{
+		Stats[i]->Checkpoint(snap);
+		Nodes[i]->Checkpoint(snap);
+	}
+
+	if(snap->isRestoring())
+	{
+		Traffic->SkipTraffic(resumeTime);
+		SimGod->setSimTime(this->CurrentTime);
+	}
+
+	return;
+}
+
+
+/* CheckpointEvents
+ * ----------------
+ * Saves or restores the event list (including the event that is about to be processed).
+ * At the time of a snapshot only contact events, trace loading events and application
+ * events can be pending, since transmissions are delivered immediately. Application
+ * events are regenerated by the traffic generator.
+ */
+void Simulator::CheckpointEvents(Snapshot *snap, Event *next)
+{
+	int num;
+	int ID;
+	int A;
+	int B;
+	double Time;
+	Event *runner;
+	vector<Event *> Pending;
+
+
+	if(snap->isSaving())
+	{
+		for(runner=next;runner != NULL;runner=(runner == next)?(SimList->PeekTop()):(runner->Next))
+		{
+			if(runner->getEventID() == 2)
+			{
+				if(((Transmission *)runner)->getSender() != APPLICATION)
+				{
+					snap->Unsupported("pending packet transmissions");
+				}
+				continue;
+			}
+			if(runner->getEventID() == 5)
+			{
+				snap->Unsupported("pending packet transmissions");
+			}
+			Pending.push_back(runner);
+		}
+	}
+
+	snap->Section("EVNT");
+	num=(int)Pending.size();
+	snap->Value(num);
+	for(int i=0;i<num;i++)
+	{
+		if(snap->isSaving())
+		{
+			ID=Pending[i]->getEventID();
+			Time=Pending[i]->getEventTime();
+			if(ID == 4)
+			{
+				A=((CheckPoint *)Pending[i])->GetLine();
+				B=A;
+			}
+			else
+			{
+				A=Pending[i]->getNodeA();
+				B=Pending[i]->getNodeB();
+			}
+		}
+		snap->Value(ID);
+		snap->Value(Time);
+		snap->Value(A);
+		snap->Value(B);
+		if(snap->isRestoring())
+		{
+			switch(ID)
+			{
+				case 1:
+				{
+					Pending.push_back(new ContactUp(Time,A,B));
+					break;
+				}
+				case 3:
+				{
+					Pending.push_back(new ContactDown(Time,A,B));
+					break;
+				}
+				case 4:
+				{
+					Pending.push_back(new CheckPoint(Time,A,B));
+					break;
+				}
+				default:
+				{
+					printf("\n[Error]: The snapshot contains an unknown event type (%d)\n\n",ID);
+					exit(EXIT_FAILURE);
+				}
+			}
+		}
+	}
+
+	if(snap->isRestoring())
+	{
+		//events are inserted before the ones with the same time, so insert them backwards
+		for(int i=num-1;i >= 0;i--)
+		{
+			SimList->InsertEvent(Pending[i]);
+		}
+	}
+
+	return;
+}
+
+
 /* Check
  * -----
  * This method checks if the transmission is still valid. For example a reception event may be
@@ -582,3 +1021,46 @@ bool Simulator::Check(Transmission* trans)
 {
 	return CMap->AreConnected(trans->getSender(),trans->getReceiver());
 }
+
+/* Quiescent
+ * ---------
+ * Returns true if no packet can change state anymore: all the packets of the traffic
+ * have been created, no node stores a packet replica and no transmission of the
+ * current time instant is pending, so the remaining contacts cannot affect the results.
+ */
+bool Simulator::Quiescent(void)
+{
+	if(Traffic->hasPendingTraffic() || this->CurrentTime <= Traffic->getLastReleaseTime())
+	{//application events are still pending
+		return false;
+	}
+	if(SimList->PeekTop() != NULL && SimList->PeekTop()->getEventTime() <= this->CurrentTime)
+	{//a forwarded packet may still be in flight
+		return false;
+	}
+	return (SimGod->getNumReplicas() == 0);
+}
+
+/* DeliverQueued
+ * -------------
+ * Delivers the transmissions that the MAC layer kept in its delivery queue, including
+ * the ones caused by these deliveries, before the next event of the list is processed.
+ */
+void Simulator::DeliverQueued(void)
+{
+	struct Delivery d;
+
+
+	while(MAClayer->NextDelivery(&d))
+	{
+		#ifdef SIMULATOR_DEBUG
+		printf("%f:Transmission event Sender:%d Receiver:%d packet id:%d\n",this->CurrentTime,d.Sender,d.Receiver,d.pktID);
+		#endif
+		if(CMap->AreConnected(d.Sender,d.Receiver))
+		{
+			Nodes[d.Receiver]->recv(d.pktID,this->CurrentTime);
+		}
+	}
+
+	return;
+}
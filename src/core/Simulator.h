@@ -47,6 +47,11 @@
 	#include "EventList.h"
 #endif
 
+#ifndef SNAPSHOT_H
+	#define SNAPSHOT_H
+	#include "Snapshot.h"
+#endif
+
 #ifndef MAC_H
 	#define MAC_H
 	#include "MAC.h"
@@ -82,6 +87,16 @@
 	#include "Results.h"
 #endif
 
+#ifndef ORACLE_H
+	#define ORACLE_H
+	#include "Oracle.h"
+#endif
+
+#ifndef PARALLELENGINE_H
+	#define PARALLELENGINE_H
+	#include "ParallelEngine.h"
+#endif
+
 /* Simulator
  * --------
  * The basic class of Simulation.
@@ -90,6 +105,11 @@ class Simulator
 {
 private:
 	TrafficGen *Traffic;
+	Oracle *Orc;
+	ParallelEngine *Engine;
+	bool SnapshotPending;
+	bool StopWhenQuiescent;
+	double StoppedAt;
 
 public:
 	ConnectionMap *CMap;
@@ -116,5 +136,15 @@ public:
 	void LoadCompleteContacts();
 	void LoadPartialContacts();
 	void LoadTraffic();
+	Event *NextEvent(void);
+	void OracleEvent(Event *e);
+	bool ProcessEvent(Event *e, int pktID);
+	void ProcessInstant(Event *first);
 	bool Check(Transmission *trans);
+	void DeliverQueued(void);
+	bool Quiescent(void);
+	void SaveSnapshot(Event *next);
+	void RestoreSnapshot(void);
+	void Checkpoint(Snapshot *snap, Event *next);
+	void CheckpointEvents(Snapshot *snap, Event *next);
 };
@@ -0,0 +1,339 @@
+/*
+ *  Adyton: A Network Simulator for Opportunistic Networks
+ *  Copyright (C) 2015  Nikolaos Papanikos, Dimitrios-Georgios Akestoridis,
+ *  and Evangelos Papapetrou
+ *
+ *  This file is part of Adyton.
+ *
+ *  Adyton is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Adyton is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Adyton.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef SNAPSHOT_H
+	#define SNAPSHOT_H
+	#include "Snapshot.h"
+#endif
+
+
+Snapshot::Snapshot(string Fname, bool save)
+{
+	char magic[SNAPSHOT_MAGIC_SIZE];
+
+
+	this->Filename = Fname;
+	this->Saving = save;
+
+	if((this->fp = fopen(Fname.c_str(), (save)?("wb"):("rb"))) == NULL)
+	{
+		printf("\n[Error]: Could not open the snapshot file \"%s\"\n\n", Fname.c_str());
+		exit(EXIT_FAILURE);
+	}
+
+	if(save)
+	{
+		memcpy(magic, SNAPSHOT_MAGIC, SNAPSHOT_MAGIC_SIZE);
+	}
+	Transfer(magic, SNAPSHOT_MAGIC_SIZE);
+
+	if(memcmp(magic, SNAPSHOT_MAGIC, SNAPSHOT_MAGIC_SIZE) != 0)
+	{
+		printf("\n[Error]: The file \"%s\" is not an Adyton snapshot\n\n", Fname.c_str());
+		exit(EXIT_FAILURE);
+	}
+
+	return;
+}
+
+
+Snapshot::~Snapshot()
+{
+	if(fclose(this->fp) == EOF)
+	{
+		printf("\n[Error]: Could not close the snapshot file \"%s\"\n\n", this->Filename.c_str());
+		exit(EXIT_FAILURE);
+	}
+
+	return;
+}
+
+
+void Snapshot::Transfer(void *data, size_t size)
+{
+	if(size == 0)
+	{
+		return;
+	}
+
+	if(this->Saving)
+	{
+		if(fwrite(data, size, 1, this->fp) != 1)
+		{
+			printf("\n[Error]: Could not write to the snapshot file \"%s\"\n\n", this->Filename.c_str());
+			exit(EXIT_FAILURE);
+		}
+	}
+	else
+	{
+		if(fread(data, size, 1, this->fp) != 1)
+		{
+			printf("\n[Error]: The snapshot file \"%s\" is truncated\n\n", this->Filename.c_str());
+			exit(EXIT_FAILURE);
+		}
+	}
+
+	return;
+}
+
+
+/* Section
+ * -------
+ * Marks the start of the state of a module with a (4-character) tag.
+ */
+void Snapshot::Section(const char *tag)
+{
+	char buf[4];
+
+
+	memcpy(buf, tag, 4);
+	Transfer(buf, 4);
+
+	if(memcmp(buf, tag, 4) != 0)
+	{
+		printf("\n[Error]: The snapshot file \"%s\" does not match the simulated modules (expected section %.4s, found %.4s)\n\n", this->Filename.c_str(), tag, buf);
+		exit(EXIT_FAILURE);
+	}
+
+	return;
+}
+
+
+/* Match
+ * -----
+ * Stores a setting, or checks that the stored value agrees with the current one.
+ */
+void Snapshot::Match(int current, const char *what)
+{
+	int stored;
+
+
+	stored = current;
+	Value(stored);
+
+	if(stored != current)
+	{
+		printf("\n[Error]: The snapshot was taken with a different %s (%d instead of %d)\n\n", what, stored, current);
+		exit(EXIT_FAILURE);
+	}
+
+	return;
+}
+
+
+void Snapshot::Match(double current, const char *what)
+{
+	double stored;
+
+
+	stored = current;
+	Value(stored);
+
+	if(stored != current)
+	{
+		printf("\n[Error]: The snapshot was taken with a different %s (%f instead of %f)\n\n", what, stored, current);
+		exit(EXIT_FAILURE);
+	}
+
+	return;
+}
+
+
+void Snapshot::Match(string current, const char *what)
+{
+	string stored;
+
+
+	stored = current;
+	Value(stored);
+
+	if(stored != current)
+	{
+		printf("\n[Error]: The snapshot was taken with a different %s (%s instead of %s)\n\n", what, stored.c_str(), current.c_str());
+		exit(EXIT_FAILURE);
+	}
+
+	return;
+}
+
+
+/* Unsupported
+ * -----------
+ * Called by the modules whose state cannot be stored in a snapshot yet. An
+ * incomplete snapshot is not left behind.
+ */
+void Snapshot::Unsupported(const char *what)
+{
+	printf("\n[Error]: Snapshots are not supported by %s\n\n", what);
+
+	if(this->Saving)
+	{
+		fclose(this->fp);
+		remove(this->Filename.c_str());
+	}
+
+	exit(EXIT_FAILURE);
+}
+
+
+void Snapshot::Value(int &v)
+{
+	Transfer(&v, sizeof(int));
+	return;
+}
+
+
+void Snapshot::Value(unsigned int &v)
+{
+	Transfer(&v, sizeof(unsigned int));
+	return;
+}
+
+
+void Snapshot::Value(long int &v)
+{
+	Transfer(&v, sizeof(long int));
+	return;
+}
+
+
+void Snapshot::Value(unsigned long &v)
+{
+	Transfer(&v, sizeof(unsigned long));
+	return;
+}
+
+
+void Snapshot::Value(double &v)
+{
+	Transfer(&v, sizeof(double));
+	return;
+}
+
+
+void Snapshot::Value(long double &v)
+{
+	Transfer(&v, sizeof(long double));
+	return;
+}
+
+
+void Snapshot::Value(bool &v)
+{
+	Transfer(&v, sizeof(bool));
+	return;
+}
+
+
+void Snapshot::Value(string &v)
+{
+	int len;
+	char *buf;
+
+
+	len = (int) v.size();
+	Value(len);
+
+	if(this->Saving)
+	{
+		Transfer((void *) v.data(), len);
+	}
+	else
+	{
+		buf = (char *) malloc(len + 1);
+		Transfer(buf, len);
+		v.assign(buf, len);
+		free(buf);
+	}
+
+	return;
+}
+
+
+void Snapshot::Array(int *a, int n)
+{
+	Transfer(a, n * sizeof(int));
+	return;
+}
+
+
+void Snapshot::Array(double *a, int n)
+{
+	Transfer(a, n * sizeof(double));
+	return;
+}
+
+
+void Snapshot::Array(bool *a, int n)
+{
+	Transfer(a, n * sizeof(bool));
+	return;
+}
+
+
+void Snapshot::Values(vector<int> &v)
+{
+	int n;
+
+
+	n = (int) v.size();
+	Value(n);
+	v.resize(n);
+	if(n > 0)
+	{
+		Array(&v[0], n);
+	}
+
+	return;
+}
+
+
+void Snapshot::Values(set<int> &s)
+{
+	int n;
+	int val;
+	set<int>::iterator it;
+
+
+	n = (int) s.size();
+	Value(n);
+
+	if(this->Saving)
+	{
+		for(it = s.begin(); it != s.end(); ++it)
+		{
+			val = *it;
+			Value(val);
+		}
+	}
+	else
+	{
+		s.clear();
+		while(n-- > 0)
+		{
+			Value(val);
+			s.insert(s.end(), val);
+		}
+	}
+
+	return;
+}
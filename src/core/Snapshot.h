@@ -0,0 +1,83 @@
+/*
+ *  Adyton: A Network Simulator for Opportunistic Networks
+ *  Copyright (C) 2015  Nikolaos Papanikos, Dimitrios-Georgios Akestoridis,
+ *  and Evangelos Papapetrou
+ *
+ *  This file is part of Adyton.
+ *
+ *  Adyton is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Adyton is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Adyton.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include <set>
+
+using namespace std;
+
+
+/* Snapshot files start with this 8-byte tag */
+#define SNAPSHOT_MAGIC "ADYSNAP4"
+#define SNAPSHOT_MAGIC_SIZE 8
+
+
+/* Snapshot
+ * --------
+ * A binary file that holds the complete state of a simulation at a given time. Every
+ * module implements a single Checkpoint() method that passes its state through the
+ * methods below: while a snapshot is being saved they write the given variables and
+ * while it is being restored they read them back. Values that must agree between the
+ * snapshot and the current settings are passed through Match(). Each module starts its
+ * state with a Section() tag, so that a snapshot that does not match the modules of the
+ * current simulation is detected immediately. Values are stored in native byte order.
+ */
+class Snapshot
+{
+private:
+	FILE *fp;
+	string Filename;
+	bool Saving;
+
+	void Transfer(void *data, size_t size);
+
+public:
+	Snapshot(string Fname, bool save);
+	~Snapshot();
+	bool isSaving(void){return Saving;};
+	bool isRestoring(void){return !Saving;};
+	string getFilename(void){return Filename;};
+
+	void Section(const char *tag);
+	void Match(int current, const char *what);
+	void Match(double current, const char *what);
+	void Match(string current, const char *what);
+	void Unsupported(const char *what);
+
+	void Value(int &v);
+	void Value(unsigned int &v);
+	void Value(long int &v);
+	void Value(unsigned long &v);
+	void Value(double &v);
+	void Value(long double &v);
+	void Value(bool &v);
+	void Value(string &v);
+	void Array(int *a, int n);
+	void Array(double *a, int n);
+	void Array(bool *a, int n);
+	void Values(vector<int> &v);
+	void Values(set<int> &s);
+};
@@ -0,0 +1,55 @@
+/*
+ *  Adyton: A Network Simulator for Opportunistic Networks
+ *  Copyright (C) 2015  Nikolaos Papanikos, Dimitrios-Georgios Akestoridis,
+ *  and Evangelos Papapetrou
+ *
+ *  This file is part of Adyton.
+ *
+ *  Adyton is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Adyton is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Adyton.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/* Specialized builds
+ * ------------------
+ * The generic binary selects the routing protocol, the scheduling policy and the dropping
+ * policy at run time, so every contact and packet goes through virtual calls on their base
+ * classes. A specialized build fixes this combination at compile time (see the "specialized"
+ * target of the Makefile): the classes are given by FIXED_RT, FIXED_SP and FIXED_DP and their
+ * identifiers by FIXED_RT_ID, FIXED_SP_ID and FIXED_DP_ID. The nodes, the routing protocols
+ * and the packet buffers then hold pointers to final wrappers of these classes, which lets
+ * the compiler resolve their calls statically and inline them.
+ */
+#if defined(FIXED_RT) || defined(FIXED_SP) || defined(FIXED_DP)
+	#if !defined(FIXED_RT) || !defined(FIXED_SP) || !defined(FIXED_DP) || !defined(FIXED_RT_ID) || !defined(FIXED_SP_ID) || !defined(FIXED_DP_ID)
+		#error "A specialized build must fix the routing protocol, the scheduling policy and the dropping policy"
+	#endif
+
+	#define SPECIALIZED_BUILD
+	#define ROUTING_TYPE Fixed<FIXED_RT>
+	#define SCHEDULING_TYPE Fixed<FIXED_SP>
+	#define DROPPING_TYPE Fixed<FIXED_DP>
+
+	template<class Base> class Fixed final: public Base
+	{
+	public:
+		using Base::Base;
+	};
+
+	#define SPECIALIZED_NAME_(name) #name
+	#define SPECIALIZED_NAME(name) SPECIALIZED_NAME_(name)
+#else
+	#define ROUTING_TYPE Routing
+	#define SCHEDULING_TYPE SchedulingPolicy
+	#define DROPPING_TYPE DroppingPolicy
+#endif
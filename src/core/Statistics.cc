@@ -51,11 +51,13 @@ Statistics::Statistics(PacketPool *P, int ID, double duration, int trafType, God
 	this->srcPktsDropped=0;
 	this->relPktsDropped=0;
 	this->pktsDied=0;
+	this->skippedHandshakes=0;
 	this->sampleStartTime=0.2*duration;
 	this->sampleEndTime=0.8*duration;
 	this->traceDuration=duration;
 	this->trafficType=trafType;
 	this->SimGod = G;
+	this->Received.set_empty_key(-1);
 }
 
 
@@ -80,6 +82,7 @@ void Statistics::SetPktsForMe(int pkts)
 	this->PktsForMe = pkts;
 	this->ReceptionList = (int *) malloc(pkts * sizeof(int));
 	this->currentSlot = 0;
+	this->Received.resize(pkts);
 
 	for(i = 0; i < pkts; i++)
 	{
@@ -173,9 +176,8 @@ double Statistics::getAvgFw(void )
  */
 void Statistics::pktRec(int hops, double del, Packet *p, double pktCreationTime, bool processDuplicates)
 {
-	int i;
 	int pktID;
-	bool alreadyReceived;
+	dense_hash_map<int,int>::iterator it;
 
 
 	if(isBackgroundTraffic(pktCreationTime))
@@ -204,18 +206,12 @@ void Statistics::pktRec(int hops, double del, Packet *p, double pktCreationTime,
 	 		pktID = p->getID();
 		}
 
-		alreadyReceived = false;
-		for(i = 0; i < this->currentSlot; i++)
-		{
-			if(this->ReceptionList[i] == pktID)
-			{
-				alreadyReceived = true;
-			}
-		}
+		it = this->Received.find(pktID);
 
-		if(alreadyReceived)
+		if(it != this->Received.end())
 		{
 			this->Duplicates++;
+			it->second++;
 
 			if(processDuplicates)
 			{
@@ -230,6 +226,7 @@ void Statistics::pktRec(int hops, double del, Packet *p, double pktCreationTime,
 
 			this->ReceptionList[this->currentSlot] = pktID;
 			this->currentSlot++;
+			this->Received[pktID] = 0;
 
 			this->SimGod->deliveredPkt(pktID, hops, del);
 		}
@@ -239,6 +236,27 @@ void Statistics::pktRec(int hops, double del, Packet *p, double pktCreationTime,
 }
 
 
+/* getPktDuplicates
+ * ----------------
+ * Returns the number of duplicate deliveries of the packet with the given original ID
+ * to this destination node.
+ */
+int Statistics::getPktDuplicates(int pktID)
+{
+	dense_hash_map<int,int>::iterator it;
+
+
+	it = this->Received.find(pktID);
+
+	if(it == this->Received.end())
+	{
+		return 0;
+	}
+
+	return it->second;
+}
+
+
 void Statistics::pktGen(int pktID, int srcID, int dstID, int genTime)
 {
 	if(!isBackgroundTraffic(genTime))
@@ -327,6 +345,27 @@ void Statistics::updateStats(int pktID, int dupHops, double dupDelay)
 }
 
 
+/* pktJourney
+ * ----------
+ * Records the delivery of a packet whose journey was computed by the oracle of
+ * Optimal Routing (see Oracle.h) instead of being simulated.
+ */
+void Statistics::pktJourney(int pktID, int hops, double del)
+{
+	this->sumHops += hops;
+	this->sumDelay += del;
+	this->ReceivedForMe++;
+
+	this->ReceptionList[this->currentSlot] = pktID;
+	this->currentSlot++;
+	this->Received[pktID] = 0;
+
+	this->SimGod->deliveredPkt(pktID, hops, del);
+
+	return;
+}
+
+
 /* incForwards
  * -----------
  * This method keeps track of the packet forwards occurred in the current node.
@@ -463,6 +502,19 @@ void Statistics::incRelPktsDropped(double pktCreationTime)
 }
 
 
+/* incSkippedHandshakes
+ * --------------------
+ * This method keeps track of the contacts in which the exchange of control packets
+ * was skipped, since this node had no packets to offer.
+ */
+void Statistics::incSkippedHandshakes(void)
+{
+	this->skippedHandshakes++;
+
+	return;
+}
+
+
 bool Statistics::isBackgroundTraffic(double pktCreationTime)
 {
 	if((this->trafficType == SAMPLE_TT) && !((pktCreationTime >= this->sampleStartTime) && (pktCreationTime <= this->sampleEndTime)))
@@ -474,3 +526,53 @@ bool Statistics::isBackgroundTraffic(double pktCreationTime)
 		return false;
 	}
 }
+
+
+/* Checkpoint
+ * ----------
+ * Saves or restores the per node statistics. The number of packets destined to this
+ * node is determined by the traffic of the current simulation and has to match.
+ */
+void Statistics::Checkpoint(Snapshot *snap)
+{
+	int i;
+	int dups;
+
+
+	snap->Section("STAT");
+	snap->Match(this->PktsForMe, "packets destined to a node");
+	snap->Value(this->sumHops);
+	snap->Value(this->sumDelay);
+	snap->Value(this->Duplicates);
+	snap->Value(this->ReceivedForMe);
+	snap->Value(this->currentSlot);
+	snap->Array(this->ReceptionList, this->currentSlot);
+
+	if(snap->isRestoring())
+	{
+		this->Received.clear();
+	}
+
+	dups = 0;
+	for(i = 0; i < this->currentSlot; i++)
+	{
+		if(snap->isSaving())
+		{
+			dups = this->Received[this->ReceptionList[i]];
+		}
+		snap->Value(dups);
+		this->Received[this->ReceptionList[i]] = dups;
+	}
+
+	snap->Value(this->Forwards);
+	snap->Value(this->ReplicasCreated);
+	snap->Value(this->timesAsRelayNode);
+	snap->Value(this->handovers);
+	snap->Value(this->pktsDropped);
+	snap->Value(this->srcPktsDropped);
+	snap->Value(this->relPktsDropped);
+	snap->Value(this->pktsDied);
+	snap->Value(this->skippedHandshakes);
+
+	return;
+}
@@ -54,6 +54,7 @@ protected:
 
 	int *ReceptionList;
 	int currentSlot;//pos in reception list
+	dense_hash_map<int,int> Received;//original ID of each received packet -> number of its duplicate deliveries
 
 	PacketPool *Pool;
 	int Forwards;
@@ -74,6 +75,8 @@ protected:
 	unsigned int relPktsDropped;
 	unsigned int pktsDied;
 
+	unsigned int skippedHandshakes;
+
 	God *SimGod;
 
 public:
@@ -93,6 +96,7 @@ public:
 	double getAvgFw(void);
 	int getTransmissions(void){return this->Forwards;};
 	int getDuplicates(void){return this->Duplicates;};
+	int getPktDuplicates(int pktID);
 	int getRepCreated(void){return this->ReplicasCreated;};
 	unsigned int getTimesAsRelayNode(void){return(timesAsRelayNode);};
 	unsigned int getHandovers(void){return(handovers);};
@@ -100,6 +104,7 @@ public:
 	unsigned int getSrcPktsDropped(void){return(srcPktsDropped);};
 	unsigned int getRelPktsDropped(void){return(relPktsDropped);};
 	unsigned int getPktsDied(void){return(pktsDied);};
+	unsigned int getSkippedHandshakes(void){return(skippedHandshakes);};
 	int getcurrentSlot(void){return this->currentSlot;};
 
 	void pktRec(int hops, double del, Packet *p, double pktCreationTime, bool processDuplicates);
@@ -113,7 +118,10 @@ public:
 	void incPktsDied(double pktCreationTime);
 	void incSrcPktsDropped(double pktCreationTime);
 	void incRelPktsDropped(double pktCreationTime);
+	void incSkippedHandshakes(void);
 
 	void updateStats(int PID, int hops, double delay);
+	void pktJourney(int pktID, int hops, double del);
 	bool isBackgroundTraffic(double pktCreationTime);
+	void Checkpoint(Snapshot *snap);
 };
@@ -42,6 +42,15 @@ TrafficGen::TrafficGen(int Seed, int Total, double duration, string presFile, Ev
 	FillPresenceList(this->presenceFilename);
 
 	this->Sim = SimL;
+	this->ScheduleHead = 0;
+	this->lastReleaseTime = 0.0;
+	this->trafficFile = NULL;
+	this->binaryTraffic = false;
+	this->sortedTraffic = true;
+	this->trafficStart = 0;
+	this->filePackets = 0;
+	this->filePacketsFor = NULL;
+	this->hasLookahead = false;
 
 	return;
 }
@@ -53,6 +62,12 @@ TrafficGen::~TrafficGen(void )
 
 	free(inPresence);
 	free(outPresence);
+	free(filePacketsFor);
+
+	if(trafficFile)
+	{
+		fclose(trafficFile);
+	}
 
 	return;
 }
@@ -226,6 +241,8 @@ bool TrafficGen::ArePresent(int A, int B,double Time)
  * (ii) Both nodes should be present in the network in the generated time instance. The
  * term "present node" indicates a node that has joined the network (has made a least one contact) 
  * and it has not disjointed yet (has at least a contact to make).
+ * The pairs are not stored; a pair number refers to the list of all (source, destination)
+ * pairs of active nodes ordered by source and then by destination.
  */
 int *TrafficGen::CreateUniformTraffic(int NumPackets)
 {
@@ -255,32 +272,12 @@ int *TrafficGen::CreateUniformTraffic(int NumPackets)
 			runner++;
 		}
 	}
-	int totalPairs=active*(active-1);
-	trafficPair *activePairs=(trafficPair *)malloc(sizeof(trafficPair)*totalPairs);
-	for(int i=0;i<totalPairs;i++)
-	{
-		activePairs[i].source=0;
-		activePairs[i].dest=0;
-	}
-	runner=0;
-	for(int i=0;i<active;i++)
+	long int totalPairs=(long int)active*(active-1);
+	if(NumPackets > 0 && totalPairs <= 0)
 	{
-		for(int j=0;j<active;j++)
-		{
-			if(i == j)
-			{
-				continue;
-			}
-			activePairs[runner].source=activeNodes[i];
-			activePairs[runner].dest=activeNodes[j];
-			runner++;
-		}
+		printf("\nError: At least two active nodes are required to create traffic!\n\n");
+		exit(EXIT_FAILURE);
 	}
-// 	printf("All pairs are %d\n",runner);
-// 	for(int i=0;i<totalPairs;i++)
-// 	{
-// 		printf("%d\t%d\n",activePairs[i].source,activePairs[i].dest);
-// 	}
 	int *PacketsFor=(int*)malloc(sizeof(int)*this->TotalNodes);
 	for(int i=0;i<this->TotalNodes;i++)
 	{
@@ -288,17 +285,24 @@ int *TrafficGen::CreateUniformTraffic(int NumPackets)
 	}
 	int Sender=0;
 	int Receiver=0;
-	Event *trans=NULL;
 	double insTime=0.0;
 	double commonIn=0.0;
 	double commonOut=0.0;
 	int skipped=0;
-	int randomPair=-1;
+	long int randomPair=-1;
+	long int position=-1;
+	this->Schedule.reserve(NumPackets);
 	for(int i=0;i<NumPackets;i++)
 	{
 		randomPair=rand()%totalPairs;
-		Sender=activePairs[randomPair].source;
-		Receiver=activePairs[randomPair].dest;
+		Sender=activeNodes[randomPair/(active-1)];
+		//the source itself is skipped in its list of destinations
+		position=randomPair%(active-1);
+		if(position >= randomPair/(active-1))
+		{
+			position++;
+		}
+		Receiver=activeNodes[position];
 		//Get the first time instance that both the sender and the receiver exist to the network  
 		if(this->inPresence[Sender] > this->inPresence[Receiver])
 		{
@@ -338,15 +342,14 @@ int *TrafficGen::CreateUniformTraffic(int NumPackets)
 		}
 		insTime=(double)(rand()%(int)(commonOut-commonIn))+(int)commonIn;
 // 		printf("Scheduled: %d %d %f\n",Sender,Receiver,insTime);
-		trans=new Transmission(insTime,-1,Sender,Receiver);
-		this->Sim->InsertEvent(trans);
+		AddAppPacket(insTime,Sender,Receiver);
 		PacketsFor[Receiver]++;
 	}
 	totalStatPkts = NumPackets-skipped;
 // 	printf("\nCreated %d packets (asked for %d)\n",totalStatPkts,NumPackets);
+	OrderSchedule();
 	//free memory
 	free(activeNodes);
-	free(activePairs);
 	return PacketsFor;
 }
 
@@ -379,32 +382,7 @@ int *TrafficGen::CreateBurstTraffic(int NumPackets)
 			runner++;
 		}
 	}
-	int totalPairs=active*(active-1);
-	trafficPair *activePairs=(trafficPair *)malloc(sizeof(trafficPair)*totalPairs);
-	for(int i=0;i<totalPairs;i++)
-	{
-		activePairs[i].source=0;
-		activePairs[i].dest=0;
-	}
-	runner=0;
-	for(int i=0;i<active;i++)
-	{
-		for(int j=0;j<active;j++)
-		{
-			if(i == j)
-			{
-				continue;
-			}
-			activePairs[runner].source=activeNodes[i];
-			activePairs[runner].dest=activeNodes[j];
-			runner++;
-		}
-	}
-// 	printf("All pairs are %d\n",runner);
-// 	for(int i=0;i<totalPairs;i++)
-// 	{
-// 		printf("%d\t%d\n",activePairs[i].source,activePairs[i].dest);
-// 	}
+	long int totalPairs=(long int)active*(active-1);
 	int *PacketsFor=(int*)malloc(sizeof(int)*this->TotalNodes);
 	for(int i=0;i<this->TotalNodes;i++)
 	{
@@ -412,19 +390,31 @@ int *TrafficGen::CreateBurstTraffic(int NumPackets)
 	}
 	int Sender=0;
 	int Receiver=0;
-	Event *trans=NULL;
 	double insTime=0.0;
 	double commonIn=0.0;
 	double commonOut=0.0;
 	int skipped=0;
-	int randomPair=-1;
+	long int randomPair=-1;
+	long int position=-1;
 	int flowsize=3;
 	int flows=NumPackets/(2*flowsize); //each flow will be composed of 10 packets
+	if(flows > 0 && totalPairs <= 0)
+	{
+		printf("\nError: At least two active nodes are required to create traffic!\n\n");
+		exit(EXIT_FAILURE);
+	}
+	this->Schedule.reserve(2*flowsize*flows);
 	for(int i=0;i<flows;i++)
 	{
 		randomPair=rand()%totalPairs;
-		Sender=activePairs[randomPair].source;
-		Receiver=activePairs[randomPair].dest;
+		Sender=activeNodes[randomPair/(active-1)];
+		//the source itself is skipped in its list of destinations
+		position=randomPair%(active-1);
+		if(position >= randomPair/(active-1))
+		{
+			position++;
+		}
+		Receiver=activeNodes[position];
 		//Get the first time instance that both the sender and the receiver exist to the network  
 		if(this->inPresence[Sender] > this->inPresence[Receiver])
 		{
@@ -466,17 +456,17 @@ int *TrafficGen::CreateBurstTraffic(int NumPackets)
 		for(int j=0;j<flowsize;j++)
 		{
 // 			printf("Scheduled: %d %d %f\n",Sender,Receiver,insTime);
-			trans=new Transmission(insTime+(j*7200),-1,Sender,Receiver);
-			this->Sim->InsertEvent(trans);
+			AddAppPacket(insTime+(j*7200),Sender,Receiver);
 			PacketsFor[Receiver]++;
 			
-			trans=new Transmission(insTime+(j*7200),-1,Receiver,Sender);
-			this->Sim->InsertEvent(trans);
+			AddAppPacket(insTime+(j*7200),Receiver,Sender);
 			PacketsFor[Sender]++;
 		}
 	}
 	totalStatPkts = NumPackets-skipped;
 	printf("\nCreated %d packets (asked for %d)\n",totalStatPkts,NumPackets);
+	OrderSchedule();
+	free(activeNodes);
 	return PacketsFor;
 }
 
@@ -494,15 +484,21 @@ bool TrafficGen::isInactive(int nodeID)
 }
 
 
+/* CreateSampleTraffic
+ * -------------------
+ * The creation time of each packet is chosen uniformly over the trace duration and its
+ * source and destination are chosen among the nodes that are present at that time. Only
+ * the number of present nodes is needed while drawing, so the positions of the chosen
+ * nodes are recorded and translated to node IDs afterwards (see ResolvePresentNodes).
+ */
 int *TrafficGen::CreateSampleTraffic(int NumPackets)
 {
 	int i;
-	int Sender;
-	int Receiver;
+	int present;
+	int first;
+	int second;
 	int *PacketsFor;
-	int *presentNodes;
 	double creationTime;
-	Event *trans;
 
 
 	if(!this->Sim)
@@ -518,40 +514,33 @@ int *TrafficGen::CreateSampleTraffic(int NumPackets)
 		PacketsFor[i] = 0;
 	}
 
-	Sender = 0;
-	Receiver = 0;
 	totalStatPkts = 0;
-	trans = NULL;
+	SortPresence();
+	this->Schedule.reserve(NumPackets);
 
 	for(i = 0; i < NumPackets; i++)
 	{
 		creationTime = (double) (rand() % ((int) (this->traceDuration + 1.0)));
 
-		presentNodes = getAllPresentNodes(creationTime);
+		present = countPresentNodes(creationTime);
 
-		if(presentNodes[0] > 1)
+		if(present > 1)
 		{
-			Sender = presentNodes[(rand() % presentNodes[0]) + 1];
-			Receiver = presentNodes[(rand() % (presentNodes[0] - 1)) + 1];
-
-			if(Sender == Receiver)
-			{
-				Receiver = presentNodes[presentNodes[0]];
-			}
+			first = rand() % present;
+			second = rand() % (present - 1);
 			
 			if((creationTime >= this->SndPrdStart) && (creationTime <= this->SndPrdStop))
 			{
 				totalStatPkts++;
 			}
 
-			trans = new Transmission(creationTime, -1, Sender, Receiver);
-			this->Sim->InsertEvent(trans);
-			PacketsFor[Receiver]++;
+			AddAppPacket(creationTime, first, second);
 		}
-
-		free(presentNodes);
 	}
 
+	OrderSchedule();
+	ResolvePresentNodes(PacketsFor);
+
 	return PacketsFor;
 }
 
@@ -559,16 +548,8 @@ int *TrafficGen::CreateSampleTraffic(int NumPackets)
 int *TrafficGen::CreatePredefinedTraffic()
 {
 	int i;
-	int field;
-	int Sender;
-	int Receiver;
 	int *PacketsFor;
-	double creationTime;
-	char *word;
-	char line[512];
-	char input[] = "../utils/traffic-scenarios/Debugging-traffic.txt";
-	Event *trans;
-	FILE *filePointer;
+	AppPacket pkt;
 
 
 	if(!this->Sim)
@@ -576,70 +557,428 @@ int *TrafficGen::CreatePredefinedTraffic()
 		printf("Traffic generation is not initialized!Aborting..");
 		exit(1);
 	}
+
+	if(!this->trafficFile)
+	{
+		printf("\n[Error]: The predefined traffic file has not been opened\n\n");
+		exit(EXIT_FAILURE);
+	}
 	
 	PacketsFor = (int *) malloc(this->TotalNodes * sizeof(int));
 	
 	for(i = 0; i < this->TotalNodes; i++)
 	{
-		PacketsFor[i] = 0;
+		PacketsFor[i] = this->filePacketsFor[i];
 	}
 
-	Sender = 0;
-	Receiver = 0;
-	totalStatPkts = 0;
-	creationTime = 0.0;
-	trans = NULL;
-
+	totalStatPkts = (int) this->filePackets;
 
-	/* Open the traffic trace file */
-	if(!(filePointer = fopen(input, "r")))
+	if(fseek(this->trafficFile, this->trafficStart, SEEK_SET))
 	{
-		printf("\n[Error]: Couldn't open the file: %s\n\n", input);
+		printf("\n[Error]: Couldn't rewind the file: %s\n\n", this->trafficFilename.c_str());
 		exit(EXIT_FAILURE);
 	}
 
+	if(this->sortedTraffic)
+	{
+		/* Packets are read while the simulation runs (see ReleaseTraffic) */
+		this->hasLookahead = ReadTrafficRecord(&(this->Lookahead));
+	}
+	else
+	{
+		/* Text files that are not sorted by creation time are loaded into memory */
+		while(ReadTrafficRecord(&pkt))
+		{
+			AddAppPacket(pkt.Time, pkt.Source, pkt.Dest);
+		}
+		OrderSchedule();
+	}
 
-	while(fgets(line, 512, filePointer))
+	if(!this->hasLookahead)
 	{
-		field = 0;
-		word = strtok(line, "\t");
+		fclose(this->trafficFile);
+		this->trafficFile = NULL;
+	}
+
+	return PacketsFor;
+}
 
-		while(word)
+
+/* OpenTrafficFile
+ * ---------------
+ * Opens the file of the predefined traffic and scans it once, counting the packets for
+ * each destination and checking whether they are sorted by creation time. Files that
+ * start with TRAFFIC_MAGIC are binary traffic files (see utils/traffic-scenarios/); any
+ * other file is read as text, one "creation time, source, destination" line per packet.
+ */
+void TrafficGen::OpenTrafficFile(string Path)
+{
+	int i;
+	char magic[TRAFFIC_MAGIC_SIZE];
+	long long declared;
+	double lastTime;
+	AppPacket pkt;
+
+
+	this->trafficFilename = Path;
+
+	if(!(this->trafficFile = fopen(Path.c_str(), "rb")))
+	{
+		printf("\n[Error]: Couldn't open the file: %s\n\n", Path.c_str());
+		exit(EXIT_FAILURE);
+	}
+
+	declared = 0;
+	this->binaryTraffic = false;
+	this->trafficStart = 0;
+
+	if((fread(magic, 1, TRAFFIC_MAGIC_SIZE, this->trafficFile) == TRAFFIC_MAGIC_SIZE) && !memcmp(magic, TRAFFIC_MAGIC, TRAFFIC_MAGIC_SIZE))
+	{
+		if(fread(&declared, sizeof(long long), 1, this->trafficFile) != 1)
 		{
-			field++;
+			printf("\n[Error]: The file %s is not a valid binary traffic file\n\n", Path.c_str());
+			exit(EXIT_FAILURE);
+		}
+		this->binaryTraffic = true;
+		this->trafficStart = ftell(this->trafficFile);
+	}
 
-			/* Identify the type of the attribute */
-			if(field == 1)
-			{/* Creation Time */
-				creationTime = atof(word);
-			}
-			else if(field == 2)
-			{/* Sender */
-				Sender = atoi(word);
-			}
-			else if(field == 3)
-			{/* Receiver */
-				Receiver = atoi(word);
-			}
+	if(fseek(this->trafficFile, this->trafficStart, SEEK_SET))
+	{
+		printf("\n[Error]: Couldn't rewind the file: %s\n\n", Path.c_str());
+		exit(EXIT_FAILURE);
+	}
+
+	this->filePacketsFor = (int *) malloc(this->TotalNodes * sizeof(int));
+
+	for(i = 0; i < this->TotalNodes; i++)
+	{
+		this->filePacketsFor[i] = 0;
+	}
+
+	this->filePackets = 0;
+	this->sortedTraffic = true;
+	lastTime = 0.0;
 
-			word = strtok(NULL, "\t");
+	while(ReadTrafficRecord(&pkt))
+	{
+		if((this->filePackets > 0) && (pkt.Time < lastTime))
+		{
+			this->sortedTraffic = false;
 		}
+		lastTime = pkt.Time;
+		this->filePacketsFor[pkt.Dest]++;
+		this->filePackets++;
+	}
 
-		totalStatPkts++;
-		trans = new Transmission(creationTime, -1, Sender, Receiver);
-		this->Sim->InsertEvent(trans);
-		PacketsFor[Receiver]++;
+	if(this->binaryTraffic && (declared != this->filePackets))
+	{
+		printf("\n[Error]: The binary traffic file %s is truncated (%lld packets declared, %ld found)\n\n", Path.c_str(), declared, this->filePackets);
+		exit(EXIT_FAILURE);
+	}
+
+	if(this->binaryTraffic && !this->sortedTraffic)
+	{
+		printf("\n[Error]: The packets of the binary traffic file %s are not sorted by creation time\n\n", Path.c_str());
+		exit(EXIT_FAILURE);
 	}
 
+	return;
+}
+
 
-	/* Close the traffic trace file */
-	if(fclose(filePointer))
+/* ReadTrafficRecord
+ * -----------------
+ * Reads the next packet of the traffic file. Text lines that do not hold a packet
+ * (e.g. empty lines) are skipped. Returns false at the end of the file.
+ */
+bool TrafficGen::ReadTrafficRecord(AppPacket *pkt)
+{
+	char line[512];
+	bool found;
+
+
+	found = false;
+
+	if(this->binaryTraffic)
 	{
-		printf("\n[Error]: Couldn't close the file: %s\n\n", input);
+		found = (fread(pkt, sizeof(AppPacket), 1, this->trafficFile) == 1);
+	}
+	else
+	{
+		while(!found && fgets(line, 512, this->trafficFile))
+		{
+			found = (sscanf(line, "%lf %d %d", &(pkt->Time), &(pkt->Source), &(pkt->Dest)) == 3);
+		}
+	}
+
+	if(found && ((pkt->Source < 0) || (pkt->Source >= this->TotalNodes) || (pkt->Dest < 0) || (pkt->Dest >= this->TotalNodes)))
+	{
+		printf("\n[Error]: The traffic file %s contains a packet from node %d to node %d (maximum node ID is %d)\n\n", this->trafficFilename.c_str(), pkt->Source, pkt->Dest, this->TotalNodes - 1);
 		exit(EXIT_FAILURE);
 	}
 
-	return PacketsFor;
+	return found;
+}
+
+
+/* ReadTrafficChunk
+ * ----------------
+ * Reads the next TRAFFIC_CHUNK packets of a sorted traffic file into the schedule. The
+ * chunk is extended so that packets with the same creation time are never split, which
+ * lets OrderSchedule give them the same order as in-memory traffic.
+ */
+void TrafficGen::ReadTrafficChunk(void)
+{
+	this->Schedule.clear();
+	this->ScheduleHead = 0;
+
+	while(this->hasLookahead && ((this->Schedule.size() < TRAFFIC_CHUNK) || (this->Lookahead.Time == this->Schedule.back().Time)))
+	{
+		this->Schedule.push_back(this->Lookahead);
+		this->hasLookahead = ReadTrafficRecord(&(this->Lookahead));
+	}
+
+	OrderSchedule();
+
+	if(!this->hasLookahead)
+	{
+		fclose(this->trafficFile);
+		this->trafficFile = NULL;
+	}
+
+	return;
+}
+
+
+/* AddAppPacket
+ * ------------
+ * Appends a packet to the traffic schedule (in generation order).
+ */
+void TrafficGen::AddAppPacket(double Time, int Source, int Dest)
+{
+	AppPacket pkt;
+
+	pkt.Time = Time;
+	pkt.Source = Source;
+	pkt.Dest = Dest;
+	this->Schedule.push_back(pkt);
+
+	return;
+}
+
+
+static bool EarlierPacket(const AppPacket &a, const AppPacket &b)
+{
+	return a.Time < b.Time;
+}
+
+
+/* OrderSchedule
+ * -------------
+ * Sorts the schedule by creation time. Packets with the same creation time are kept in
+ * reverse generation order, i.e. the order the event list used to give them when every
+ * application event was inserted before the simulation started.
+ */
+void TrafficGen::OrderSchedule(void)
+{
+	reverse(this->Schedule.begin(), this->Schedule.end());
+	stable_sort(this->Schedule.begin(), this->Schedule.end(), EarlierPacket);
+	this->ScheduleHead = 0;
+
+	return;
+}
+
+
+/* ReleaseTraffic
+ * --------------
+ * Hands the next chunk of the schedule to the event list, reading it from the traffic file
+ * when the predefined traffic is streamed. The simulator calls this method whenever the
+ * earliest pending packet is not later than the next event of the list. The
+ * events of a chunk are placed after the events with the same time, which is exactly
+ * where they would be if all of them had been inserted before the simulation started.
+ */
+void TrafficGen::ReleaseTraffic(void)
+{
+	unsigned int stop;
+
+
+	if(this->ScheduleHead == this->Schedule.size())
+	{
+		ReadTrafficChunk();
+	}
+
+	stop = this->ScheduleHead + TRAFFIC_CHUNK;
+	if(stop > this->Schedule.size())
+	{
+		stop = this->Schedule.size();
+	}
+
+	this->Batch.clear();
+	while(this->ScheduleHead < stop)
+	{
+		AppPacket *pkt = &(this->Schedule[this->ScheduleHead]);
+		this->Batch.push_back(new Transmission(pkt->Time, -1, pkt->Source, pkt->Dest));
+		this->lastReleaseTime = pkt->Time;
+		this->ScheduleHead++;
+	}
+	this->Sim->InsertBatch(&(this->Batch[0]), (int) this->Batch.size());
+
+	if((this->ScheduleHead == this->Schedule.size()) && !this->hasLookahead)
+	{
+		/* Release the memory of the schedule */
+		vector<AppPacket>().swap(this->Schedule);
+		vector<Event *>().swap(this->Batch);
+		this->ScheduleHead = 0;
+	}
+
+	return;
+}
+
+
+/* SkipTraffic
+ * -----------
+ * Discards the pending packets that were created before the given time. A simulation
+ * restored from a snapshot has already handled these packets.
+ */
+void TrafficGen::SkipTraffic(double Time)
+{
+	while(hasPendingTraffic() && (nextTrafficTime() < Time))
+	{
+		if(this->ScheduleHead == this->Schedule.size())
+		{
+			ReadTrafficChunk();
+		}
+		this->ScheduleHead++;
+	}
+
+	return;
+}
+
+
+/* SortPresence
+ * ------------
+ * Lists the nodes by the start (Joins) and by the end (Leaves) of their presence.
+ * Nodes without a valid presence interval are never present and are not listed.
+ */
+void TrafficGen::SortPresence(void)
+{
+	int i;
+
+
+	this->Joins.clear();
+	this->Leaves.clear();
+
+	for(i = 0; i < this->TotalNodes; i++)
+	{
+		if(this->inPresence[i] <= this->outPresence[i])
+		{
+			this->Joins.push_back(make_pair(this->inPresence[i], i));
+			this->Leaves.push_back(make_pair(this->outPresence[i], i));
+		}
+	}
+
+	sort(this->Joins.begin(), this->Joins.end());
+	sort(this->Leaves.begin(), this->Leaves.end());
+
+	return;
+}
+
+
+/* countPresentNodes
+ * -----------------
+ * Returns the number of nodes that are present in "creationTime" (see getAllPresentNodes),
+ * i.e. the nodes that joined up to that time minus the nodes that left before it.
+ */
+int TrafficGen::countPresentNodes(double creationTime)
+{
+	long int joined;
+	long int left;
+
+
+	joined = upper_bound(this->Joins.begin(), this->Joins.end(), make_pair(creationTime, INT_MAX)) - this->Joins.begin();
+	left = lower_bound(this->Leaves.begin(), this->Leaves.end(), make_pair(creationTime, INT_MIN)) - this->Leaves.begin();
+
+	return (int) (joined - left);
+}
+
+
+/* ResolvePresentNodes
+ * -------------------
+ * Translates the positions recorded by CreateSampleTraffic to node IDs. The (time ordered)
+ * schedule is swept while a Fenwick tree over the node IDs keeps the present nodes, so
+ * the k-th present node is found by descending the tree.
+ */
+void TrafficGen::ResolvePresentNodes(int *PacketsFor)
+{
+	unsigned int i;
+	unsigned int nextJoin;
+	unsigned int nextLeave;
+	int j;
+	int top;
+	int present;
+	vector<int> Tree(this->TotalNodes + 1, 0);
+
+
+	for(top = 1; (top << 1) <= this->TotalNodes; top <<= 1);
+
+	nextJoin = 0;
+	nextLeave = 0;
+	present = 0;
+
+	for(i = 0; i < this->Schedule.size(); i++)
+	{
+		AppPacket *pkt = &(this->Schedule[i]);
+		int ids[3];
+		int positions[3];
+
+		while(nextJoin < this->Joins.size() && this->Joins[nextJoin].first <= pkt->Time)
+		{
+			for(j = this->Joins[nextJoin].second + 1; j <= this->TotalNodes; j += (j & (-j)))
+			{
+				Tree[j]++;
+			}
+			present++;
+			nextJoin++;
+		}
+		while(nextLeave < this->Leaves.size() && this->Leaves[nextLeave].first < pkt->Time)
+		{
+			for(j = this->Leaves[nextLeave].second + 1; j <= this->TotalNodes; j += (j & (-j)))
+			{
+				Tree[j]--;
+			}
+			present--;
+			nextLeave++;
+		}
+
+		positions[0] = pkt->Source;
+		positions[1] = pkt->Dest;
+		positions[2] = present - 1;
+		for(int k = 0; k < 3; k++)
+		{
+			int pos = 0;
+			int rest = positions[k];
+			for(int step = top; step > 0; step >>= 1)
+			{
+				if(pos + step <= this->TotalNodes && Tree[pos + step] <= rest)
+				{
+					pos += step;
+					rest -= Tree[pos];
+				}
+			}
+			ids[k] = pos;
+		}
+
+		pkt->Source = ids[0];
+		pkt->Dest = ids[1];
+		if(pkt->Source == pkt->Dest)
+		{
+			pkt->Dest = ids[2];
+		}
+		PacketsFor[pkt->Dest]++;
+	}
+
+	return;
 }
 
 
@@ -24,6 +24,7 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <limits.h>
 #include <vector>
 #include <algorithm>
 #include <string>
@@ -48,12 +49,24 @@
 using namespace std;
 
 
-struct Nodepair
+/* Number of application events handed to the event list at a time */
+#define TRAFFIC_CHUNK 1024
+
+/* Binary traffic files start with this 8-byte tag and the number of packets (64 bits) */
+#define TRAFFIC_MAGIC "ADYTRAF1"
+#define TRAFFIC_MAGIC_SIZE 8
+
+/* AppPacket
+ * ---------
+ * A packet of the traffic scenario: creation time, source and destination. This is also
+ * the (native byte order) record of the binary traffic files.
+ */
+struct AppPacket
 {
-	int source;
-	int dest;
+	double Time;
+	int Source;
+	int Dest;
 };
-typedef struct Nodepair trafficPair;
 
 
 class TrafficGen
@@ -69,6 +82,29 @@ protected:
 	double *inPresence;
 	double *outPresence;
 	string presenceFilename;
+	vector<AppPacket> Schedule;
+	unsigned int ScheduleHead;
+	double lastReleaseTime;
+	vector<Event *> Batch;
+	vector< pair<double,int> > Joins;
+	vector< pair<double,int> > Leaves;
+	FILE *trafficFile;
+	string trafficFilename;
+	bool binaryTraffic;
+	bool sortedTraffic;
+	long int trafficStart;
+	long int filePackets;
+	int *filePacketsFor;
+	AppPacket Lookahead;
+	bool hasLookahead;
+
+	void AddAppPacket(double Time, int Source, int Dest);
+	void OrderSchedule(void);
+	void SortPresence(void);
+	int countPresentNodes(double creationTime);
+	void ResolvePresentNodes(int *PacketsFor);
+	bool ReadTrafficRecord(AppPacket *pkt);
+	void ReadTrafficChunk(void);
 
 public:
 	TrafficGen(int Seed, int Total, double duration, string presFile, EventList *SimL);
@@ -84,4 +120,11 @@ public:
 	bool ArePresent(int A, int B,double Time);
 	bool isInactive(int nodeID);
 	int *getAllPresentNodes(double creationTime);
+	void OpenTrafficFile(string Path);
+	long int getFilePackets(void){return filePackets;};
+	bool hasPendingTraffic(void){return (ScheduleHead < Schedule.size()) || hasLookahead;};
+	double nextTrafficTime(void){return (ScheduleHead < Schedule.size())?(Schedule[ScheduleHead].Time):(Lookahead.Time);};
+	double getLastReleaseTime(void){return lastReleaseTime;};
+	void ReleaseTraffic(void);
+	void SkipTraffic(double Time);
 };
@@ -34,7 +34,10 @@ UserInteraction::UserInteraction()
 	profileName="";
 	resDir ="";
 	trcDir = "";
+	trafficFile = "";
+	restoreFile = "";
 	includedProfile = false;
+	includedTrafficFile = false;
 	modifiedResDir = false;
 	modifiedTrcDir = false;
 
@@ -52,7 +55,12 @@ UserInteraction::UserInteraction()
 	REP = NOTSET;
 	SPLIT = NOTSET;
 	SEED = NOTSET;
+	SNAP = NOTSET;
+	THR = NOTSET;
 
+	DTRM = true;
+	DLVQ = false;
+	ESTP = true;
 	BTCH = false;
 	GUI = false;
 
@@ -131,7 +139,7 @@ Settings *UserInteraction::getSettings(int argc, char *argv[])
 		{
 			printLicence();
 			printf("Available simulation parameters:\n");
-			printf("./Adyton -TRACE <contact trace> -RT <routing protocol> -CC <congestion control mechanism> -SP <scheduling policy> -DP <dropping policy> -DM <deletion mechanism> -OUTPUT <output type> -TRAFFIC_TYPE <traffic type> -TRAFFIC_LOAD <number of packets> -TTL <time to live> -BUFFER <buffer size> -REP <replication number> -SPLIT <number of pieces> -SEED <seed number> -PROFILE <text file> -RES_DIR <results directory> -TRC_DIR <trace directory> -BATCH <batch mode>\n");
+			printf("./Adyton -TRACE <contact trace> -RT <routing protocol> -CC <congestion control mechanism> -SP <scheduling policy> -DP <dropping policy> -DM <deletion mechanism> -OUTPUT <output type> -TRAFFIC_TYPE <traffic type> -TRAFFIC_LOAD <number of packets> -TTL <time to live> -BUFFER <buffer size> -REP <replication number> -SPLIT <number of pieces> -SEED <seed number> -PROFILE <text file> -TRAFFIC_FILE <traffic file> -SNAPSHOT <time> -RESTORE <snapshot file> -THREADS <number of threads> -DETERMINISTIC <deterministic mode> -DELIVERY_QUEUE <delivery queue> -EARLY_STOP <early stop> -RES_DIR <results directory> -TRC_DIR <trace directory> -BATCH <batch mode>\n");
 			printf("\nFor more information about the available options of a parameter, type `./Adyton -help <parameter>' or `./Adyton -h <parameter>'.\n\n");
 			exit(EXIT_SUCCESS);
 		}
@@ -256,6 +264,24 @@ Settings *UserInteraction::getSettings(int argc, char *argv[])
 	}
 
 
+	/* Set the predefined traffic file (implies predefined traffic) */
+	if(includedTrafficFile)
+	{
+		Set->setTrafficFilename(trafficFile);
+
+		if(TT == NOTSET)
+		{
+			Set->setTrafficType(PREDEFINED_TT);
+		}
+		else if(TT != PREDEFINED_TT)
+		{
+			printf("\nError! The \"-TRAFFIC_FILE\" option can only be used with predefined traffic.\n");
+			printf("For details about the available options, type `./Adyton -help TRAFFIC_FILE' or `./Adyton -h TRAFFIC_FILE'.\n\n");
+			exit(EXIT_FAILURE);
+		}
+	}
+
+
 	/* Set the traffic load */
 	if(NP != NOTSET)
 	{
@@ -305,6 +331,39 @@ Settings *UserInteraction::getSettings(int argc, char *argv[])
 	}
 
 
+	/* Set the snapshot time */
+	if(SNAP != NOTSET)
+	{
+		Set->setSnapshotTime(SNAP);
+	}
+
+
+	/* Set the snapshot to restore the simulation from */
+	if(!restoreFile.empty())
+	{
+		Set->setRestoreFilename(restoreFile);
+	}
+
+
+	/* Set the number of threads */
+	if(THR != NOTSET)
+	{
+		Set->setThreads(THR);
+	}
+
+
+	/* Set the deterministic mode */
+	Set->setDeterministic(DTRM);
+
+
+	/* Set the delivery queue */
+	Set->setDeliveryQueue(DLVQ);
+
+
+	/* Set the early stop */
+	Set->setEarlyStop(ESTP);
+
+
 	/* Set the batch mode */
 	Set->setBatchmode(BTCH);
 
@@ -588,6 +647,119 @@ void UserInteraction::ParseArgs(char *com, char *option, char *value)
 			exit(EXIT_FAILURE);
 		}
 	}
+	else if(!flag.compare("-TRAFFIC_FILE"))
+	{
+		if(!includedTrafficFile && (access(value, F_OK) == 0))
+		{
+			trafficFile.assign(value);
+			includedTrafficFile = true;
+		}
+		else
+		{
+			printf("\nError! Invalid value for the \"-TRAFFIC_FILE\" option: %s\n", value);
+			printf("For details about the available options, type `./Adyton -help TRAFFIC_FILE' or `./Adyton -h TRAFFIC_FILE'.\n\n");
+			exit(EXIT_FAILURE);
+		}
+	}
+	else if(!flag.compare("-SNAPSHOT"))
+	{
+		if((SNAP == NOTSET) && (atof(value) > 0.0))
+		{
+			SNAP = atof(value);
+		}
+		else
+		{
+			printf("\nError! Invalid value for the \"-SNAPSHOT\" option: %s\n", value);
+			printf("For details about the available options, type `./Adyton -help SNAPSHOT' or `./Adyton -h SNAPSHOT'.\n\n");
+			exit(EXIT_FAILURE);
+		}
+	}
+	else if(!flag.compare("-RESTORE"))
+	{
+		if(restoreFile.empty() && (access(value, F_OK) == 0))
+		{
+			restoreFile.assign(value);
+		}
+		else
+		{
+			printf("\nError! Invalid value for the \"-RESTORE\" option: %s\n", value);
+			printf("For details about the available options, type `./Adyton -help RESTORE' or `./Adyton -h RESTORE'.\n\n");
+			exit(EXIT_FAILURE);
+		}
+	}
+	else if(!flag.compare("-THREADS"))
+	{
+		if((THR == NOTSET) && (atoi(value) > 0))
+		{
+			THR = atoi(value);
+		}
+		else
+		{
+			printf("\nError! Invalid value for the \"-THREADS\" option: %s\n", value);
+			printf("For details about the available options, type `./Adyton -help THREADS' or `./Adyton -h THREADS'.\n\n");
+			exit(EXIT_FAILURE);
+		}
+	}
+	else if(!flag.compare("-DETERMINISTIC"))
+	{
+		string tmp(value);
+		transform(tmp.begin(), tmp.end(), tmp.begin(), ::toupper);
+
+		if(!tmp.compare("ON"))
+		{
+			DTRM = true;
+		}
+		else if(!tmp.compare("OFF"))
+		{
+			DTRM = false;
+		}
+		else
+		{
+			printf("\nError! Invalid value for the \"-DETERMINISTIC\" option: %s\n", value);
+			printf("For details about the available options, type `./Adyton -help DETERMINISTIC' or `./Adyton -h DETERMINISTIC'.\n\n");
+			exit(EXIT_FAILURE);
+		}
+	}
+	else if(!flag.compare("-DELIVERY_QUEUE"))
+	{
+		string tmp(value);
+		transform(tmp.begin(), tmp.end(), tmp.begin(), ::toupper);
+
+		if(!tmp.compare("ON"))
+		{
+			DLVQ = true;
+		}
+		else if(!tmp.compare("OFF"))
+		{
+			DLVQ = false;
+		}
+		else
+		{
+			printf("\nError! Invalid value for the \"-DELIVERY_QUEUE\" option: %s\n", value);
+			printf("For details about the available options, type `./Adyton -help DELIVERY_QUEUE' or `./Adyton -h DELIVERY_QUEUE'.\n\n");
+			exit(EXIT_FAILURE);
+		}
+	}
+	else if(!flag.compare("-EARLY_STOP"))
+	{
+		string tmp(value);
+		transform(tmp.begin(), tmp.end(), tmp.begin(), ::toupper);
+
+		if(!tmp.compare("ON"))
+		{
+			ESTP = true;
+		}
+		else if(!tmp.compare("OFF"))
+		{
+			ESTP = false;
+		}
+		else
+		{
+			printf("\nError! Invalid value for the \"-EARLY_STOP\" option: %s\n", value);
+			printf("For details about the available options, type `./Adyton -help EARLY_STOP' or `./Adyton -h EARLY_STOP'.\n\n");
+			exit(EXIT_FAILURE);
+		}
+	}
 	else if(!flag.compare("-RES_DIR"))
 	{
 		if(!modifiedResDir)
@@ -1939,6 +2111,55 @@ void UserInteraction::printDetails(string param)
 		printf("Adyton supports per protocol parameterization through the -PROFILE argument. Similar to the basic parameterization, the -PROFILE argument is given at the command line after the Adyton execulable. After the -PROFILE argument the full system path pointing to a text file follows. This text file contains the additional per protocol parameters represented in a two column format. The first column is used for the parameter’s ID, while the second column is used for the corresponding value. The two columns must be separated using a tab or a space delimiter.\n");
 		printf("More information can be found at 'doc/'.\n\n");
 	}
+	else if(!param.compare("-TRAFFIC_FILE") || !param.compare("TRAFFIC_FILE"))
+	{
+		printf("+-------------------------+\n");
+		printf("| -TRAFFIC_FILE parameter |\n");
+		printf("+-------------------------+\n");
+		printf("Name of the file that holds the packets of the predefined traffic (implies -TRAFFIC_TYPE PREDEFINED). Each line of a text traffic file contains the creation time, the source and the destination of a packet. Large traffic files can be converted to a compact binary format with the converter in 'utils/traffic-scenarios/'. Packets are read from the file while the simulation runs, so files sorted by creation time are not loaded into memory.\n\n");
+	}
+	else if(!param.compare("-SNAPSHOT") || !param.compare("SNAPSHOT"))
+	{
+		printf("+---------------------+\n");
+		printf("| -SNAPSHOT parameter |\n");
+		printf("+---------------------+\n");
+		printf("Simulation time (in seconds) at which the complete state of the simulation is saved to the file 'Snapshot_<time>.bin' of the results directory. The simulation continues normally after the snapshot is saved. Snapshots are supported by the Direct Delivery, Epidemic, Optimal (flood engine), PRoPHET, SimBet, SimBetTS, BubbleRap, and Spray and Wait routing protocols (SimBet and SimBetTS without contact aggregation), with no congestion control mechanism and with every deletion mechanism except Vaccine. Output type 5 is not supported. Other combinations are rejected before the simulation starts.\n\n");
+	}
+	else if(!param.compare("-RESTORE") || !param.compare("RESTORE"))
+	{
+		printf("+--------------------+\n");
+		printf("| -RESTORE parameter |\n");
+		printf("+--------------------+\n");
+		printf("Name of a snapshot file (see -SNAPSHOT) to resume the simulation from. All the other parameters must be the same as the ones of the simulation that saved the snapshot (including -SEED), so that the resumed simulation produces the same results as an uninterrupted one.\n\n");
+	}
+	else if(!param.compare("-THREADS") || !param.compare("THREADS"))
+	{
+		printf("+--------------------+\n");
+		printf("| -THREADS parameter |\n");
+		printf("+--------------------+\n");
+		printf("Number of threads that simulate the events of the same time instant (default: 1). The events of a time instant are divided into groups of nodes that cannot reach each other during that instant, and each group is simulated by a different thread. Not supported by Optimal Routing, output type 5, and (in deterministic mode) the Cataclysm deletion mechanism.\n\n");
+	}
+	else if(!param.compare("-DETERMINISTIC") || !param.compare("DETERMINISTIC"))
+	{
+		printf("+--------------------------+\n");
+		printf("| -DETERMINISTIC parameter |\n");
+		printf("+--------------------------+\n");
+		printf("Produce exactly the same results as a single thread when -THREADS is larger than 1 (on/off, default: on). When off, the identifiers of the generated packets depend on the order the threads create them.\n\n");
+	}
+	else if(!param.compare("-DELIVERY_QUEUE") || !param.compare("DELIVERY_QUEUE"))
+	{
+		printf("+---------------------------+\n");
+		printf("| -DELIVERY_QUEUE parameter |\n");
+		printf("+---------------------------+\n");
+		printf("Deliver the packets that are transmitted at the current time instant through a queue instead of the event list (on/off, default: off). The results are the same, but fewer events are created. Not supported when -THREADS is larger than 1.\n\n");
+	}
+	else if(!param.compare("-EARLY_STOP") || !param.compare("EARLY_STOP"))
+	{
+		printf("+-----------------------+\n");
+		printf("| -EARLY_STOP parameter |\n");
+		printf("+-----------------------+\n");
+		printf("Stop the simulation before the end of the contact trace once no packet can change state, i.e. all the packets have been created and no node stores a packet (on/off, default: on). The results are the same. Output type 5, Optimal Routing with the oracle, the protocols that count skipped handshakes (Epidemic, Spray and Wait, MSF Spray and EBR), and simulations that save a snapshot always run until the end of the trace.\n\n");
+	}
 	else if(!param.compare("-RES_DIR") || !param.compare("RES_DIR"))
 	{
 		printf("+--------------------+\n");
@@ -45,7 +45,10 @@ private:
 	string profileName;		/* filename (and path) of the file that contains extra attributes */
 	string resDir;			/* name of the directory that will store the results of the simulation */
 	string trcDir;			/* name of the directory that stores the contact trace files. */
+	string trafficFile;		/* filename (and path) of the predefined traffic file */
+	string restoreFile;		/* filename (and path) of the snapshot to restore the simulation from */
 	bool includedProfile;
+	bool includedTrafficFile;
 	bool modifiedResDir;
 	bool modifiedTrcDir;
 
@@ -63,6 +66,12 @@ private:
 	int REP;			/* replication number */
 	long int SPLIT;		/* number of pieces to split the contact trace file */
 	int SEED;			/* seed number */
+	double SNAP;		/* time at which a snapshot of the simulation is saved */
+	int THR;			/* number of threads */
+
+	bool DTRM;			/* if true reproduce the results of a single thread */
+	bool DLVQ;			/* if true deliver the transmissions of the current time instant without the event list */
+	bool ESTP;			/* if true stop the simulation once no packet can change state */
 
 	bool BTCH;			/* if true avoid printing results */
 	bool GUI;
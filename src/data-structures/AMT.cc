@@ -56,6 +56,7 @@ AMT::AMT(int ID,int NodeSize): Utility(ID,NodeSize)
 		this->AMTval[i] = 0.0;
 		this->Ncontacts[i] = 0;
 	}
+	this->Published = NULL;
 
 	return;
 }
@@ -63,6 +64,11 @@ AMT::AMT(int ID,int NodeSize): Utility(ID,NodeSize)
 
 AMT::~AMT()
 {
+	detachView();
+	if(this->Published != NULL)
+	{
+		releaseView(this->Published);
+	}
 	free(Ncontacts);
 	free(ActiveContacts);
 	free(TotalAMT);
@@ -111,6 +117,7 @@ void AMT::ContactDown(int ID, double CurrentTime)
 		return;
 	}
 
+	detachView();
 	diff = CurrentTime - this->ContactStart[ID];
 	this->TotalAMT[ID] += diff;
 	this->Ncontacts[ID]++;
@@ -237,3 +244,68 @@ double* AMT::getAverageDurations()
 
 	return avgDuration;
 }
+
+
+AMTView *AMT::getView(void)
+{
+	if(this->Published == NULL)
+	{
+		this->Published = (AMTView *) malloc(sizeof(AMTView));
+		this->Published->Refs = 1; /* held by this node */
+		this->Published->Detached = false;
+		this->Published->Ncontacts = this->Ncontacts;
+		this->Published->AMTval = this->AMTval;
+	}
+
+	this->Published->Refs++;
+
+	return this->Published;
+}
+
+
+void AMT::releaseView(AMTView *view)
+{
+	view->Refs--;
+	if(view->Refs == 0)
+	{
+		if(view->Detached)
+		{
+			free(view->Ncontacts);
+			free(view->AMTval);
+		}
+		free(view);
+	}
+
+	return;
+}
+
+
+void AMT::detachView(void)
+{
+	int i;
+	int *contacts;
+	double *durations;
+
+
+	//the metrics are about to change: a view that is still held by another node keeps a copy of them
+	if(this->Published == NULL || this->Published->Refs == 1)
+	{
+		return;
+	}
+
+	contacts = (int *) malloc(NSize * sizeof(int));
+	durations = (double *) malloc(NSize * sizeof(double));
+	for(i = 0; i < NSize; i++)
+	{
+		contacts[i] = this->Ncontacts[i];
+		durations[i] = this->AMTval[i];
+	}
+	this->Published->Ncontacts = contacts;
+	this->Published->AMTval = durations;
+	this->Published->Detached = true;
+
+	releaseView(this->Published);
+	this->Published = NULL;
+
+	return;
+}
@@ -30,6 +30,21 @@
 	#include "Utility.h"
 #endif
 
+/* AMTView
+ * -------
+ * Read-only view of the number of contacts and the average meeting times of a node
+ * that is shared with the nodes it meets. The view refers to the arrays of the node
+ * until the node updates them while the view is still held by another node. Then,
+ * the view gets its own copy of the arrays (copy-on-write).
+ */
+struct AMTView
+{
+	int Refs;
+	bool Detached;
+	int *Ncontacts;
+	double *AMTval;
+};
+
 class AMT:public Utility
 {
 protected:
@@ -38,6 +53,9 @@ protected:
 	double *ContactStart;
 	int *Ncontacts;
 	int *ActiveContacts;
+	AMTView *Published;
+
+	void detachView(void);
 public:
 	AMT(int ID,int NodeSize);
 	~AMT();
@@ -53,4 +71,6 @@ public:
 	double* getFriendshipIndices(double CurrentTime);
 	double getAMTval(int NID);
 	double* getAverageDurations();
+	AMTView *getView(void);
+	static void releaseView(AMTView *view);
 };
@@ -157,3 +157,17 @@ double ASP::getTimeDisconnected(int ID, double CurrentTime)
 		return CurrentTime - this->lastSeparationTime[ID];
 	}
 }
+
+
+void ASP::Checkpoint(Snapshot *snap)
+{
+	snap->Section("ASP ");
+	snap->Match(this->NSize, "number of nodes");
+	snap->Array(this->numGaps, this->NSize);
+	snap->Array(this->activeContacts, this->NSize);
+	snap->Array(this->lastSeparationTime, this->NSize);
+	snap->Array(this->totalASP, this->NSize);
+	snap->Array(this->aspValue, this->NSize);
+
+	return;
+}
@@ -30,6 +30,11 @@
 	#include "Utility.h"
 #endif
 
+#ifndef SNAPSHOT_H
+	#define SNAPSHOT_H
+	#include "../core/Snapshot.h"
+#endif
+
 class ASP:public Utility
 {
 protected:
@@ -48,4 +53,5 @@ public:
 	virtual void ContactDown(int ID, double CurrentTime);
 	double getActualASP(int ID, double CurrentTime);
 	double getTimeDisconnected(int ID, double CurrentTime);
+	void Checkpoint(Snapshot *snap);
 };
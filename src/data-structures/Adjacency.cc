@@ -132,6 +132,10 @@ void Adjacency::init(int ID,int NodeSize,int AggregationType,double argument)
 		Nodes[i].resize(NodeSize);
 		Nodes[i].reset();
 	}
+	this->RowBlocks = (int) Nodes[this->NodeID].num_blocks();
+	this->KernelRow.resize(this->RowBlocks);
+	this->KernelMask.resize(this->RowBlocks);
+	this->KernelIDs.resize(NodeSize);
 	
 	switch(AggregationType)
 	{
@@ -219,26 +223,15 @@ void Adjacency::SetConnection(int Node1, int Node2, double ConTime)
 
 int *Adjacency::GetMyContacts()
 {
-	unsigned int i;
-	int runner;
 	int EgoN;
 	int *Contacts;
 
 
-	dynamic_bitset<> MyN(Nodes[this->NodeID]);
-	EgoN = MyN.count();
+	const unsigned long *MyRow = RowWords(Nodes[this->NodeID], &(this->KernelRow[0]));
+	EgoN = BitCount(MyRow, this->RowBlocks);
 	Contacts = (int *) malloc((EgoN + 1) * sizeof(int));
 	Contacts[0] = EgoN;
-	
-	runner = 1;
-	for(i = 0; i < MyN.size(); i++)
-	{
-		if(MyN.test(i))
-		{
-			Contacts[runner] = i;
-			runner++;
-		}
-	}
+	SetBits(MyRow, this->RowBlocks, &(Contacts[1]));
 
 	return Contacts;
 }
@@ -527,67 +520,74 @@ double Adjacency::GetLSFUtility(int ID,double CurrentTime)
 }
 
 
+/* LoadRows
+ * --------
+ * Copies the rows of the nodes in IDs to the scratch rows, starting from row "first", and
+ * returns the first of them. The scratch rows are allocated once for all the nodes (plus
+ * two), so earlier pointers to them remain valid.
+ */
+unsigned long *Adjacency::LoadRows(const int *IDs,int num,int first)
+{
+	if(this->KernelRows.empty())
+	{
+		this->KernelRows.resize((this->NSize+2)*this->RowBlocks);
+	}
+	for(int i=0;i<num;i++)
+	{
+		RowWords(Nodes[IDs[i]],&(this->KernelRows[(first+i)*this->RowBlocks]));
+	}
+	return &(this->KernelRows[first*this->RowBlocks]);
+}
+
+
 int Adjacency::CalculateSimilarity(int toDestination)
 {
-	dynamic_bitset<> DestN(Nodes[toDestination]);
-	
 	#ifdef ADJ_DEBUG
 	printf("Destination's(%d) bit set:",toDestination);
-	PrintBitSet(DestN);
+	PrintBitSet(Nodes[toDestination]);
 	printf("My(%d) bit set:",this->NodeID);
 	PrintBitSet(Nodes[this->NodeID]);
 	#endif
 	
-	DestN&=Nodes[this->NodeID];
+	int common=AndCount(RowWords(Nodes[toDestination],&(this->KernelRow[0])),RowWords(Nodes[this->NodeID],&(this->KernelMask[0])),this->RowBlocks);
 	
 	#ifdef ADJ_DEBUG
-	printf("Result of AND:");
-	PrintBitSet(DestN);
-	printf("Similarity value:%d\n",DestN.count());
+	printf("Similarity value:%d\n",common);
 	#endif
 	
-	return DestN.count();
+	return common;
 }
 
 int Adjacency::CalculateDisSimilarity(int toDestination)
 {
-	dynamic_bitset<> myTotal(Nodes[this->NodeID]);
+	const int bits=dynamic_bitset<>::bits_per_block;
+	unsigned long *myTotal=RowWords(Nodes[this->NodeID],&(this->KernelRow[0]));
+	unsigned long *row=&(this->KernelMask[0]);
+	int *participants=&(this->KernelIDs[0]);
 	
-	for(unsigned int i=0;i<Nodes[this->NodeID].size();i++)
+	//Union of my contacts and the contacts of my contacts (except for the destination)
+	int pnumber=SetBits(myTotal,this->RowBlocks,participants);
+	for(int i=0;i<pnumber;i++)
 	{
-		if((Nodes[this->NodeID].test(i)) && (i != (unsigned int) toDestination))
+		if(participants[i] != toDestination)
 		{
-			//printf("1-hop:%d\n",i);
-			dynamic_bitset<> indirect(Nodes[i]);
-			myTotal|=indirect;
+			OrInto(myTotal,RowWords(Nodes[participants[i]],row),this->RowBlocks);
 		}
 	}
-	myTotal[this->NodeID].flip();
-	myTotal[toDestination].flip();
-	int myContacts=(int)myTotal.count();
-	dynamic_bitset<> DestContacts(Nodes[toDestination]);
-	myTotal&=DestContacts;
-	int common=(int)myTotal.count();
-	int dissimilar=myContacts-common;
-	return dissimilar;
+	myTotal[this->NodeID/bits]^=(1UL<<(this->NodeID%bits));
+	myTotal[toDestination/bits]^=(1UL<<(toDestination%bits));
+	//Nodes of the union that are not contacts of the destination
+	return AndNotCount(myTotal,RowWords(Nodes[toDestination],row),this->RowBlocks);
 }
 
 
 void Adjacency::UpdateBetweenness(void)
 {
-	int EgoNeighbors=Nodes[this->NodeID].count()+1;
 	//Who are the participating nodes
 	//Find 1-hop contacts and copy their ids in a matrix called paricipants
-	int runner=0;
-	int *participants=(int *)malloc(sizeof(int)*(EgoNeighbors-1));
-	for(unsigned int i=0;i<Nodes[this->NodeID].size();i++)
-	{
-		if(Nodes[this->NodeID].test(i))
-		{
-			participants[runner]=i;
-			runner++;
-		}
-	}
+	int *participants=&(this->KernelIDs[0]);
+	int EgoNeighbors=SetBits(RowWords(Nodes[this->NodeID],&(this->KernelRow[0])),this->RowBlocks,participants)+1;
+	const unsigned long *Rows=LoadRows(participants,EgoNeighbors-1,0);
 	
 	#ifdef ADJ_DEBUG
 	printf("My(%d) bit set:",this->NodeID);
@@ -606,7 +606,7 @@ void Adjacency::UpdateBetweenness(void)
 	int paths=0;
 	for(int i=0;i<(EgoNeighbors-1);i++)
 	{
-		dynamic_bitset<> Dest(Nodes[participants[i]]);
+		const unsigned long *Dest=Rows+i*this->RowBlocks;
 		for(int j=i+1;j<(EgoNeighbors-1);j++)
 		{
 			paths=0;
@@ -619,9 +619,7 @@ void Adjacency::UpdateBetweenness(void)
 				continue;
 			}
 			
-			dynamic_bitset<> Source(Nodes[participants[j]]);
-			Source&=Dest;
-			paths=Source.count();
+			paths=AndCount(Rows+j*this->RowBlocks,Dest,this->RowBlocks);
 			#ifdef ADJ_DEBUG
 			printf("From %d to %d path number is %d\n",participants[i],participants[j],paths);
 			#endif
@@ -633,31 +631,22 @@ void Adjacency::UpdateBetweenness(void)
 		}
 	}
 	this->Bet=sum;
-	//free memory
-	free(participants);
 	return;
 }
 
 void Adjacency::UpdateEfficiency(void )
 {
-	int EgoNeighbors=Nodes[this->NodeID].count();
+	//Who are the participating nodes
+	//Find 1-hop contacts and copy their ids in a matrix called paricipants
+	const unsigned long *MyDirect=RowWords(Nodes[this->NodeID],&(this->KernelRow[0]));
+	int *participants=&(this->KernelIDs[0]);
+	int EgoNeighbors=SetBits(MyDirect,this->RowBlocks,participants);
 	if(!EgoNeighbors)
 	{
 		this->Effi=0.0;
 		return;
 	}
-	//Who are the participating nodes
-	//Find 1-hop contacts and copy their ids in a matrix called paricipants
-	int runner=0;
-	int *participants=(int *)malloc(sizeof(int)*EgoNeighbors);
-	for(unsigned int i=0;i<Nodes[this->NodeID].size();i++)
-	{
-		if(Nodes[this->NodeID].test(i))
-		{
-			participants[runner]=i;
-			runner++;
-		}
-	}
+	const unsigned long *Rows=LoadRows(participants,EgoNeighbors,0);
 	#ifdef ADJ_DEBUG
 	printf("I have %d direct contacts\n",EgoNeighbors);
 	#endif
@@ -665,10 +654,7 @@ void Adjacency::UpdateEfficiency(void )
 	double total=0.0;
 	for(int i=0;i<EgoNeighbors;i++)
 	{
-		dynamic_bitset<> MyDirect(Nodes[this->NodeID]);
-		dynamic_bitset<> InvDirect(Nodes[participants[i]]);
-		MyDirect&=InvDirect;
-		redundancy=MyDirect.count();
+		redundancy=AndCount(MyDirect,Rows+i*this->RowBlocks,this->RowBlocks);
 		#ifdef ADJ_DEBUG
 		printf("Redundancy with node %d is %d/%d\n",participants[i],redundancy,EgoNeighbors);
 		#endif
@@ -681,7 +667,6 @@ void Adjacency::UpdateEfficiency(void )
 	printf("Efficiency size is %f\n",effSize);
 	printf("Efficiency is %f\n",efficiency);
 	#endif
-	free(participants);
 	this->Effi=efficiency;
 	return;
 }
@@ -696,119 +681,80 @@ double Adjacency::getCopEffi(int nodeA, int nodeB)
 		//printf("getCopEffi error:The two nodes are not in contact!\n");
 		return -1.0;
 	}
-	//calculate the denominator
-	dynamic_bitset<> DirectB(Nodes[nodeB]);
-	dynamic_bitset<> U(Nodes[nodeA]);
-	U|=DirectB;
-	int denominator=U.count()-2;
+	const int bits=dynamic_bitset<>::bits_per_block;
+	int ends[2]={nodeA,nodeB};
+	const unsigned long *DirectA=LoadRows(ends,2,0);
+	const unsigned long *DirectB=DirectA+this->RowBlocks;
+	const unsigned long *Rows=NULL;
+	unsigned long *U=&(this->KernelRow[0]);
+	unsigned long *inquiry=&(this->KernelMask[0]);
+	int *participants=&(this->KernelIDs[0]);
 	
-	int pnumber=0;
-	int runner=0;
-	int *participants=NULL;
+	//calculate the denominator
+	copy(DirectA,DirectA+this->RowBlocks,U);
+	OrInto(U,DirectB,this->RowBlocks);
+	int denominator=BitCount(U,this->RowBlocks)-2;
 	
 	//get common direct contacts
-	dynamic_bitset<> inquiryCommon(Nodes[nodeA]);
-	inquiryCommon&=DirectB;
-	pnumber=inquiryCommon.count();
-	participants=(int *)malloc(sizeof(int)*pnumber);
-	runner=0;
+	AndInto(inquiry,DirectA,DirectB,this->RowBlocks);
+	int pnumber=SetBits(inquiry,this->RowBlocks,participants);
 	#ifdef ADJ_DEBUG
 	printf("Common direct contacts: ");
-	#endif
-	for(unsigned int i=0;i<inquiryCommon.size();i++)
+	for(int i=0;i<pnumber;i++)
 	{
-		if(inquiryCommon.test(i))
-		{
-			#ifdef ADJ_DEBUG
-			printf("%d\t",i);
-			#endif
-			participants[runner]=i;
-			runner++;
-		}
+		printf("%d\t",participants[i]);
 	}
-	#ifdef ADJ_DEBUG
 	printf("\n");
 	#endif
 	//calculate the redundancy
 	int redundancy=0;
 	double total=0.0;
+	Rows=LoadRows(participants,pnumber,2);
 	for(int i=0;i<pnumber;i++)
 	{
-		dynamic_bitset<> nodeCheck(Nodes[participants[i]]);
-		nodeCheck&=U;
-		redundancy=nodeCheck.count();
+		redundancy=AndCount(Rows+i*this->RowBlocks,U,this->RowBlocks);
 		#ifdef ADJ_DEBUG
 		printf("Redundancy with node %d is %d/%d\n",participants[i],redundancy,denominator);
 		#endif
 		total+=((double)redundancy/(double)denominator);
 	}
 	//get direct contacts for nodeA excluding the common direct contacts with nodeB
-	dynamic_bitset<> inquiryOnlyNodeA(Nodes[nodeA]);
-	inquiryOnlyNodeA.flip(nodeB);
-	inquiryOnlyNodeA^=inquiryCommon;
-	pnumber=inquiryOnlyNodeA.count();
-	free(participants);
-	participants=(int *)malloc(sizeof(int)*pnumber);
-	runner=0;
+	AndNotInto(inquiry,DirectA,DirectB,this->RowBlocks);
+	inquiry[nodeB/bits]^=(1UL<<(nodeB%bits));
+	pnumber=SetBits(inquiry,this->RowBlocks,participants);
 	#ifdef ADJ_DEBUG
 	printf("Only node %d direct contacts: ",nodeA);
-	#endif
-	for(unsigned int i=0;i<inquiryOnlyNodeA.size();i++)
+	for(int i=0;i<pnumber;i++)
 	{
-		if(inquiryOnlyNodeA.test(i))
-		{
-			#ifdef ADJ_DEBUG
-			printf("%d\t",i);
-			#endif
-			participants[runner]=i;
-			runner++;
-		}
+		printf("%d\t",participants[i]);
 	}
-	#ifdef ADJ_DEBUG
 	printf("\n");
 	#endif
-	redundancy=0.0;
+	Rows=LoadRows(participants,pnumber,2);
 	for(int i=0;i<pnumber;i++)
 	{
-		dynamic_bitset<> nodeCheck(Nodes[participants[i]]);
-		nodeCheck&=U;
-		redundancy=nodeCheck.count()-1;
+		redundancy=AndCount(Rows+i*this->RowBlocks,U,this->RowBlocks)-1;
 		#ifdef ADJ_DEBUG
 		printf("Redundancy with node %d is %d/%d\n",participants[i],redundancy,denominator);
 		#endif
 		total+=((double)redundancy/(double)denominator);
 	}
 	//get direct contacts for nodeB excluding the common direct contacts with nodeA
-	dynamic_bitset<> inquiryOnlyNodeB(Nodes[nodeB]);
-	inquiryOnlyNodeB.flip(nodeA);
-	inquiryOnlyNodeB^=inquiryCommon;
-	pnumber=inquiryOnlyNodeB.count();
-	free(participants);
-	participants=(int *)malloc(sizeof(int)*pnumber);
-	runner=0;
+	AndNotInto(inquiry,DirectB,DirectA,this->RowBlocks);
+	inquiry[nodeA/bits]^=(1UL<<(nodeA%bits));
+	pnumber=SetBits(inquiry,this->RowBlocks,participants);
 	#ifdef ADJ_DEBUG
 	printf("Only node %d direct contacts: ",nodeB);
-	#endif
-	for(unsigned int i=0;i<inquiryOnlyNodeB.size();i++)
+	for(int i=0;i<pnumber;i++)
 	{
-		if(inquiryOnlyNodeB.test(i))
-		{
-			#ifdef ADJ_DEBUG
-			printf("%d\t",i);
-			#endif
-			participants[runner]=i;
-			runner++;
-		}
+		printf("%d\t",participants[i]);
 	}
-	#ifdef ADJ_DEBUG
 	printf("\n");
 	#endif
-	redundancy=0.0;
+	Rows=LoadRows(participants,pnumber,2);
 	for(int i=0;i<pnumber;i++)
 	{
-		dynamic_bitset<> nodeCheck(Nodes[participants[i]]);
-		nodeCheck&=U;
-		redundancy=nodeCheck.count()-1;
+		redundancy=AndCount(Rows+i*this->RowBlocks,U,this->RowBlocks)-1;
 		#ifdef ADJ_DEBUG
 		printf("Redundancy with node %d is %d/%d\n",participants[i],redundancy,denominator);
 		#endif
@@ -824,8 +770,6 @@ double Adjacency::getCopEffi(int nodeA, int nodeB)
 	return efficiency;
 }
 
-
-
 void Adjacency::UpdateSimilarity(int Dest)
 {
 	if(Dest == this->NodeID)
@@ -1725,1805 +1669,325 @@ bool IsNew(DrawCandidate *Can)
 }
 
 
-int *Adjacency::GetForwardingSet(int *oldFWs,int prev)
+/* PrepareCover
+ * ------------
+ * Builds the set cover problem solved by the dominant pruning forwarding sets. The candidate
+ * forwarders (CoverCon) are my direct contacts and the nodes that must be covered (CoverLeft)
+ * are the 2-hop contacts reachable through them, excluding me, my direct contacts and the
+ * previous hops. The options further exclude old forwarders (and their neighbors), the
+ * contacts that I share with the previous hops, the previous hops themselves and the
+ * neighbors of the previous hops. All operations are performed on whole words.
+ */
+void Adjacency::PrepareCover(int *oldFWs,int *prev,int Options)
 {
-	vector<DrawCandidate*> Draw;
-	//Take 2-Hop contacts
-	dynamic_bitset<> DirectContacts(Nodes[this->NodeID]);
-	dynamic_bitset<> InDirectContacts(Nodes[this->NodeID]);
-	dynamic_bitset<> tmp(Nodes[this->NodeID]);
-	InDirectContacts.reset();
-	tmp.reset();
+	const int bits=dynamic_bitset<>::bits_per_block;
+	int NW=(int)Nodes[this->NodeID].num_blocks();
+	unsigned long *row=NULL;
+
+
+	this->CoverWords=NW;
+	this->CoverMatrix.resize(NW*this->NSize);
+	for(int i=0;i<this->NSize;i++)
+	{
+		to_block_range(Nodes[i],this->CoverMatrix.begin()+i*NW);
+	}
+	unsigned long *M=&(this->CoverMatrix[0]);
+	this->CoverDirect.assign(M+this->NodeID*NW,M+(this->NodeID+1)*NW);
+	unsigned long *D=&(this->CoverDirect[0]);
 	
-	//Get common neighbors with prev
-	int *common=(int *)malloc(sizeof(int));
-	common[0]=0;
-	int pos=0;
-	if(prev != this->NodeID)
+	//Contacts that I share with the previous hops
+	if(Options & COVER_EXCLUDE_COMMON)
 	{
-		for(int i=0;i<(int) DirectContacts.size();i++)
+		this->CoverCommon.assign(NW,0UL);
+		for(int j=1;j<=prev[0];j++)
 		{
-			if(DirectContacts.test(i) && Nodes[prev].test(i))
+			if(prev[j] != this->NodeID)
 			{
-				pos++;
-				common=(int *)realloc(common,sizeof(int)*(pos+1));
-				common[pos]=i;
-				common[0]=pos;
+				row=M+prev[j]*NW;
+				for(int w=0;w<NW;w++)
+				{
+					this->CoverCommon[w]|=D[w] & row[w];
+				}
 			}
 		}
 	}
-	//Construct indirect contacts
-	int ConSize=0;
-	int *Con=NULL;
-	for(int i=0;i<(int)DirectContacts.size();i++)
+	if(Options & COVER_EXCLUDE_OLD)
 	{
-		if(DirectContacts.test(i)) //&& !IsInside(i,common))
-		{
-			ConSize++;
-			Con=(int *)realloc(Con,sizeof(int)*(ConSize));
-			Con[ConSize-1]=i;
-			InDirectContacts|=Nodes[i];
-		}
-		else
+		for(int j=1;j<=oldFWs[0];j++)
 		{
-			DirectContacts.set(i,false);
+			D[oldFWs[j] / bits]&=~(1UL << (oldFWs[j] % bits));
 		}
 	}
-	//Remove myself from Indirect contacts
-	InDirectContacts.set(this->NodeID,false);
-	//Also, remove direct contacts
-	for(int i=0;i<(int)DirectContacts.size();i++)
+	if(Options & COVER_EXCLUDE_PREV)
 	{
-		if(DirectContacts.test(i))
+		for(int j=1;j<=prev[0];j++)
 		{
-			InDirectContacts.set(i,false);
+			D[prev[j] / bits]&=~(1UL << (prev[j] % bits));
 		}
 	}
-	//Remove prev hop from Indirect contacts
-	InDirectContacts.set(prev,false);
- 	#ifdef ADJ_DEBUG
-	printf("Common Contacts:");
-	for(int i=1;i<=common[0];i++)
+	if(Options & COVER_EXCLUDE_COMMON)
 	{
-		printf("%d\t",common[i]);
+		for(int w=0;w<NW;w++)
+		{
+			D[w]&=~(this->CoverCommon[w]);
+		}
 	}
-	printf("\n");
-	printf("Direct Contacts:");
-	PrintSet(&DirectContacts);
-	printf("Indirect Contacts:");
-	PrintSet(&InDirectContacts);
-	#endif
-	int which=-1;
-	int HowMany=-1;
-	int *forwarders=(int *)malloc(sizeof(int));
-	forwarders[0]=0;
-	int *Candidates=(int *)malloc(sizeof(int)*ConSize);
-	int position=0;
-	//printf("Node %d running GSC!\n",this->NodeID);
-	//printf("-------------------------\n");
-	while(!InDirectContacts.none())
+	
+	//Candidate forwarders and the nodes they reach
+	this->CoverCon.clear();
+	this->CoverLeft.assign(NW,0UL);
+	unsigned long *L=&(this->CoverLeft[0]);
+	for(int w=0;w<NW;w++)
 	{
-		//reset candidates
-		//printf("Candidates:");
-		for(int i=0;i<ConSize;i++)
- 		{
-			//printf("%d\t",Con[i]);
-			Candidates[i]=0;
-		}
-		//printf("\n");
-		which=-1;
-		HowMany=-1;
-		for(int i=0;i<ConSize;i++)
- 		{
-			if(Con[i] == -1)
-			{
-				continue;
-			}
-			tmp.reset();
-			tmp=Nodes[Con[i]] & InDirectContacts;
-			#ifdef ADJ_DEBUG
-			printf("Nodes that Node %d covers are: ",Con[i]);
-			PrintSet(&tmp);
-			#endif
-			//Keep track of draws
-			Candidates[i]=(int)tmp.count();
-			if(HowMany < (int)tmp.count())
+		unsigned long word=D[w];
+		while(word)
+		{
+			int i=w*bits+__builtin_ctzl(word);
+			word&=word-1;
+			this->CoverCon.push_back(i);
+			row=M+i*NW;
+			for(int k=0;k<NW;k++)
 			{
-				HowMany=(int)tmp.count();
-				which=i;
+				L[k]|=row[k];
 			}
-			#ifdef ADJ_DEBUG
-			printf("Number of Nodes  that Node %d covers is %d\n",Con[i],(int)tmp.count());
-			#endif
 		}
-		//Case of draw
-		#ifdef ADJ_DEBUG
-		printf("Checking draws..\n");
-		#endif
-		
-		//Create Draw Candidates
-		DrawCandidate *temp=NULL;
-		for(int i=0;i<ConSize;i++)
+	}
+	
+	//Remove myself, my direct contacts and the previous hops
+	L[this->NodeID / bits]&=~(1UL << (this->NodeID % bits));
+	for(int w=0;w<NW;w++)
+	{
+		L[w]&=~D[w];
+	}
+	for(int j=1;j<=prev[0];j++)
+	{
+		L[prev[j] / bits]&=~(1UL << (prev[j] % bits));
+	}
+	if(Options & COVER_EXCLUDE_OLD)
+	{
+		//Remove old forwarders and their neighbors
+		for(int j=1;j<=oldFWs[0];j++)
 		{
-			if(Candidates[i] == HowMany)
-			{
-				tmp.reset();
-				tmp=Nodes[Con[i]];
-				temp=new DrawCandidate(Con[i],Candidates[i],IsInside(Con[i],oldFWs),(int)tmp.count(),i);
-				Draw.push_back(temp);
-			}
+			L[oldFWs[j] / bits]&=~(1UL << (oldFWs[j] % bits));
 		}
-		//printf("Covered %d nodes\n",HowMany);
-		//PrintDraw(Draw);
-		
-		vector<DrawCandidate*>::iterator it;
-		//priority to newcomers
-		/*if(NotOldExists(Draw))
+		for(int j=1;j<=oldFWs[0];j++)
 		{
-			//At least one not-old-FWer exists in the candidate set
-			//Remove all old FWers (priority to newcomers)
-			vector<DrawCandidate*>::iterator it;
-			for ( it = Draw.begin(); it != Draw.end(); )
+			row=M+oldFWs[j]*NW;
+			for(int w=0;w<NW;w++)
 			{
-				if((*it)->IsOldFW)
-				{
-					delete * it;  
-					it = Draw.erase(it);
-				}
-				else 
-				{
-					++it;
-				}
+				L[w]&=~row[w];
 			}
-
-			//Draw.erase(std::remove_if(Draw.begin(),Draw.end(),IsOld), Draw.end());
-		}*/
-		
-		
-		//priority to old forwarders
-		if(OldExists(Draw))
+		}
+	}
+	if(Options & COVER_PREV_NEIGHBORS)
+	{
+		for(int j=1;j<=prev[0];j++)
 		{
-			//At least one old-FWer exists in the candidate set
-			//Remove all new FWers (priority to old FWers)
-			vector<DrawCandidate*>::iterator it;
-			for ( it = Draw.begin(); it != Draw.end(); )
+			row=M+prev[j]*NW;
+			for(int w=0;w<NW;w++)
 			{
-				if(!((*it)->IsOldFW))
-				{
-					delete *it;  
-					it = Draw.erase(it);
-				}
-				else 
-				{
-					++it;
-				}
+				L[w]&=~row[w];
 			}
-			//Draw.erase(std::remove_if(Draw.begin(),Draw.end(),IsNew), Draw.end());
-		}
-		
-		
-		//printf("Getting priority!!\n");
-		//Give priority to the one that has the best degree
-		which=GetHighestDegree(Draw);
-		
-		//Draw.clear();
-		for ( it = Draw.begin(); it != Draw.end(); )
-		{
-			delete *it;  
-			it = Draw.erase(it);
-			
 		}
-		//printf("\n");
-		#ifdef ADJ_DEBUG
-		printf("Node %d that covers %d wins!\n",Con[which],HowMany);
-		#endif
-		tmp.reset();
-		tmp=InDirectContacts & Nodes[Con[which]];
-		InDirectContacts^=tmp;
-		//if(!IsInside(Con[which],oldFWs))
-		//{
-			//Add node to forwarders
-			position++;
-			forwarders=(int *)realloc(forwarders,sizeof(int)*(position+1));
-			forwarders[position]=Con[which];
-			forwarders[0]=position;
-		//}
-		//printf("Node %d wins!\n",Con[which]);
-		Con[which]=-1;
-		#ifdef ADJ_DEBUG
-		printf("Indirect contacts now become: ");
-		PrintSet(&InDirectContacts);
-		#endif
 	}
-	free(Con);
-	free(common);
 	#ifdef ADJ_DEBUG
-	printf("The forwarders are %d:",forwarders[0]);
-	for(int i=1;i<=forwarders[0];i++)
+	printf("Candidate forwarders:");
+	for(unsigned int i=0;i<this->CoverCon.size();i++)
 	{
-		printf(" %d",forwarders[i]);
+		printf(" %d",this->CoverCon[i]);
 	}
 	printf("\n");
 	#endif
-	return forwarders;
+	return;
 }
 
-int *Adjacency::GetForwardingSet2(int *oldFWs,int prev)
+/* CoverGain
+ * ---------
+ * Returns the gain of selecting the candidate at position "pos" of CoverCon, given the
+ * nodes that are still uncovered.
+ */
+double Adjacency::CoverGain(int pos,CoverRules *Rules)
 {
-	vector<DrawCandidate*> Draw;
-	//Take 2-Hop contacts
-	dynamic_bitset<> DirectContacts(Nodes[this->NodeID]);
-	dynamic_bitset<> InDirectContacts(Nodes[this->NodeID]);
-	dynamic_bitset<> tmp(Nodes[this->NodeID]);
-	InDirectContacts.reset();
-	tmp.reset();
-	
-	//Get common neighbors with prev
-	int *common=(int *)malloc(sizeof(int));
-	common[0]=0;
-	int pos=0;
-	if(prev != this->NodeID)
+	if(Rules->Gain == COVER_GAIN_STATIC)
 	{
-		for(int i=0;i<(int)DirectContacts.size();i++)
-		{
-			if(DirectContacts.test(i) && Nodes[prev].test(i))
-			{
-				pos++;
-				common=(int *)realloc(common,sizeof(int)*(pos+1));
-				common[pos]=i;
-				common[0]=pos;
-			}
-		}
+		return Rules->StaticGain[pos];
 	}
-	//Remove old forwarders from direct contacts
-	for(int i=0;i<(int) DirectContacts.size();i++)
+	int NW=this->CoverWords;
+	unsigned long *row=&(this->CoverMatrix[this->CoverCon[pos]*NW]);
+	unsigned long *L=&(this->CoverLeft[0]);
+	int covered=0;
+	for(int w=0;w<NW;w++)
 	{
-		if(DirectContacts.test(i) && IsInside(i,oldFWs))
+		covered+=__builtin_popcountl(row[w] & L[w]);
+	}
+	if(Rules->Gain == COVER_GAIN_STRENGTH)
+	{
+		return this->NormalizedTieStrength(this->CoverCon[pos],Rules->Ctime)*(double)covered;
+	}
+	return (double)covered;
+}
+
+/* CoverTie
+ * --------
+ * Returns the key that breaks a draw between candidates with the same gain (the candidate
+ * with the highest key wins). Keys are computed once per set cover.
+ */
+double Adjacency::CoverTie(int pos,CoverRules *Rules)
+{
+	if(this->CoverTieKey[pos] >= 0.0)
+	{
+		return this->CoverTieKey[pos];
+	}
+	if(Rules->Tie == COVER_TIE_STRENGTH)
+	{
+		this->CoverTieKey[pos]=this->NormalizedTieStrength(this->CoverCon[pos],Rules->Ctime);
+	}
+	else
+	{
+		int NW=this->CoverWords;
+		unsigned long *row=&(this->CoverMatrix[this->CoverCon[pos]*NW]);
+		int degree=0;
+		for(int w=0;w<NW;w++)
 		{
-			DirectContacts.set(i,false);
+			degree+=__builtin_popcountl(row[w]);
 		}
+		this->CoverTieKey[pos]=(double)degree;
 	}
-	
-	//Construct indirect contacts
-	int ConSize=0;
-	int *Con=NULL;
-	for(int i=0;i<(int) DirectContacts.size();i++)
+	return this->CoverTieKey[pos];
+}
+
+/* GreedyCover
+ * -----------
+ * Greedy set cover over the problem built by PrepareCover(). In every round the candidate
+ * with the highest gain is selected. Draws are resolved (in order of node ID) by the rules:
+ * the first candidate wins if the best gain equals "FirstIfGain", otherwise old forwarders
+ * are preferred (when "OldFirst" is set) and then the highest tie key wins. Gains never
+ * increase while nodes get covered, so they are kept in a lazy priority queue and only the
+ * candidates that reach the top are re-evaluated. Returns the selected forwarders.
+ */
+int *Adjacency::GreedyCover(CoverRules *Rules)
+{
+	int NW=this->CoverWords;
+	int num=(int)this->CoverCon.size();
+	int *forwarders=(int *)malloc(sizeof(int)*(num+1));
+	unsigned long *L=&(this->CoverLeft[0]);
+	pair<double,int> entry;
+	int round=0;
+	int chosen=-1;
+	double best=0.0;
+	double G=0.0;
+	bool oldOnly=false;
+	bool uncovered=false;
+
+
+	forwarders[0]=0;
+	this->CoverRound.assign(num,0);
+	this->CoverTieKey.assign(num,-1.0);
+	this->CoverHeap.clear();
+	for(int k=0;k<num;k++)
+	{
+		this->CoverHeap.push_back(make_pair(CoverGain(k,Rules),k));
+	}
+	make_heap(this->CoverHeap.begin(),this->CoverHeap.end());
+	while(!this->CoverHeap.empty())
 	{
-		if(DirectContacts.test(i) && !IsInside(i,common))
+		uncovered=false;
+		for(int w=0;w<NW;w++)
 		{
-			ConSize++;
-			Con=(int *)realloc(Con,sizeof(int)*(ConSize));
-			Con[ConSize-1]=i;
-			InDirectContacts|=Nodes[i];
+			if(L[w])
+			{
+				uncovered=true;
+				break;
+			}
 		}
-		else
+		if(!uncovered)
 		{
-			DirectContacts.set(i,false);
+			break;
 		}
-	}
-	//Remove myself from Indirect contacts
-	InDirectContacts.set(this->NodeID,false);
-	//Also, remove direct contacts
-	for(int i=0;i<(int) DirectContacts.size();i++)
-	{
-		if(DirectContacts.test(i))
+		//Bring a candidate with an up-to-date gain to the top
+		while(this->CoverRound[this->CoverHeap.front().second] != round)
+		{
+			pop_heap(this->CoverHeap.begin(),this->CoverHeap.end());
+			entry=this->CoverHeap.back();
+			entry.first=CoverGain(entry.second,Rules);
+			this->CoverRound[entry.second]=round;
+			this->CoverHeap.back()=entry;
+			push_heap(this->CoverHeap.begin(),this->CoverHeap.end());
+		}
+		G=this->CoverHeap.front().first;
+		//Collect all candidates that achieve the best gain
+		this->CoverTies.clear();
+		while(!this->CoverHeap.empty() && this->CoverHeap.front().first >= G)
+		{
+			pop_heap(this->CoverHeap.begin(),this->CoverHeap.end());
+			entry=this->CoverHeap.back();
+			this->CoverHeap.pop_back();
+			if(this->CoverRound[entry.second] != round)
+			{
+				entry.first=CoverGain(entry.second,Rules);
+				this->CoverRound[entry.second]=round;
+				if(entry.first != G)
+				{
+					this->CoverHeap.push_back(entry);
+					push_heap(this->CoverHeap.begin(),this->CoverHeap.end());
+					continue;
+				}
+			}
+			this->CoverTies.push_back(entry.second);
+		}
+		sort(this->CoverTies.begin(),this->CoverTies.end());
+		//Resolve the draw
+		chosen=-1;
+		if(Rules->FirstIfGain != -1 && G == (double)Rules->FirstIfGain)
 		{
-			InDirectContacts.set(i,false);
+			chosen=this->CoverTies[0];
 		}
-	}
-	//Remove prev hop from Indirect contacts
-	InDirectContacts.set(prev,false);
-	//Remove old forwarders from indirect contacts
-	for(int i=0;i<(int) InDirectContacts.size();i++)
-	{
-		if(InDirectContacts.test(i))
+		else
 		{
-			for(int j=1;j<=oldFWs[0];j++)
+			oldOnly=false;
+			if(Rules->OldFirst)
 			{
-				if(oldFWs[j] == i)
+				for(unsigned int t=0;t<this->CoverTies.size();t++)
 				{
-					InDirectContacts.set(i,false);
-					break;
+					if(IsInside(this->CoverCon[this->CoverTies[t]],Rules->oldFWs))
+					{
+						oldOnly=true;
+						break;
+					}
+				}
+			}
+			best=-1.0;
+			for(unsigned int t=0;t<this->CoverTies.size();t++)
+			{
+				if(oldOnly && !IsInside(this->CoverCon[this->CoverTies[t]],Rules->oldFWs))
+				{
+					continue;
+				}
+				if(CoverTie(this->CoverTies[t],Rules) > best)
+				{
+					best=CoverTie(this->CoverTies[t],Rules);
+					chosen=this->CoverTies[t];
 				}
 			}
 		}
-		
+		for(unsigned int t=0;t<this->CoverTies.size();t++)
+		{
+			if(this->CoverTies[t] != chosen)
+			{
+				this->CoverHeap.push_back(make_pair(G,this->CoverTies[t]));
+				push_heap(this->CoverHeap.begin(),this->CoverHeap.end());
+			}
+		}
+		//Cover the 2-hop contacts of the winner
+		unsigned long *row=&(this->CoverMatrix[this->CoverCon[chosen]*NW]);
+		for(int w=0;w<NW;w++)
+		{
+			L[w]&=~row[w];
+		}
+		forwarders[0]++;
+		forwarders[forwarders[0]]=this->CoverCon[chosen];
+		round++;
 	}
-	//Remove the neighbors of old forwarders from indirect contacts
-	for(int j=1;j<=oldFWs[0];j++)
-	{
-		tmp.reset();
-		tmp=InDirectContacts & Nodes[oldFWs[j]];
-		InDirectContacts^=tmp;
-	}
-	
-	//Remove prev neighbors from indirect contacts
-	/*tmp.reset();
-	tmp=InDirectContacts & Nodes[prev];
-	InDirectContacts^=tmp;*/
-	
- 	#ifdef ADJ_DEBUG
-	printf("Common Contacts:");
-	for(int i=1;i<=common[0];i++)
-	{
-		printf("%d\t",common[i]);
-	}
-	printf("\n");
-	printf("Direct Contacts:");
-	PrintSet(&DirectContacts);
-	printf("Indirect Contacts:");
-	PrintSet(&InDirectContacts);
-	#endif
-	int which=-1;
-	int HowMany=-1;
-	int *forwarders=(int *)malloc(sizeof(int));
-	forwarders[0]=0;
-	int *Candidates=(int *)malloc(sizeof(int)*ConSize);
-	int position=0;
-	//printf("Node %d running GSC!\n",this->NodeID);
-	//printf("-------------------------\n");
-	while(!InDirectContacts.none())
-	{
-		//reset candidates
-		//printf("Candidates:");
-		for(int i=0;i<ConSize;i++)
- 		{
-			//printf("%d\t",Con[i]);
-			Candidates[i]=0;
-		}
-		//printf("\n");
-		which=-1;
-		HowMany=-1;
-		for(int i=0;i<ConSize;i++)
- 		{
-			if(Con[i] == -1)
-			{
-				continue;
-			}
-			tmp.reset();
-			tmp=Nodes[Con[i]] & InDirectContacts;
-			#ifdef ADJ_DEBUG
-			printf("Nodes that Node %d covers are: ",Con[i]);
-			PrintSet(&tmp);
-			#endif
-			//Keep track of draws
-			Candidates[i]=(int)tmp.count();
-			if(HowMany < (int)tmp.count())
-			{
-				HowMany=(int)tmp.count();
-				which=i;
-			}
-			#ifdef ADJ_DEBUG
-			printf("Number of Nodes  that Node %d covers is %d\n",Con[i],(int)tmp.count());
-			#endif
-		}
-		//Case of draw
-		#ifdef ADJ_DEBUG
-		printf("Checking draws..\n");
-		#endif
-		
-		//Create Draw Candidates
-		DrawCandidate *temp=NULL;
-		for(int i=0;i<ConSize;i++)
-		{
-			if(Candidates[i] == HowMany)
-			{
-				tmp.reset();
-				tmp=Nodes[Con[i]];
-				temp=new DrawCandidate(Con[i],Candidates[i],IsInside(Con[i],oldFWs),(int)tmp.count(),i);
-				Draw.push_back(temp);
-			}
-		}
-		//printf("Covered %d nodes\n",HowMany);
-		//PrintDraw(Draw);
-		
-		vector<DrawCandidate*>::iterator it;
-		//printf("Getting priority!!\n");
-		//Give priority to the one that has the best degree
-		which=GetHighestDegree(Draw);
-		
-		for ( it = Draw.begin(); it != Draw.end(); )
-		{
-			delete *it;  
-			it = Draw.erase(it);
-			
-		}
-		Draw.clear();
-		//printf("\n");
-		#ifdef ADJ_DEBUG
-		printf("Node %d that covers %d wins!\n",Con[which],HowMany);
-		#endif
-		tmp.reset();
-		tmp=InDirectContacts & Nodes[Con[which]];
-		InDirectContacts^=tmp;
-		//if(!IsInside(Con[which],oldFWs))
-		//{
-			//Add node to forwarders
-			position++;
-			forwarders=(int *)realloc(forwarders,sizeof(int)*(position+1));
-			forwarders[position]=Con[which];
-			forwarders[0]=position;
-		//}
-		//printf("Node %d wins!\n",Con[which]);
-		Con[which]=-1;
-		#ifdef ADJ_DEBUG
-		printf("Indirect contacts now become: ");
-		PrintSet(&InDirectContacts);
-		#endif
-	}
-	free(Con);
-	free(common);
-	#ifdef ADJ_DEBUG
-	printf("The forwarders are %d:",forwarders[0]);
-	for(int i=1;i<=forwarders[0];i++)
-	{
-		printf(" %d",forwarders[i]);
-	}
-	printf("\n");
-	#endif
-	return forwarders;
-}
-
-
-
-
-int *Adjacency::GetForwardingSet3(int *oldFWs,int *prev)
-{
-	vector<DrawCandidate*> Draw;
-	//Take 2-Hop contacts
-	dynamic_bitset<> DirectContacts(Nodes[this->NodeID]);
-	dynamic_bitset<> InDirectContacts(Nodes[this->NodeID]);
-	dynamic_bitset<> tmp(Nodes[this->NodeID]);
-	InDirectContacts.reset();
-	tmp.reset();
-	
-	//Get common neighbors with previous nodes (nodes that try to forward the packet to me)
-	int *common=(int *)malloc(sizeof(int));
-	common[0]=0;
-	int pos=0;
-	for(int j=1;j<=prev[0];j++)
-	{
-		if(prev[j] != this->NodeID)
-		{
-			for(int i=0;i<(int) DirectContacts.size();i++)
-			{
-				if(DirectContacts.test(i) && Nodes[prev[j]].test(i))
-				{
-					pos++;
-					common=(int *)realloc(common,sizeof(int)*(pos+1));
-					common[pos]=i;
-					common[0]=pos;
-				}
-			}
-		}
-	}
-	
-	//Remove old forwarders from direct contacts
-	for(int i=0;i<(int) DirectContacts.size();i++)
-	{
-		if(DirectContacts.test(i) && IsInside(i,oldFWs))
-		{
-			DirectContacts.set(i,false);
-		}
-	}
-	
-	//Construct indirect contacts
-	int ConSize=0;
-	int *Con=NULL;
-	for(int i=0;i<(int) DirectContacts.size();i++)
-	{
-		if(DirectContacts.test(i) && !IsInside(i,common))
-		{
-			ConSize++;
-			Con=(int *)realloc(Con,sizeof(int)*(ConSize));
-			Con[ConSize-1]=i;
-			InDirectContacts|=Nodes[i];
-		}
-		else
-		{
-			DirectContacts.set(i,false);
-		}
-	}
-	//Remove myself from Indirect contacts
-	InDirectContacts.set(this->NodeID,false);
-	//Also, remove direct contacts
-	for(int i=0;i<(int) DirectContacts.size();i++)
-	{
-		if(DirectContacts.test(i))
-		{
-			InDirectContacts.set(i,false);
-		}
-	}
-	
-	//Remove prev hops from Indirect contacts
-	for(int j=1;j<=prev[0];j++)
-	{
-		InDirectContacts.set(prev[j],false);
-	}
-	//Remove old forwarders from indirect contacts
-	for(int i=0;i<(int) InDirectContacts.size();i++)
-	{
-		if(InDirectContacts.test(i))
-		{
-			for(int j=1;j<=oldFWs[0];j++)
-			{
-				if(oldFWs[j] == i)
-				{
-					InDirectContacts.set(i,false);
-					break;
-				}
-			}
-		}
-		
-	}
-	//Remove the neighbors of old forwarders from indirect contacts
-	for(int j=1;j<=oldFWs[0];j++)
-	{
-		tmp.reset();
-		tmp=InDirectContacts & Nodes[oldFWs[j]];
-		InDirectContacts^=tmp;
-	}
-	
-	//Remove prev neighbors from indirect contacts (for all previous hops)
-	for(int j=1;j<=prev[0];j++)
-	{
-		tmp.reset();
-		tmp=InDirectContacts & Nodes[prev[j]];
-		InDirectContacts^=tmp;
-	}	
-	
-	
- 	#ifdef ADJ_DEBUG
-	printf("Common Contacts:");
-	for(int i=1;i<=common[0];i++)
-	{
-		printf("%d\t",common[i]);
-	}
-	printf("\n");
-	printf("Direct Contacts:");
-	PrintSet(&DirectContacts);
-	printf("Indirect Contacts:");
-	PrintSet(&InDirectContacts);
-	#endif
-	int which=-1;
-	int HowMany=-1;
-	int *forwarders=(int *)malloc(sizeof(int));
-	forwarders[0]=0;
-	int *Candidates=(int *)malloc(sizeof(int)*ConSize);
-	int position=0;
-	//printf("Node %d running GSC!\n",this->NodeID);
-	//printf("-------------------------\n");
-	while(!InDirectContacts.none())
-	{
-		//reset candidates
-		//printf("Candidates:");
-		for(int i=0;i<ConSize;i++)
- 		{
-			//printf("%d\t",Con[i]);
-			Candidates[i]=0;
-		}
-		//printf("\n");
-		which=-1;
-		HowMany=-1;
-		for(int i=0;i<ConSize;i++)
- 		{
-			if(Con[i] == -1)
-			{
-				continue;
-			}
-			tmp.reset();
-			tmp=Nodes[Con[i]] & InDirectContacts;
-			#ifdef ADJ_DEBUG
-			printf("Nodes that Node %d covers are: ",Con[i]);
-			PrintSet(&tmp);
-			#endif
-			//Keep track of draws
-			Candidates[i]=(int)tmp.count();
-			if(HowMany < (int)tmp.count())
-			{
-				HowMany=(int)tmp.count();
-				which=i;
-			}
-			#ifdef ADJ_DEBUG
-			printf("Number of Nodes  that Node %d covers is %d\n",Con[i],(int)tmp.count());
-			#endif
-		}
-		//Case of draw
-		#ifdef ADJ_DEBUG
-		printf("Checking draws..\n");
-		#endif
-		
-		//Create Draw Candidates
-		DrawCandidate *temp=NULL;
-		for(int i=0;i<ConSize;i++)
-		{
-			if(Candidates[i] == HowMany)
-			{
-				tmp.reset();
-				tmp=Nodes[Con[i]];
-				temp=new DrawCandidate(Con[i],Candidates[i],IsInside(Con[i],oldFWs),(int)tmp.count(),i);
-				Draw.push_back(temp);
-			}
-		}
-		//printf("Covered %d nodes\n",HowMany);
-		//PrintDraw(Draw);
-		
-		vector<DrawCandidate*>::iterator it;
-		//printf("Getting priority!!\n");
-		//Give priority to the one that has the best degree
-		which=GetHighestDegree(Draw);
-		
-		for ( it = Draw.begin(); it != Draw.end(); )
-		{
-			delete *it;  
-			it = Draw.erase(it);
-			
-		}
-		Draw.clear();
-		//printf("\n");
-		#ifdef ADJ_DEBUG
-		printf("Node %d that covers %d wins!\n",Con[which],HowMany);
-		#endif
-		tmp.reset();
-		tmp=InDirectContacts & Nodes[Con[which]];
-		InDirectContacts^=tmp;
-		//if(!IsInside(Con[which],oldFWs))
-		//{
-			//Add node to forwarders
-			position++;
-			forwarders=(int *)realloc(forwarders,sizeof(int)*(position+1));
-			forwarders[position]=Con[which];
-			forwarders[0]=position;
-		//}
-		//printf("Node %d wins!\n",Con[which]);
-		Con[which]=-1;
-		#ifdef ADJ_DEBUG
-		printf("Indirect contacts now become: ");
-		PrintSet(&InDirectContacts);
-		#endif
-	}
-	free(Con);
-	free(common);
-	#ifdef ADJ_DEBUG
-	printf("The forwarders are %d:",forwarders[0]);
-	for(int i=1;i<=forwarders[0];i++)
-	{
-		printf(" %d",forwarders[i]);
-	}
-	printf("\n");
-	#endif
-	return forwarders;
-}
-
-int *Adjacency::GetForwardingSetNew(int *oldFWs,int *prev)
-{
-	vector<DrawCandidate*> Draw;
-	//Take 2-Hop contacts
-	dynamic_bitset<> DirectContacts(Nodes[this->NodeID]);
-	dynamic_bitset<> InDirectContacts(Nodes[this->NodeID]);
-	dynamic_bitset<> tmp(Nodes[this->NodeID]);
-	tmp.reset();
-	
-	//Remove old forwarders + previous pkt holders from direct contacts
-	//B(u)=N(u) - (OLDFW + PREV)
-	for(int i=0;i<(int) DirectContacts.size();i++)
-	{
-		if(DirectContacts.test(i) && (IsInside(i,oldFWs) || IsInside(i,prev)))
-		{
-			DirectContacts.set(i,false);
-		}
-	}
-	
-	//The following steps calculate Indirect contacts: U(u)= N(N(u)) - u - OLDFW - PREV -N(u) - N(OLDFW) - N(PREV) 
-	//Construct indirect contacts - N(N(u))
-	int ConSize=0;
-	int *Con=NULL;
-	for(int i=0;i<(int) DirectContacts.size();i++)
-	{
-		if(DirectContacts.test(i))
-		{
-			ConSize++;
-			Con=(int *)realloc(Con,sizeof(int)*(ConSize));
-			Con[ConSize-1]=i;
-			InDirectContacts|=Nodes[i];
-		}
-	}
-	//Remove myself from Indirect contacts - u
-	InDirectContacts.set(this->NodeID,false);
-	//Also, remove direct contacts - N(u)
-	for(int i=0;i<(int) DirectContacts.size();i++)
-	{
-		if(DirectContacts.test(i))
-		{
-			InDirectContacts.set(i,false);
-		}
-	}
-	
-	//Remove prev hops from Indirect contacts - PREV
-	for(int j=1;j<=prev[0];j++)
-	{
-		InDirectContacts.set(prev[j],false);
-	}
-	//Remove old forwarders from indirect contacts - OLDFW
-	for(int i=0;i<(int) InDirectContacts.size();i++)
-	{
-		if(InDirectContacts.test(i))
-		{
-			for(int j=1;j<=oldFWs[0];j++)
-			{
-				if(oldFWs[j] == i)
-				{
-					InDirectContacts.set(i,false);
-					break;
-				}
-			}
-		}
-		
-	}
-	//Remove the neighbors of old forwarders from indirect contacts - N(OLDFW)
-	for(int j=1;j<=oldFWs[0];j++)
-	{
-		tmp.reset();
-		tmp=InDirectContacts & Nodes[oldFWs[j]];
-		InDirectContacts^=tmp;
-	}
-	
-	//Remove prev neighbors from indirect contacts (for all previous hops) - N(PREV)
-	for(int j=1;j<=prev[0];j++)
-	{
-		tmp.reset();
-		tmp=InDirectContacts & Nodes[prev[j]];
-		InDirectContacts^=tmp;
-	}	
-	
-	
- 	#ifdef ADJ_DEBUG
-	printf("Direct Contacts:");
-	PrintSet(&DirectContacts);
-	printf("Indirect Contacts:");
-	PrintSet(&InDirectContacts);
-	#endif
-	int which=-1;
-	int HowMany=-1;
-	int *forwarders=(int *)malloc(sizeof(int));
-	forwarders[0]=0;
-	int *Candidates=(int *)malloc(sizeof(int)*ConSize);
-	int position=0;
-	//printf("Node %d running GSC!\n",this->NodeID);
-	//printf("-------------------------\n");
-	while(!InDirectContacts.none())
-	{
-		//reset candidates
-		//printf("Candidates:");
-		for(int i=0;i<ConSize;i++)
- 		{
-			//printf("%d\t",Con[i]);
-			Candidates[i]=0;
-		}
-		//printf("\n");
-		which=-1;
-		HowMany=-1;
-		for(int i=0;i<ConSize;i++)
- 		{
-			if(Con[i] == -1)
-			{
-				continue;
-			}
-			tmp.reset();
-			tmp=Nodes[Con[i]] & InDirectContacts;
-			#ifdef ADJ_DEBUG
-			printf("Nodes that Node %d covers are: ",Con[i]);
-			PrintSet(&tmp);
-			#endif
-			//Keep track of draws
-			Candidates[i]=(int)tmp.count();
-			if(HowMany < (int)tmp.count())
-			{
-				HowMany=(int)tmp.count();
-				which=i;
-			}
-			#ifdef ADJ_DEBUG
-			printf("Number of Nodes  that Node %d covers is %d\n",Con[i],(int)tmp.count());
-			#endif
-		}
-		//Case of draw
-		#ifdef ADJ_DEBUG
-		printf("Checking draws..\n");
-		#endif
-		
-		//Create Draw Candidates
-		DrawCandidate *temp=NULL;
-		for(int i=0;i<ConSize;i++)
-		{
-			if(Candidates[i] == HowMany)
-			{
-				tmp.reset();
-				tmp=Nodes[Con[i]];
-				temp=new DrawCandidate(Con[i],Candidates[i],IsInside(Con[i],oldFWs),(int)tmp.count(),i);
-				Draw.push_back(temp);
-			}
-		}
-		//printf("Covered %d nodes\n",HowMany);
-		//PrintDraw(Draw);
-		
-		vector<DrawCandidate*>::iterator it;
-		//printf("Getting priority!!\n");
-		//Give priority to the one that has the best degree
-		which=GetHighestDegree(Draw);
-		
-		for ( it = Draw.begin(); it != Draw.end(); )
-		{
-			delete *it;  
-			it = Draw.erase(it);
-			
-		}
-		Draw.clear();
-		//printf("\n");
-		#ifdef ADJ_DEBUG
-		printf("Node %d that covers %d wins!\n",Con[which],HowMany);
-		#endif
-		tmp.reset();
-		tmp=InDirectContacts & Nodes[Con[which]];
-		InDirectContacts^=tmp;
-		//if(!IsInside(Con[which],oldFWs))
-		//{
-			//Add node to forwarders
-			position++;
-			forwarders=(int *)realloc(forwarders,sizeof(int)*(position+1));
-			forwarders[position]=Con[which];
-			forwarders[0]=position;
-		//}
-		//printf("Node %d wins!\n",Con[which]);
-		Con[which]=-1;
-		#ifdef ADJ_DEBUG
-		printf("Indirect contacts now become: ");
-		PrintSet(&InDirectContacts);
-		#endif
-	}
-	free(Con);
-	#ifdef ADJ_DEBUG
-	printf("The forwarders are %d:",forwarders[0]);
-	for(int i=1;i<=forwarders[0];i++)
-	{
-		printf(" %d",forwarders[i]);
-	}
-	printf("\n");
-	#endif
-	return forwarders;
-}
-
-
-int* Adjacency::GetForwardingSet5(int* oldFWs, int* prev, double Ctime)
-{
-	vector<DrawCandidate*> Draw;
-	//Take 2-Hop contacts
-	dynamic_bitset<> DirectContacts(Nodes[this->NodeID]);
-	dynamic_bitset<> InDirectContacts(Nodes[this->NodeID]);
-	dynamic_bitset<> tmp(Nodes[this->NodeID]);
-	InDirectContacts.reset();
-	tmp.reset();
-	
-	//Get common neighbors with previous nodes (nodes that try to forward the packet to me)
-	int *common=(int *)malloc(sizeof(int));
-	common[0]=0;
-	int pos=0;
-	for(int j=1;j<=prev[0];j++)
-	{
-		if(prev[j] != this->NodeID)
-		{
-			for(int i=0;i<(int) DirectContacts.size();i++)
-			{
-				if(DirectContacts.test(i) && Nodes[prev[j]].test(i))
-				{
-					pos++;
-					common=(int *)realloc(common,sizeof(int)*(pos+1));
-					common[pos]=i;
-					common[0]=pos;
-				}
-			}
-		}
-	}
-	
-	//Remove old forwarders from direct contacts
-	for(int i=0;i<(int) DirectContacts.size();i++)
-	{
-		if(DirectContacts.test(i) && IsInside(i,oldFWs))
-		{
-			DirectContacts.set(i,false);
-		}
-	}
-	
-	//Construct indirect contacts
-	int ConSize=0;
-	int *Con=NULL;
-	for(int i=0;i<(int) DirectContacts.size();i++)
-	{
-		if(DirectContacts.test(i) && !IsInside(i,common))
-		{
-			ConSize++;
-			Con=(int *)realloc(Con,sizeof(int)*(ConSize));
-			Con[ConSize-1]=i;
-			InDirectContacts|=Nodes[i];
-		}
-		else
-		{
-			DirectContacts.set(i,false);
-		}
-	}
-	//Remove myself from Indirect contacts
-	InDirectContacts.set(this->NodeID,false);
-	//Also, remove direct contacts
-	for(int i=0;i<(int) DirectContacts.size();i++)
-	{
-		if(DirectContacts.test(i))
-		{
-			InDirectContacts.set(i,false);
-		}
-	}
-	
-	//Remove prev hops from Indirect contacts
-	for(int j=1;j<=prev[0];j++)
-	{
-		InDirectContacts.set(prev[j],false);
-	}
-	//Remove old forwarders from indirect contacts
-	for(int i=0;i<(int) InDirectContacts.size();i++)
-	{
-		if(InDirectContacts.test(i))
-		{
-			for(int j=1;j<=oldFWs[0];j++)
-			{
-				if(oldFWs[j] == i)
-				{
-					InDirectContacts.set(i,false);
-					break;
-				}
-			}
-		}
-		
-	}
-	//Remove the neighbors of old forwarders from indirect contacts
-	for(int j=1;j<=oldFWs[0];j++)
-	{
-		tmp.reset();
-		tmp=InDirectContacts & Nodes[oldFWs[j]];
-		InDirectContacts^=tmp;
-	}
-	
-	//Remove prev neighbors from indirect contacts (for all previous hops)
-	for(int j=1;j<=prev[0];j++)
-	{
-		tmp.reset();
-		tmp=InDirectContacts & Nodes[prev[j]];
-		InDirectContacts^=tmp;
-	}	
-	
-	
- 	#ifdef ADJ_DEBUG
-	printf("Common Contacts:");
-	for(int i=1;i<=common[0];i++)
-	{
-		printf("%d\t",common[i]);
-	}
-	printf("\n");
-	printf("Direct Contacts:");
-	PrintSet(&DirectContacts);
-	printf("Indirect Contacts:");
-	PrintSet(&InDirectContacts);
-	#endif
-	int which=-1;
-	int HowMany=-1;
-	int *forwarders=(int *)malloc(sizeof(int));
-	forwarders[0]=0;
-	int *Candidates=(int *)malloc(sizeof(int)*ConSize);
-	int position=0;
-	//printf("Node %d running GSC!\n",this->NodeID);
-	//printf("-------------------------\n");
-	while(!InDirectContacts.none())
-	{
-		//reset candidates
-		//printf("Candidates:");
-		for(int i=0;i<ConSize;i++)
- 		{
-			//printf("%d\t",Con[i]);
-			Candidates[i]=0;
-		}
-		//printf("\n");
-		which=-1;
-		HowMany=-1;
-		for(int i=0;i<ConSize;i++)
- 		{
-			if(Con[i] == -1)
-			{
-				continue;
-			}
-			tmp.reset();
-			tmp=Nodes[Con[i]] & InDirectContacts;
-			#ifdef ADJ_DEBUG
-			printf("Nodes that Node %d covers are: ",Con[i]);
-			PrintSet(&tmp);
-			#endif
-			//Keep track of draws
-			Candidates[i]=(int)tmp.count();
-			if(HowMany < (int)tmp.count())
-			{
-				HowMany=(int)tmp.count();
-				which=i;
-			}
-			#ifdef ADJ_DEBUG
-			printf("Number of Nodes  that Node %d covers is %d\n",Con[i],(int)tmp.count());
-			#endif
-		}
-		//Case of draw
-		#ifdef ADJ_DEBUG
-		printf("Checking draws..\n");
-		#endif
-		
-		//Create Draw Candidates
-		DrawCandidate *temp=NULL;
-		for(int i=0;i<ConSize;i++)
-		{
-			if(Candidates[i] == HowMany)
-			{
-				tmp.reset();
-				tmp=Nodes[Con[i]];
-				temp=new DrawCandidate(Con[i],Candidates[i],IsInside(Con[i],oldFWs),(int)tmp.count(),i);
-				Draw.push_back(temp);
-			}
-		}
-		//printf("Covered %d nodes\n",HowMany);
-		//PrintDraw(Draw);
-		
-		vector<DrawCandidate*>::iterator it;
-		//printf("Getting priority!!\n");
-		//Give priority to the one that has the best degree
-		which=GetBetterTieStrength(Draw,Ctime);
-		
-		for ( it = Draw.begin(); it != Draw.end(); )
-		{
-			delete *it;  
-			it = Draw.erase(it);
-			
-		}
-		Draw.clear();
-		//printf("\n");
-		#ifdef ADJ_DEBUG
-		printf("Node %d that covers %d wins!\n",Con[which],HowMany);
-		#endif
-		tmp.reset();
-		tmp=InDirectContacts & Nodes[Con[which]];
-		InDirectContacts^=tmp;
-		//if(!IsInside(Con[which],oldFWs))
-		//{
-			//Add node to forwarders
-			position++;
-			forwarders=(int *)realloc(forwarders,sizeof(int)*(position+1));
-			forwarders[position]=Con[which];
-			forwarders[0]=position;
-		//}
-		//printf("Node %d wins!\n",Con[which]);
-		Con[which]=-1;
-		#ifdef ADJ_DEBUG
-		printf("Indirect contacts now become: ");
-		PrintSet(&InDirectContacts);
-		#endif
-	}
-	free(Con);
-	free(common);
-	#ifdef ADJ_DEBUG
-	printf("The forwarders are %d:",forwarders[0]);
-	for(int i=1;i<=forwarders[0];i++)
-	{
-		printf(" %d",forwarders[i]);
-	}
-	printf("\n");
-	#endif
-	return forwarders;
-}
-
-int* Adjacency::GetForwardingSetRecent(int* oldFWs, int* prev, double Ctime)
-{
-	vector<DrawCandidate*> Draw;
-	//Take 2-Hop contacts
-	dynamic_bitset<> DirectContacts(Nodes[this->NodeID]);
-	dynamic_bitset<> InDirectContacts(Nodes[this->NodeID]);
-	dynamic_bitset<> tmp(Nodes[this->NodeID]);
-	InDirectContacts.reset();
-	tmp.reset();
-	
-	//Get common neighbors with previous nodes (nodes that try to forward the packet to me)
-	int *common=(int *)malloc(sizeof(int));
-	common[0]=0;
-	int pos=0;
-	for(int j=1;j<=prev[0];j++)
-	{
-		if(prev[j] != this->NodeID)
-		{
-			for(int i=0;i<(int) DirectContacts.size();i++)
-			{
-				if(DirectContacts.test(i) && Nodes[prev[j]].test(i))
-				{
-					pos++;
-					common=(int *)realloc(common,sizeof(int)*(pos+1));
-					common[pos]=i;
-					common[0]=pos;
-				}
-			}
-		}
-	}
-	
-	//Remove old forwarders from direct contacts
-	for(int i=0;i<(int) DirectContacts.size();i++)
-	{
-		if(DirectContacts.test(i) && IsInside(i,oldFWs))
-		{
-			DirectContacts.set(i,false);
-		}
-	}
-	
-	//Construct indirect contacts
-	int ConSize=0;
-	int *Con=NULL;
-	for(int i=0;i<(int) DirectContacts.size();i++)
-	{
-		if(DirectContacts.test(i) && !IsInside(i,common))
-		{
-			ConSize++;
-			Con=(int *)realloc(Con,sizeof(int)*(ConSize));
-			Con[ConSize-1]=i;
-			InDirectContacts|=Nodes[i];
-		}
-		else
-		{
-			DirectContacts.set(i,false);
-		}
-	}
-	//Remove myself from Indirect contacts
-	InDirectContacts.set(this->NodeID,false);
-	//Also, remove direct contacts
-	for(int i=0;i<(int) DirectContacts.size();i++)
-	{
-		if(DirectContacts.test(i))
-		{
-			InDirectContacts.set(i,false);
-		}
-	}
-	
-	//Remove prev hops from Indirect contacts
-	for(int j=1;j<=prev[0];j++)
-	{
-		InDirectContacts.set(prev[j],false);
-	}
-	//Remove old forwarders from indirect contacts
-	for(int i=0;i<(int) InDirectContacts.size();i++)
-	{
-		if(InDirectContacts.test(i))
-		{
-			for(int j=1;j<=oldFWs[0];j++)
-			{
-				if(oldFWs[j] == i)
-				{
-					InDirectContacts.set(i,false);
-					break;
-				}
-			}
-		}
-		
-	}
-	//Remove the neighbors of old forwarders from indirect contacts
-	for(int j=1;j<=oldFWs[0];j++)
-	{
-		tmp.reset();
-		tmp=InDirectContacts & Nodes[oldFWs[j]];
-		InDirectContacts^=tmp;
-	}
-	
-	//Remove prev neighbors from indirect contacts (for all previous hops)
-	for(int j=1;j<=prev[0];j++)
-	{
-		tmp.reset();
-		tmp=InDirectContacts & Nodes[prev[j]];
-		InDirectContacts^=tmp;
-	}	
-	
-	
- 	#ifdef ADJ_DEBUG
-	printf("Common Contacts:");
-	for(int i=1;i<=common[0];i++)
-	{
-		printf("%d\t",common[i]);
-	}
-	printf("\n");
-	printf("Direct Contacts:");
-	PrintSet(&DirectContacts);
-	printf("Indirect Contacts:");
-	PrintSet(&InDirectContacts);
-	#endif
-	int which=-1;
-	double HowMany=-1;
-	int *forwarders=(int *)malloc(sizeof(int));
-	forwarders[0]=0;
-	double *Candidates=(double *)malloc(sizeof(double)*ConSize);
-	int position=0;
-	//printf("Node %d running GSC!\n",this->NodeID);
-	//printf("-------------------------\n");
-	while(!InDirectContacts.none())
-	{
-		//reset candidates
-		//printf("Candidates:");
-		for(int i=0;i<ConSize;i++)
- 		{
-			//printf("%d\t",Con[i]);
-			Candidates[i]=0.0;
-		}
-		//printf("\n");
-		which=-1;
-		HowMany=-1.0;
-		for(int i=0;i<ConSize;i++)
- 		{
-			if(Con[i] == -1)
-			{
-				continue;
-			}
-			tmp.reset();
-			tmp=Nodes[Con[i]] & InDirectContacts;
-			#ifdef ADJ_DEBUG
-			printf("Nodes that Node %d covers are: ",Con[i]);
-			PrintSet(&tmp);
-			#endif
-			//Keep track of draws
-			double price=this->NormalizedTieStrength(Con[i],Ctime)*(double)tmp.count();
-			//Candidates[i]=(int)tmp.count();
-			Candidates[i]=price;
-// 			printf("%f\n",price);
-			if(HowMany < price)
-			{
-				HowMany=price;
-				which=i;
-			}
-			#ifdef ADJ_DEBUG
-			printf("Number of Nodes  that Node %d covers is %d\n",Con[i],(int)tmp.count());
-			#endif
-		}
-		//Case of draw
-		#ifdef ADJ_DEBUG
-		printf("Checking draws..\n");
-		#endif
-		
-		//Create Draw Candidates
-		DrawCandidate *temp=NULL;
-		for(int i=0;i<ConSize;i++)
-		{
-			if(Candidates[i] == HowMany)
-			{
-				tmp.reset();
-				tmp=Nodes[Con[i]];
-				temp=new DrawCandidate(Con[i],Candidates[i],IsInside(Con[i],oldFWs),(int)tmp.count(),i);
-				Draw.push_back(temp);
-			}
-		}
-		//printf("Covered %d nodes\n",HowMany);
-		//PrintDraw(Draw);
-		
-		vector<DrawCandidate*>::iterator it;
-		//printf("Getting priority!!\n");
-		//Give priority to the one that has the best degree
-		//which=GetMostRecent(Draw,Ctime);
-		//which=GetMostFrequent(Draw);
-		which=GetBetterTieStrength(Draw,Ctime);
-		
-		for ( it = Draw.begin(); it != Draw.end(); )
-		{
-			delete *it;  
-			it = Draw.erase(it);
-			
-		}
-		Draw.clear();
-		//printf("\n");
-		#ifdef ADJ_DEBUG
-		printf("Node %d that covers %d wins!\n",Con[which],HowMany);
-		#endif
-		tmp.reset();
-		tmp=InDirectContacts & Nodes[Con[which]];
-		InDirectContacts^=tmp;
-		//if(!IsInside(Con[which],oldFWs))
-		//{
-			//Add node to forwarders
-			position++;
-			forwarders=(int *)realloc(forwarders,sizeof(int)*(position+1));
-			forwarders[position]=Con[which];
-			forwarders[0]=position;
-		//}
-		//printf("Node %d wins!\n",Con[which]);
-		Con[which]=-1;
-		#ifdef ADJ_DEBUG
-		printf("Indirect contacts now become: ");
-		PrintSet(&InDirectContacts);
-		#endif
-	}
-	free(Con);
-	free(common);
-	#ifdef ADJ_DEBUG
-	printf("The forwarders are %d:",forwarders[0]);
-	for(int i=1;i<=forwarders[0];i++)
-	{
-		printf(" %d",forwarders[i]);
-	}
-	printf("\n");
-	#endif
-	return forwarders;
-}
-
-
-int* Adjacency::GetForwardingSetPriority(int* oldFWs, int* prev, int NodeinContact)
-{
-	vector<DrawCandidate*> Draw;
-	//Take 2-Hop contacts
-	dynamic_bitset<> DirectContacts(Nodes[this->NodeID]);
-	dynamic_bitset<> InDirectContacts(Nodes[this->NodeID]);
-	dynamic_bitset<> tmp(Nodes[this->NodeID]);
-	InDirectContacts.reset();
-	tmp.reset();
-	
-	//Get common neighbors with previous nodes (nodes that try to forward the packet to me)
-	int *common=(int *)malloc(sizeof(int));
-	common[0]=0;
-	int pos=0;
-	for(int j=1;j<=prev[0];j++)
-	{
-		if(prev[j] != this->NodeID)
-		{
-			for(int i=0;i<(int) DirectContacts.size();i++)
-			{
-				if(DirectContacts.test(i) && Nodes[prev[j]].test(i))
-				{
-					pos++;
-					common=(int *)realloc(common,sizeof(int)*(pos+1));
-					common[pos]=i;
-					common[0]=pos;
-				}
-			}
-		}
-	}
-	
-	//Remove old forwarders from direct contacts
-	for(int i=0;i<(int) DirectContacts.size();i++)
-	{
-		if(DirectContacts.test(i) && IsInside(i,oldFWs))
-		{
-			DirectContacts.set(i,false);
-		}
-	}
-	
-	//Construct indirect contacts
-	int ConSize=0;
-	int *Con=NULL;
-	for(int i=0;i<(int) DirectContacts.size();i++)
-	{
-		if(DirectContacts.test(i) && !IsInside(i,common))
-		{
-			ConSize++;
-			Con=(int *)realloc(Con,sizeof(int)*(ConSize));
-			Con[ConSize-1]=i;
-			InDirectContacts|=Nodes[i];
-		}
-		else
-		{
-			DirectContacts.set(i,false);
-		}
-	}
-	//Remove myself from Indirect contacts
-	InDirectContacts.set(this->NodeID,false);
-	//Also, remove direct contacts
-	for(int i=0;i<(int) DirectContacts.size();i++)
-	{
-		if(DirectContacts.test(i))
-		{
-			InDirectContacts.set(i,false);
-		}
-	}
-	
-	//Remove prev hops from Indirect contacts
-	for(int j=1;j<=prev[0];j++)
-	{
-		InDirectContacts.set(prev[j],false);
-	}
-	//Remove old forwarders from indirect contacts
-	for(int i=0;i<(int) InDirectContacts.size();i++)
-	{
-		if(InDirectContacts.test(i))
-		{
-			for(int j=1;j<=oldFWs[0];j++)
-			{
-				if(oldFWs[j] == i)
-				{
-					InDirectContacts.set(i,false);
-					break;
-				}
-			}
-		}
-		
-	}
-	//Remove the neighbors of old forwarders from indirect contacts
-	for(int j=1;j<=oldFWs[0];j++)
-	{
-		tmp.reset();
-		tmp=InDirectContacts & Nodes[oldFWs[j]];
-		InDirectContacts^=tmp;
-	}
-	
-	//Remove prev neighbors from indirect contacts (for all previous hops)
-	for(int j=1;j<=prev[0];j++)
-	{
-		tmp.reset();
-		tmp=InDirectContacts & Nodes[prev[j]];
-		InDirectContacts^=tmp;
-	}	
-	
-	
- 	#ifdef ADJ_DEBUG
-	printf("Common Contacts:");
-	for(int i=1;i<=common[0];i++)
-	{
-		printf("%d\t",common[i]);
-	}
-	printf("\n");
-	printf("Direct Contacts:");
-	PrintSet(&DirectContacts);
-	printf("Indirect Contacts:");
-	PrintSet(&InDirectContacts);
-	#endif
-	int which=-1;
-	int HowMany=-1;
-	int *forwarders=(int *)malloc(sizeof(int));
-	forwarders[0]=0;
-	int *Candidates=(int *)malloc(sizeof(int)*ConSize);
-	int position=0;
-	//printf("Node %d running GSC!\n",this->NodeID);
-	//printf("-------------------------\n");
-	while(!InDirectContacts.none())
-	{
-		//reset candidates
-		//printf("Candidates:");
-		for(int i=0;i<ConSize;i++)
- 		{
-			//printf("%d\t",Con[i]);
-			Candidates[i]=0;
-		}
-		//printf("\n");
-		which=-1;
-		HowMany=-1;
-		for(int i=0;i<ConSize;i++)
- 		{
-			if(Con[i] == -1)
-			{
-				continue;
-			}
-			tmp.reset();
-			tmp=Nodes[Con[i]] & InDirectContacts;
-			#ifdef ADJ_DEBUG
-			printf("Nodes that Node %d covers are: ",Con[i]);
-			PrintSet(&tmp);
-			#endif
-			//Keep track of draws
-			Candidates[i]=(int)tmp.count();
-			if(HowMany < (int)tmp.count())
-			{
-				HowMany=(int)tmp.count();
-				which=i;
-			}
-			#ifdef ADJ_DEBUG
-			printf("Number of Nodes  that Node %d covers is %d\n",Con[i],(int)tmp.count());
-			#endif
-		}
-		//Case of draw
-		#ifdef ADJ_DEBUG
-		printf("Checking draws..\n");
-		#endif
-		
-		//Create Draw Candidates
-		DrawCandidate *temp=NULL;
-		bool flag=false;
-		for(int i=0;i<ConSize;i++)
-		{
-			if(Candidates[i] == HowMany)
-			{
-				if(Candidates[i] == NodeinContact)
-				{
-					flag=true;
-					which=i;
-					break;
-				}
-				tmp.reset();
-				tmp=Nodes[Con[i]];
-				temp=new DrawCandidate(Con[i],Candidates[i],IsInside(Con[i],oldFWs),(int)tmp.count(),i);
-				Draw.push_back(temp);
-			}
-		}
-		//printf("Covered %d nodes\n",HowMany);
-		//PrintDraw(Draw);
-		
-		vector<DrawCandidate*>::iterator it;
-		//printf("Getting priority!!\n");
-		//Give priority to the one that has the best degree
-		if(!flag)
-		{
-			which=GetHighestDegree(Draw);
-		}
-		
-		for ( it = Draw.begin(); it != Draw.end(); )
-		{
-			delete *it;  
-			it = Draw.erase(it);
-			
-		}
-		Draw.clear();
-		//printf("\n");
-		#ifdef ADJ_DEBUG
-		printf("Node %d that covers %d wins!\n",Con[which],HowMany);
-		#endif
-		tmp.reset();
-		tmp=InDirectContacts & Nodes[Con[which]];
-		InDirectContacts^=tmp;
-		//if(!IsInside(Con[which],oldFWs))
-		//{
-			//Add node to forwarders
-			position++;
-			forwarders=(int *)realloc(forwarders,sizeof(int)*(position+1));
-			forwarders[position]=Con[which];
-			forwarders[0]=position;
-		//}
-		//printf("Node %d wins!\n",Con[which]);
-		Con[which]=-1;
-		#ifdef ADJ_DEBUG
-		printf("Indirect contacts now become: ");
-		PrintSet(&InDirectContacts);
-		#endif
-	}
-	free(Con);
-	free(common);
-	#ifdef ADJ_DEBUG
-	printf("The forwarders are %d:",forwarders[0]);
-	for(int i=1;i<=forwarders[0];i++)
-	{
-		printf(" %d",forwarders[i]);
-	}
-	printf("\n");
-	#endif
-	return forwarders;
-}
-
-
-
-
-int *Adjacency::GetForwardingSet4(int *oldFWs,int *prev)
-{
-	vector<DrawCandidate*> Draw;
-	//Take 2-Hop contacts
-	dynamic_bitset<> DirectContacts(Nodes[this->NodeID]);
-	dynamic_bitset<> InDirectContacts(Nodes[this->NodeID]);
-	dynamic_bitset<> tmp(Nodes[this->NodeID]);
-	InDirectContacts.reset();
-	tmp.reset();
-	
-	//Get common neighbors with previous nodes (nodes that try to forward the packet to me)
-	int *common=(int *)malloc(sizeof(int));
-	common[0]=0;
-	int pos=0;
-	for(int j=1;j<=prev[0];j++)
-	{
-		if(prev[j] != this->NodeID)
-		{
-			for(int i=0;i<(int) DirectContacts.size();i++)
-			{
-				if(DirectContacts.test(i) && Nodes[prev[j]].test(i))
-				{
-					pos++;
-					common=(int *)realloc(common,sizeof(int)*(pos+1));
-					common[pos]=i;
-					common[0]=pos;
-				}
-			}
-		}
-	}
-	//Construct indirect contacts
-	int ConSize=0;
-	int *Con=NULL;
-	for(int i=0;i<(int) DirectContacts.size();i++)
-	{
-		if(DirectContacts.test(i) && !IsInside(i,common))
-		{
-			ConSize++;
-			Con=(int *)realloc(Con,sizeof(int)*(ConSize));
-			Con[ConSize-1]=i;
-			InDirectContacts|=Nodes[i];
-		}
-		else
-		{
-			DirectContacts.set(i,false);
-		}
-	}
-	//Remove myself from Indirect contacts
-	InDirectContacts.set(this->NodeID,false);
-	//Also, remove direct contacts
-	for(int i=0;i<(int) DirectContacts.size();i++)
-	{
-		if(DirectContacts.test(i))
-		{
-			InDirectContacts.set(i,false);
-		}
-	}
-	//Remove prev hops from Indirect contacts
-	for(int j=1;j<=prev[0];j++)
-	{
-		InDirectContacts.set(prev[j],false);
-	}
-	
-	//Remove prev neighbors from indirect contacts (for all previous hops)
-	for(int j=1;j<=prev[0];j++)
-	{
-		tmp.reset();
-		tmp=InDirectContacts & Nodes[prev[j]];
-		InDirectContacts^=tmp;
-	}	
-	
-	
- 	#ifdef ADJ_DEBUG
-	printf("Common Contacts:");
-	for(int i=1;i<=common[0];i++)
-	{
-		printf("%d\t",common[i]);
-	}
-	printf("\n");
-	printf("Direct Contacts:");
-	PrintSet(&DirectContacts);
-	printf("Indirect Contacts:");
-	PrintSet(&InDirectContacts);
-	#endif
-	int which=-1;
-	int HowMany=-1;
-	int *forwarders=(int *)malloc(sizeof(int));
-	forwarders[0]=0;
-	int *Candidates=(int *)malloc(sizeof(int)*ConSize);
-	int position=0;
-	//printf("Node %d running GSC!\n",this->NodeID);
-	//printf("-------------------------\n");
-	while(!InDirectContacts.none())
-	{
-		//reset candidates
-		//printf("Candidates:");
-		for(int i=0;i<ConSize;i++)
- 		{
-			//printf("%d\t",Con[i]);
-			Candidates[i]=0;
-		}
-		//printf("\n");
-		which=-1;
-		HowMany=-1;
-		for(int i=0;i<ConSize;i++)
- 		{
-			if(Con[i] == -1)
-			{
-				continue;
-			}
-			tmp.reset();
-			tmp=Nodes[Con[i]] & InDirectContacts;
-			#ifdef ADJ_DEBUG
-			printf("Nodes that Node %d covers are: ",Con[i]);
-			PrintSet(&tmp);
-			#endif
-			//Keep track of draws
-			Candidates[i]=(int)tmp.count();
-			if(HowMany < (int)tmp.count())
-			{
-				HowMany=(int)tmp.count();
-				which=i;
-			}
-			#ifdef ADJ_DEBUG
-			printf("Number of Nodes  that Node %d covers is %d\n",Con[i],(int)tmp.count());
-			#endif
-		}
-		//Case of draw
-		#ifdef ADJ_DEBUG
-		printf("Checking draws..\n");
-		#endif
-		
-		//Create Draw Candidates
-		DrawCandidate *temp=NULL;
-		for(int i=0;i<ConSize;i++)
-		{
-			if(Candidates[i] == HowMany)
-			{
-				tmp.reset();
-				tmp=Nodes[Con[i]];
-				temp=new DrawCandidate(Con[i],Candidates[i],IsInside(Con[i],oldFWs),(int)tmp.count(),i);
-				Draw.push_back(temp);
-			}
-		}
-		//printf("Covered %d nodes\n",HowMany);
-		//PrintDraw(Draw);
-		
-		vector<DrawCandidate*>::iterator it;
-		//priority to newcomers
-		/*if(NotOldExists(Draw))
-		{
-			//At least one not-old-FWer exists in the candidate set
-			//Remove all old FWers (priority to newcomers)
-			vector<DrawCandidate*>::iterator it;
-			for ( it = Draw.begin(); it != Draw.end(); )
-			{
-				if((*it)->IsOldFW)
-				{
-					delete * it;  
-					it = Draw.erase(it);
-				}
-				else 
-				{
-					++it;
-				}
-			}
-
-			//Draw.erase(std::remove_if(Draw.begin(),Draw.end(),IsOld), Draw.end());
-		}*/
-		
-		
-		//priority to old forwarders
-		if(OldExists(Draw))
-		{
-			//At least one old-FWer exists in the candidate set
-			//Remove all new FWers (priority to old FWers)
-			vector<DrawCandidate*>::iterator it;
-			for ( it = Draw.begin(); it != Draw.end(); )
-			{
-				if(!((*it)->IsOldFW))
-				{
-					delete *it;  
-					it = Draw.erase(it);
-				}
-				else 
-				{
-					++it;
-				}
-			}
-			//Draw.erase(std::remove_if(Draw.begin(),Draw.end(),IsNew), Draw.end());
-		}
-		
-		
-		//printf("Getting priority!!\n");
-		//Give priority to the one that has the best degree
-		which=GetHighestDegree(Draw);
-		
-		//Draw.clear();
-		for ( it = Draw.begin(); it != Draw.end(); )
-		{
-			delete *it;  
-			it = Draw.erase(it);
-			
-		}
-		//printf("\n");
-		#ifdef ADJ_DEBUG
-		printf("Node %d that covers %d wins!\n",Con[which],HowMany);
-		#endif
-		tmp.reset();
-		tmp=InDirectContacts & Nodes[Con[which]];
-		InDirectContacts^=tmp;
-		//if(!IsInside(Con[which],oldFWs))
-		//{
-			//Add node to forwarders
-			position++;
-			forwarders=(int *)realloc(forwarders,sizeof(int)*(position+1));
-			forwarders[position]=Con[which];
-			forwarders[0]=position;
-		//}
-		//printf("Node %d wins!\n",Con[which]);
-		Con[which]=-1;
-		#ifdef ADJ_DEBUG
-		printf("Indirect contacts now become: ");
-		PrintSet(&InDirectContacts);
-		#endif
-	}
-	free(Con);
-	free(common);
 	#ifdef ADJ_DEBUG
 	printf("The forwarders are %d:",forwarders[0]);
 	for(int i=1;i<=forwarders[0];i++)
@@ -3535,6 +1999,107 @@ int *Adjacency::GetForwardingSet4(int *oldFWs,int *prev)
 	return forwarders;
 }
 
+
+/* GetForwardingSet
+ * ----------------
+ * Dominant pruning forwarding set. Draws are won by old forwarders and then by the
+ * candidate with the highest degree.
+ */
+int *Adjacency::GetForwardingSet(int *oldFWs,int prev)
+{
+	int prevs[2]={1,prev};
+	CoverRules rules={COVER_GAIN_SIZE,NULL,COVER_TIE_DEGREE,true,-1,oldFWs,0.0};
+	PrepareCover(oldFWs,prevs,0);
+	return GreedyCover(&rules);
+}
+
+/* GetForwardingSet2
+ * -----------------
+ * Same as GetForwardingSet() but old forwarders and the contacts shared with the previous
+ * hop are not candidates, and the neighbors of old forwarders are already covered. Draws
+ * are won by the candidate with the highest degree.
+ */
+int *Adjacency::GetForwardingSet2(int *oldFWs,int prev)
+{
+	int prevs[2]={1,prev};
+	CoverRules rules={COVER_GAIN_SIZE,NULL,COVER_TIE_DEGREE,false,-1,oldFWs,0.0};
+	PrepareCover(oldFWs,prevs,COVER_EXCLUDE_OLD | COVER_EXCLUDE_COMMON);
+	return GreedyCover(&rules);
+}
+
+/* GetForwardingSet3
+ * -----------------
+ * Same as GetForwardingSet2() for multiple previous hops, whose neighbors are also
+ * considered covered.
+ */
+int *Adjacency::GetForwardingSet3(int *oldFWs,int *prev)
+{
+	CoverRules rules={COVER_GAIN_SIZE,NULL,COVER_TIE_DEGREE,false,-1,oldFWs,0.0};
+	PrepareCover(oldFWs,prev,COVER_EXCLUDE_OLD | COVER_EXCLUDE_COMMON | COVER_PREV_NEIGHBORS);
+	return GreedyCover(&rules);
+}
+
+/* GetForwardingSetNew
+ * -------------------
+ * Candidates: N(u) - OLDFW - PREV
+ * Nodes to cover: N(N(u)) - u - OLDFW - PREV - N(u) - N(OLDFW) - N(PREV)
+ * Draws are won by the candidate with the highest degree.
+ */
+int *Adjacency::GetForwardingSetNew(int *oldFWs,int *prev)
+{
+	CoverRules rules={COVER_GAIN_SIZE,NULL,COVER_TIE_DEGREE,false,-1,oldFWs,0.0};
+	PrepareCover(oldFWs,prev,COVER_EXCLUDE_OLD | COVER_EXCLUDE_PREV | COVER_PREV_NEIGHBORS);
+	return GreedyCover(&rules);
+}
+
+/* GetForwardingSet5
+ * -----------------
+ * Same as GetForwardingSet3() but draws are won by the candidate with the highest
+ * (normalized) tie strength.
+ */
+int *Adjacency::GetForwardingSet5(int *oldFWs,int *prev,double Ctime)
+{
+	CoverRules rules={COVER_GAIN_SIZE,NULL,COVER_TIE_STRENGTH,false,-1,oldFWs,Ctime};
+	PrepareCover(oldFWs,prev,COVER_EXCLUDE_OLD | COVER_EXCLUDE_COMMON | COVER_PREV_NEIGHBORS);
+	return GreedyCover(&rules);
+}
+
+/* GetForwardingSetRecent
+ * ----------------------
+ * Same as GetForwardingSet5() but the gain of a candidate is its cover size weighted by
+ * its (normalized) tie strength.
+ */
+int *Adjacency::GetForwardingSetRecent(int *oldFWs,int *prev,double Ctime)
+{
+	CoverRules rules={COVER_GAIN_STRENGTH,NULL,COVER_TIE_STRENGTH,false,-1,oldFWs,Ctime};
+	PrepareCover(oldFWs,prev,COVER_EXCLUDE_OLD | COVER_EXCLUDE_COMMON | COVER_PREV_NEIGHBORS);
+	return GreedyCover(&rules);
+}
+
+/* GetForwardingSetPriority
+ * ------------------------
+ * Same as GetForwardingSet3() but when the best cover size equals "NodeinContact" the
+ * first candidate wins the draw.
+ */
+int *Adjacency::GetForwardingSetPriority(int *oldFWs,int *prev,int NodeinContact)
+{
+	CoverRules rules={COVER_GAIN_SIZE,NULL,COVER_TIE_DEGREE,false,NodeinContact,oldFWs,0.0};
+	PrepareCover(oldFWs,prev,COVER_EXCLUDE_OLD | COVER_EXCLUDE_COMMON | COVER_PREV_NEIGHBORS);
+	return GreedyCover(&rules);
+}
+
+/* GetForwardingSet4
+ * -----------------
+ * Same as GetForwardingSet3() but old forwarders remain candidates (and win draws).
+ */
+int *Adjacency::GetForwardingSet4(int *oldFWs,int *prev)
+{
+	CoverRules rules={COVER_GAIN_SIZE,NULL,COVER_TIE_DEGREE,true,-1,oldFWs,0.0};
+	PrepareCover(oldFWs,prev,COVER_EXCLUDE_COMMON | COVER_PREV_NEIGHBORS);
+	return GreedyCover(&rules);
+}
+
+
 int *Adjacency::GetBestFriends(int *Candidates)
 {
 	int *friends=(int *)malloc(sizeof(int));
@@ -3889,9 +2454,7 @@ void Adjacency::PrintSimilarities(void)
 
 int Adjacency::getEgoNetworkSize(void)
 {
-	dynamic_bitset<> MyN(Nodes[this->NodeID]);
-
-	return MyN.count();
+	return BitCount(RowWords(Nodes[this->NodeID],&(this->KernelRow[0])),this->RowBlocks);
 }
 
 
@@ -4044,279 +2607,112 @@ double AdjacencyWeights::GetWeight(int Neighbor, int Contact)
 	return(tmp);
 }
 
-
-void AdjacencyWeights::PrintWeights(void )
-{
-	printf("Weights stored in node %d\n",this->NodeID);
-	printf("==========================\n");
-
-	dynamic_bitset<> MyN(Nodes[this->NodeID]);
-	dynamic_bitset<> MyContactsN(Nodes[this->NodeID]);
-	for(int i=0;i<(int) MyN.size();i++)
-	{
-		if(MyN.test(i))
-		{
-			printf("From 1-hop contact %d to: ",i);
-			MyContactsN.reset();
-			MyContactsN=Nodes[i];
-			for(int j=0;j<(int) MyContactsN.size();j++)
-			{
-				if(MyContactsN.test(j))
-				{
-					printf("%d f:%f i:%f ",j,this->GetFreqWeight(i,j),this->GetIntWeight(i,j));
-				}
-			}
-			printf("\n");
-		}
-	}
-}
-
-int* AdjacencyWeights::GetForwardingSetRecent(int* oldFWs, int* prev, double Ctime)
-{
-	vector<DrawCandidate*> Draw;
-	//Take 2-Hop contacts
-	dynamic_bitset<> DirectContacts(Nodes[this->NodeID]);
-	dynamic_bitset<> InDirectContacts(Nodes[this->NodeID]);
-	dynamic_bitset<> tmp(Nodes[this->NodeID]);
-	InDirectContacts.reset();
-	tmp.reset();
-	
-	//Get common neighbors with previous nodes (nodes that try to forward the packet to me)
-	int *common=(int *)malloc(sizeof(int));
-	common[0]=0;
-	int pos=0;
-	for(int j=1;j<=prev[0];j++)
-	{
-		if(prev[j] != this->NodeID)
-		{
-			for(int i=0;i<(int) DirectContacts.size();i++)
-			{
-				if(DirectContacts.test(i) && Nodes[prev[j]].test(i))
-				{
-					pos++;
-					common=(int *)realloc(common,sizeof(int)*(pos+1));
-					common[pos]=i;
-					common[0]=pos;
-				}
-			}
-		}
-	}
-	
-	//Remove old forwarders from direct contacts
-	for(int i=0;i<(int) DirectContacts.size();i++)
-	{
-		if(DirectContacts.test(i) && IsInside(i,oldFWs))
-		{
-			DirectContacts.set(i,false);
-		}
-	}
-	
-	//Construct indirect contacts
-	int ConSize=0;
-	int *Con=NULL;
-	for(int i=0;i<(int) DirectContacts.size();i++)
-	{
-		if(DirectContacts.test(i) && !IsInside(i,common))
-		{
-			ConSize++;
-			Con=(int *)realloc(Con,sizeof(int)*(ConSize));
-			Con[ConSize-1]=i;
-			InDirectContacts|=Nodes[i];
-		}
-		else
-		{
-			DirectContacts.set(i,false);
-		}
-	}
-	//Remove myself from Indirect contacts
-	InDirectContacts.set(this->NodeID,false);
-	//Also, remove direct contacts
-	for(int i=0;i<(int) DirectContacts.size();i++)
-	{
-		if(DirectContacts.test(i))
-		{
-			InDirectContacts.set(i,false);
-		}
-	}
-	
-	//Remove prev hops from Indirect contacts
-	for(int j=1;j<=prev[0];j++)
-	{
-		InDirectContacts.set(prev[j],false);
-	}
-	//Remove old forwarders from indirect contacts
-	for(int i=0;i<(int) InDirectContacts.size();i++)
-	{
-		if(InDirectContacts.test(i))
-		{
-			for(int j=1;j<=oldFWs[0];j++)
-			{
-				if(oldFWs[j] == i)
-				{
-					InDirectContacts.set(i,false);
-					break;
-				}
-			}
-		}
-		
-	}
-	//Remove the neighbors of old forwarders from indirect contacts
-	for(int j=1;j<=oldFWs[0];j++)
-	{
-		tmp.reset();
-		tmp=InDirectContacts & Nodes[oldFWs[j]];
-		InDirectContacts^=tmp;
-	}
-	
-	//Remove prev neighbors from indirect contacts (for all previous hops)
-	for(int j=1;j<=prev[0];j++)
-	{
-		tmp.reset();
-		tmp=InDirectContacts & Nodes[prev[j]];
-		InDirectContacts^=tmp;
-	}	
-	
-	
- 	#ifdef ADJ_DEBUG
-	printf("Common Contacts:");
-	for(int i=1;i<=common[0];i++)
-	{
-		printf("%d\t",common[i]);
-	}
-	printf("\n");
-	printf("Direct Contacts:");
-	PrintSet(&DirectContacts);
-	printf("Indirect Contacts:");
-	PrintSet(&InDirectContacts);
-	#endif
-	int which=-1;
-	double HowMany=-1;
-	int *forwarders=(int *)malloc(sizeof(int));
-	forwarders[0]=0;
-	double *Candidates=(double *)malloc(sizeof(double)*ConSize);
-	int position=0;
-	double price=0.0;
-	double weightSum=0.0;
-	dynamic_bitset<> TwoHopContacts(Nodes[this->NodeID]);
-	//printf("Node %d running GSC!\n",this->NodeID);
-	//printf("-------------------------\n");
-	while(!InDirectContacts.none())
-	{
-		//reset candidates
-		//printf("Candidates:");
-		for(int i=0;i<ConSize;i++)
- 		{
-			//printf("%d\t",Con[i]);
-			Candidates[i]=0.0;
-		}
-		//printf("\n");
-		which=-1;
-		HowMany=-1.0;
-		for(int i=0;i<ConSize;i++)
- 		{
-			if(Con[i] == -1)
-			{
-				continue;
-			}
-			tmp.reset();
-			tmp=Nodes[Con[i]] & InDirectContacts;
-			#ifdef ADJ_DEBUG
-			printf("Nodes that Node %d covers are: ",Con[i]);
-			PrintSet(&tmp);
-			#endif
-			//Calculate Sum of weights between 1-hop contact and 2-hop contacts 
-			//(available through this 1-hop contact)
-			weightSum=0.0;
-			TwoHopContacts.reset();
-			TwoHopContacts=Nodes[Con[i]];
-			for(int k=0;k<(int) TwoHopContacts.size();k++)
+
+void AdjacencyWeights::PrintWeights(void )
+{
+	printf("Weights stored in node %d\n",this->NodeID);
+	printf("==========================\n");
+
+	dynamic_bitset<> MyN(Nodes[this->NodeID]);
+	dynamic_bitset<> MyContactsN(Nodes[this->NodeID]);
+	for(int i=0;i<(int) MyN.size();i++)
+	{
+		if(MyN.test(i))
+		{
+			printf("From 1-hop contact %d to: ",i);
+			MyContactsN.reset();
+			MyContactsN=Nodes[i];
+			for(int j=0;j<(int) MyContactsN.size();j++)
 			{
-				if(TwoHopContacts.test(k))
+				if(MyContactsN.test(j))
 				{
-					weightSum+=this->GetWeight(Con[i],k);
+					printf("%d f:%f i:%f ",j,this->GetFreqWeight(i,j),this->GetIntWeight(i,j));
 				}
 			}
-			price=this->NormalizedTieStrength(Con[i],Ctime)*weightSum;
-			//price=this->GetLSFUtility(Con[i],Ctime)*weightSum;
-			
-			Candidates[i]=price;
-// 			printf("%f\n",price);
-			if(HowMany < price)
-			{
-				HowMany=price;
-				which=i;
-			}
-			#ifdef ADJ_DEBUG
-			printf("Number of Nodes  that Node %d covers is %d\n",Con[i],(int)tmp.count());
-			#endif
+			printf("\n");
 		}
-		//Case of draw
-		#ifdef ADJ_DEBUG
-		printf("Checking draws..\n");
-		#endif
-		
-		//Create Draw Candidates
-		DrawCandidate *temp=NULL;
-		for(int i=0;i<ConSize;i++)
+	}
+}
+
+/* GetForwardingSetRecent
+ * ----------------------
+ * Same as Adjacency::GetForwardingSetRecent() but the gain of a candidate is the sum of
+ * the weights towards all its contacts, weighted by its (normalized) tie strength.
+ */
+int *AdjacencyWeights::GetForwardingSetRecent(int *oldFWs,int *prev,double Ctime)
+{
+	CoverRules rules={COVER_GAIN_STATIC,NULL,COVER_TIE_STRENGTH,false,-1,oldFWs,Ctime};
+	double weightSum=0.0;
+	PrepareCover(oldFWs,prev,COVER_EXCLUDE_OLD | COVER_EXCLUDE_COMMON | COVER_PREV_NEIGHBORS);
+	this->CoverPrices.resize(this->CoverCon.size());
+	for(unsigned int i=0;i<this->CoverCon.size();i++)
+	{
+		weightSum=0.0;
+		for(int k=0;k<(int) Nodes[this->CoverCon[i]].size();k++)
 		{
-			if(Candidates[i] == HowMany)
+			if(Nodes[this->CoverCon[i]].test(k))
 			{
-				tmp.reset();
-				tmp=Nodes[Con[i]];
-				temp=new DrawCandidate(Con[i],Candidates[i],IsInside(Con[i],oldFWs),(int)tmp.count(),i);
-				Draw.push_back(temp);
+				weightSum+=this->GetWeight(this->CoverCon[i],k);
 			}
 		}
-		//printf("Covered %d nodes\n",HowMany);
-		//PrintDraw(Draw);
-		
-		vector<DrawCandidate*>::iterator it;
-		//printf("Getting priority!!\n");
-		//Give priority to the one that has the best degree
-		//which=GetMostRecent(Draw,Ctime);
-		//which=GetMostFrequent(Draw);
-		which=GetBetterTieStrength(Draw,Ctime);
-		
-		for ( it = Draw.begin(); it != Draw.end(); )
-		{
-			delete *it;  
-			it = Draw.erase(it);
-			
-		}
-		Draw.clear();
-		//printf("\n");
-		#ifdef ADJ_DEBUG
-		printf("Node %d that covers %d wins!\n",Con[which],HowMany);
-		#endif
-		tmp.reset();
-		tmp=InDirectContacts & Nodes[Con[which]];
-		InDirectContacts^=tmp;
-		//if(!IsInside(Con[which],oldFWs))
-		//{
-			//Add node to forwarders
-			position++;
-			forwarders=(int *)realloc(forwarders,sizeof(int)*(position+1));
-			forwarders[position]=Con[which];
-			forwarders[0]=position;
-		//}
-		//printf("Node %d wins!\n",Con[which]);
-		Con[which]=-1;
-		#ifdef ADJ_DEBUG
-		printf("Indirect contacts now become: ");
-		PrintSet(&InDirectContacts);
-		#endif
+		this->CoverPrices[i]=this->NormalizedTieStrength(this->CoverCon[i],Ctime)*weightSum;
 	}
-	free(Con);
-	free(common);
-	#ifdef ADJ_DEBUG
-	printf("The forwarders are %d:",forwarders[0]);
-	for(int i=1;i<=forwarders[0];i++)
+	if(!this->CoverPrices.empty())
 	{
-		printf(" %d",forwarders[i]);
+		rules.StaticGain=&(this->CoverPrices[0]);
 	}
-	printf("\n");
-	#endif
-	return forwarders;
+	return GreedyCover(&rules);
+}
+
+
+/* Checkpoint
+ * ----------
+ * Saves or restores the contact graph together with the encounter history and the
+ * metrics derived from it. The scratch space of the metrics is not part of the state.
+ */
+void Adjacency::Checkpoint(Snapshot *snap)
+{
+	int i;
+	int j;
+	vector<unsigned long> blocks;
+
+
+	snap->Section("ADJA");
+	snap->Match(this->NSize, "number of nodes");
+	for(i = 0; i < this->NSize; i++)
+	{
+		blocks.clear();
+		if(snap->isSaving())
+		{
+			to_block_range(this->Nodes[i], back_inserter(blocks));
+		}
+		else
+		{
+			blocks.resize(this->Nodes[i].num_blocks());
+		}
+		for(j = 0; j < (int) blocks.size(); j++)
+		{
+			snap->Value(blocks[j]);
+		}
+		if(snap->isRestoring())
+		{
+			from_block_range(blocks.begin(), blocks.end(), this->Nodes[i]);
+		}
+	}
+	snap->Array(this->Similarities, this->NSize);
+	snap->Array(this->DisSimilarities, this->NSize);
+	snap->Value(this->Bet);
+	snap->Value(this->Effi);
+	snap->Array(this->numEncounters, this->NSize);
+	snap->Value(this->totalNumEncounters);
+	snap->Array(this->timeConnected, this->NSize);
+	snap->Value(this->totalTimeConnected);
+	snap->Array(this->lastTimeSeen, this->NSize);
+	snap->Value(this->lastUpdate);
+	snap->Array(this->activeContacts, this->NSize);
+	this->CA->Checkpoint(snap);
+
+	return;
 }
 
 
@@ -4359,18 +2755,158 @@ void GrowingTimeWindow::Update()
 }
 
 
+/* Constructor: EdgeRanking
+ * ------------------------
+ * Creates a ranking that activates (at least) the given number of edges.
+ */
+EdgeRanking::EdgeRanking(vector< dynamic_bitset<> > *p2Nodes,int NodeSize,int Edges)
+{
+	this->CG=p2Nodes;
+	this->NN=NodeSize;
+	if(Edges < 1)
+	{
+		printf("Error: The contact aggregation density is too low (no edges can be selected)!\nExiting\n");
+		exit(1);
+	}
+	this->K=(unsigned int)Edges;
+	this->Keys.assign(NodeSize*NodeSize,0.0);
+	this->Active.assign(NodeSize*NodeSize,false);
+	this->ActiveEdges=0;
+	return;
+}
+
+/* getThreshold
+ * ------------
+ * Returns the key that an edge must reach in order to be active. When less than K edges
+ * are ranked, every ranked edge is active.
+ */
+double EdgeRanking::getThreshold(void)
+{
+	if(this->Top.size() < this->K)
+	{
+		return -1.0;
+	}
+	return this->Top.begin()->first;
+}
+
+/* GetLeastKey
+ * -----------
+ * Returns the K-th highest key among all edges of the contact graph (edges that have not
+ * been ranked count as zero).
+ */
+double EdgeRanking::GetLeastKey(void)
+{
+	if(this->Top.size() < this->K)
+	{
+		return 0.0;
+	}
+	return this->Top.begin()->first;
+}
+
+/* refresh
+ * -------
+ * Sets or resets the given edge in the contact graph according to its key.
+ */
+void EdgeRanking::refresh(int Edge)
+{
+	bool on=(this->Keys[Edge] != 0.0 && this->Keys[Edge] >= getThreshold());
+	if(on == this->Active[Edge])
+	{
+		return;
+	}
+	this->Active[Edge]=on;
+	(*CG)[Edge / this->NN].set(Edge % this->NN,on);
+	(*CG)[Edge % this->NN].set(Edge / this->NN,on);
+	if(on)
+	{
+		this->ActiveEdges++;
+	}
+	else
+	{
+		this->ActiveEdges--;
+	}
+	return;
+}
+
+/* Rank
+ * ----
+ * Updates the key of the edge between Node1 and Node2 (a zero key removes the edge from the
+ * ranking) and updates the contact graph. Only the edges whose key lies between the previous
+ * and the new threshold may change state, so the whole graph is never scanned.
+ */
+void EdgeRanking::Rank(int Node1,int Node2,double Key)
+{
+	if(Node1 == Node2)
+	{
+		return;
+	}
+	int edge=(Node1 > Node2)?(Node1*this->NN+Node2):(Node2*this->NN+Node1);
+	int moved[2]={-1,-1};
+	double oldThreshold=getThreshold();
+	pair<double,int> entry(this->Keys[edge],edge);
+	
+	if(this->Keys[edge] != 0.0 && !this->Top.erase(entry))
+	{
+		this->Rest.erase(entry);
+	}
+	this->Keys[edge]=Key;
+	if(Key != 0.0)
+	{
+		this->Rest.insert(make_pair(Key,edge));
+	}
+	//Restore the invariant: Top holds the K highest keys
+	if(this->Top.size() < this->K && !this->Rest.empty())
+	{
+		entry=*(this->Rest.rbegin());
+		this->Rest.erase(entry);
+		this->Top.insert(entry);
+		moved[0]=entry.second;
+	}
+	else if(!this->Rest.empty() && !this->Top.empty() && *(this->Rest.rbegin()) > *(this->Top.begin()))
+	{
+		entry=*(this->Rest.rbegin());
+		pair<double,int> least=*(this->Top.begin());
+		this->Rest.erase(entry);
+		this->Top.erase(least);
+		this->Top.insert(entry);
+		this->Rest.insert(least);
+		moved[0]=entry.second;
+		moved[1]=least.second;
+	}
+	double newThreshold=getThreshold();
+	
+	refresh(edge);
+	for(int i=0;i<2;i++)
+	{
+		if(moved[i] != -1)
+		{
+			refresh(moved[i]);
+		}
+	}
+	//Edges that lie between the two thresholds
+	double low=(oldThreshold < newThreshold)?oldThreshold:newThreshold;
+	double high=(oldThreshold < newThreshold)?newThreshold:oldThreshold;
+	set< pair<double,int> >::iterator it;
+	for(it=this->Rest.lower_bound(make_pair(low,-1));it != this->Rest.end() && it->first < high;++it)
+	{
+		refresh(it->second);
+	}
+	return;
+}
+
+
 SlidingWindow::SlidingWindow(vector< dynamic_bitset<> > *p2Nodes,int NodeSize,double window): ContactAggregation(p2Nodes)
 {
 	this->WindowSize=window;
 	this->NN=NodeSize;
-	this->Oldest=-1.0;
 	//Allocate memory
 	this->ContactTime=(double**)malloc(sizeof(double*)*(this->NN));
 	for(int i=0;i<this->NN;i++)
 	{
 		this->ContactTime[i]=(double*)malloc(sizeof(double)*(this->NN));
 	}
-	//Initialize
+	//Initialize (-1 marks a pair that has never met or whose last contact left the window,
+	//so it is not an edge)
 	for(int i=0;i<this->NN;i++)
 	{
 		for(int j=0;j<this->NN;j++)
@@ -4397,53 +2933,46 @@ void SlidingWindow::Connect(int Node1,int Node2,double ConTime)
 	this->ContactTime[Node1][Node2]=ConTime;
 	this->ContactTime[Node2][Node1]=ConTime;
 	
-	//Case all edges are inside the window - update is not needed 
-	if((this->Oldest > 0.0) && (ConTime - this->Oldest) <= this->WindowSize)
+	if(Node1 != Node2)
 	{
-		return;
+		(*CG)[Node1].set(Node2,true);
+		(*CG)[Node2].set(Node1,true);
+		//Remember when the edge has to be checked again
+		this->Expiry.push(make_pair(ConTime,Node1*this->NN+Node2));
 	}
-	this->ReCreateContactGraph(ConTime);
+	this->ExpireEdges(ConTime);
 }
 
-void SlidingWindow::ReCreateContactGraph(double ConTime)
+/* ExpireEdges
+ * -----------
+ * Removes the edges that fell out of the window. The expiry queue is ordered by contact
+ * time, so only the edges that actually expired are visited. Queue entries that refer to
+ * an older contact of an edge that was seen again are discarded.
+ */
+void SlidingWindow::ExpireEdges(double ConTime)
 {
-	//Reset Contact Graph
-	for(int i=0;i<this->NN;i++)
-	{
-		(*CG)[i].reset();
-	}
-	
-	double min=-1.0;
-	for(int i=0;i<this->NN;i++)
+	int i,j;
+	while(!this->Expiry.empty())
 	{
-		for(int j=0;j<i;j++)
+		i=this->Expiry.top().second / this->NN;
+		j=this->Expiry.top().second % this->NN;
+		if(this->ContactTime[i][j] != this->Expiry.top().first)
 		{
-			//skip edges that are not set
-			if(this->ContactTime[i][j] < -1.0)
-			{
-				continue;
-			}
-			//Remove the old edges
-			if((ConTime-this->ContactTime[i][j]) > this->WindowSize)
-			{	
-				this->ContactTime[i][j]=-1.0;
-				this->ContactTime[j][i]=-1.0;
-			}
-			else
-			{
-				//Find oldest contact time for the remaining edges
-				if(min > this->ContactTime[i][j] || min < 0.0)
-				{
-					min=this->ContactTime[i][j];
-				}
-				//Update the contact graph
-				(*CG)[i].set(j,true);
-				(*CG)[j].set(i,true);
-			}
+			//Outdated entry
+			this->Expiry.pop();
+			continue;
+		}
+		if((ConTime-this->ContactTime[i][j]) <= this->WindowSize)
+		{
+			//The remaining edges are inside the window
+			break;
 		}
+		this->ContactTime[i][j]=-1.0;
+		this->ContactTime[j][i]=-1.0;
+		(*CG)[i].set(j,false);
+		(*CG)[j].set(i,false);
+		this->Expiry.pop();
 	}
-	//Finally set the value of the oldest edge
-	this->Oldest=min;
 	return;
 }
 
@@ -4459,7 +2988,6 @@ MFaggregation::MFaggregation(int NodeSize,vector< dynamic_bitset<> > *p2Nodes,do
 	this->CurrentDensity=0.0;
 	this->TargetDensity=Density;
 	this->ActiveEdges=0;
-	this->NumEdgesLimit=0;
 	this->AllEdges=(NodeSize*(NodeSize-1))/2;
 	this->MostFrequent=(double **)malloc(sizeof(double *)*NodeSize);
 	for(int i=0;i<NodeSize;i++)
@@ -4470,6 +2998,7 @@ MFaggregation::MFaggregation(int NodeSize,vector< dynamic_bitset<> > *p2Nodes,do
 			this->MostFrequent[i][j]=0.0;
 		}
 	}
+	this->Ranking=new EdgeRanking(p2Nodes,NodeSize,(int)(this->TargetDensity*this->AllEdges));
 	return;
 }
 
@@ -4480,37 +3009,22 @@ MFaggregation::~MFaggregation()
 		free(MostFrequent[i]);
 	}
 	free(MostFrequent);
+	delete Ranking;
 	return;
 }
 
 
 void MFaggregation::Connect(int Node1,int Node2,double ConTime)
 {
-	//Get the old frequency value of the pair of nodes that is going to be updated
-	double OldFreq=this->MostFrequent[Node1][Node2];
 	//Set Frequency - Number of meetings (total number of contacts)
 	this->MostFrequent[Node1][Node2]++;
 	this->MostFrequent[Node2][Node1]++;
 	
-	/*case: edge between node1 and node 2 is already active
-	 * and hasn't got weight value equal to the weight limit
-	 */
-	if(OldFreq > this->FreqLimit && this->FreqLimit != 0.0)
-	{
-		return;
-	}
-	
-	/*case: edge between node1 and node 2 is not active,
-	 * hasn't got weight value greater than the weight limit and
-	 * the density cannot be increased
-	 */
-	double NewDensity=(double)(this->ActiveEdges+1)/(double)this->AllEdges;
-	if(this->MostFrequent[Node1][Node2] < this->FreqLimit && NewDensity > this->TargetDensity)
-	{
-		return;
-	}
-	
-	this->ReCreateContactGraph();
+	//Keep the most frequent edges (according to the given density)
+	this->Ranking->Rank(Node1,Node2,this->MostFrequent[Node1][Node2]);
+	this->FreqLimit=this->Ranking->GetLeastKey();
+	this->ActiveEdges=this->Ranking->GetActiveEdges();
+	this->CurrentDensity=(double)((double)this->ActiveEdges/(double)this->AllEdges);
 	
 	#ifdef ADJ_DEBUG
 	printf("Active Edges:%d\n",this->ActiveEdges);
@@ -4519,66 +3033,6 @@ void MFaggregation::Connect(int Node1,int Node2,double ConTime)
 	return;
 }
 
-bool Sortingfunction (double i,double j) { return (i>j); }
-
-void MFaggregation::ReCreateContactGraph(void)
-{
-	//Reset Contact Graph
-	for(int i=0;i<this->NN;i++)
-	{
-		(*CG)[i].reset();
-	}
-	
-	int EdgestoChoose=(int)(this->TargetDensity*this->AllEdges);
-	
-	//Create a vector with all weights and sort it
-	vector<double> Weights;
-	for(int i=0;i<this->NN;i++)
-	{
-		for(int j=0;j<i;j++)
-		{
-			Weights.push_back(this->MostFrequent[i][j]);
-		}
-	}
-	sort(Weights.begin(),Weights.end(),Sortingfunction);
-	//Take the least weight value (according to the given density)
-	double LeastW=Weights.at((EdgestoChoose-1));
-	//Update the FreqLimit attribute that "remembers" the last frequency limit
-	this->FreqLimit=LeastW;
-	double MaxW=Weights.at(0);
-	#ifdef ADJ_DEBUG
-	printf("Leastw:%f\tMaxW:%f\n",LeastW,MaxW);
-	#endif
-	if(!(MaxW != 0.0))
-	{
-		return;
-	}
-	
-	//Create the contact graph (containing 0s and 1s)
-	this->ActiveEdges=0;
-	this->NumEdgesLimit=0;
-	for(int i=0;i<this->NN;i++)
-	{
-		for(int j=0;j<i;j++)
-		{
-			if(this->MostFrequent[i][j] >= LeastW && this->MostFrequent[i][j] != 0.0)
-			{
-				if(this->MostFrequent[i][j] == LeastW)
-				{
-					this->NumEdgesLimit++;
-				}
-				this->ActiveEdges++;
-				(*CG)[i].set(j,true);
-				(*CG)[j].set(i,true);
-			}
-		}
-	}
-// 	this->ActiveEdges=this->ActiveEdges/2;
-// 	this->NumEdgesLimit=this->NumEdgesLimit/2;
-	this->CurrentDensity=(double)((double)this->ActiveEdges/(double)this->AllEdges);
-	return;
-}
-
 void MFaggregation::Update(void)
 {
 	return;
@@ -4592,7 +3046,6 @@ MRaggregation::MRaggregation(int NodeSize,vector< dynamic_bitset<> > *p2Nodes,do
 	this->CurrentDensity=0.0;
 	this->TargetDensity=Density;
 	this->ActiveEdges=0;
-	this->NumEdgesLimit=0;
 	this->AllEdges=(NodeSize*(NodeSize-1))/2;
 	this->LastSeen=(double **)malloc(sizeof(double *)*NodeSize);
 	for(int i=0;i<NodeSize;i++)
@@ -4603,6 +3056,7 @@ MRaggregation::MRaggregation(int NodeSize,vector< dynamic_bitset<> > *p2Nodes,do
 			this->LastSeen[i][j]=0.0;
 		}
 	}
+	this->Ranking=new EdgeRanking(p2Nodes,NodeSize,(int)(this->TargetDensity*this->AllEdges));
 	return;
 }
 
@@ -4613,6 +3067,7 @@ MRaggregation::~MRaggregation()
 		free(LastSeen[i]);
 	}
 	free(LastSeen);
+	delete Ranking;
 	return;
 }
 
@@ -4623,95 +3078,25 @@ void MRaggregation::Connect(int Node1,int Node2,double ConTime)
 	this->LastSeen[Node1][Node2]=ConTime;
 	this->LastSeen[Node2][Node1]=ConTime;
 	
-// 	double NewDensity=(double)(this->ActiveEdges+1)/(double)this->AllEdges;
-// 	if(this->MostFrequent[Node1][Node2] < this->FreqLimit && NewDensity > this->TargetDensity)
-// 	{
-// 		return;
-// 	}
-	
-	this->ReCreateContactGraph(ConTime);
-	
-	#ifdef ADJ_DEBUG
-	printf("Active Edges:%d\n",this->ActiveEdges);
-	printf("Current Density:%f\tTarget Density:%f\n",this->CurrentDensity,this->TargetDensity);
-	#endif
-	return;
-}
-
-
-void MRaggregation::ReCreateContactGraph(double ConTime)
-{
-	//Reset Contact Graph
-	for(int i=0;i<this->NN;i++)
+	/* The recency weight 1/(1+ConTime-LastSeen) preserves the order of the last contact
+	 * times, so the most recent edges are the ones with the highest LastSeen value */
+	this->Ranking->Rank(Node1,Node2,ConTime);
+	double LeastSeen=this->Ranking->GetLeastKey();
+	if(LeastSeen != 0.0)
 	{
-		(*CG)[i].reset();
+		this->RecencyLimit=(1.0/(1.0+(ConTime-LeastSeen)));
 	}
-	
-	int EdgestoChoose=(int)(this->TargetDensity*this->AllEdges);
-	
-	//Create a vector with all weights and sort it
-	vector<double> Weights;
-	double diff=0;
-	for(int i=0;i<this->NN;i++)
+	else
 	{
-		for(int j=0;j<i;j++)
-		{
-			if(this->LastSeen[i][j] != 0.0)
-			{
-				diff=ConTime-this->LastSeen[i][j];
-				diff=(1.0/(1.0+diff));
-			}
-			else
-			{
-				diff=0.0;
-			}
-			Weights.push_back(diff);
-		}
+		this->RecencyLimit=0.0;
 	}
-	sort(Weights.begin(),Weights.end(),Sortingfunction);
-	//Take the least weight value (according to the given density)
-	double LeastW=Weights.at((EdgestoChoose-1));
-	//Update the RecencyLimit attribute that "remembers" the last Recency limit
-	this->RecencyLimit=LeastW;
-	double MaxW=Weights.at(0);
+	this->ActiveEdges=this->Ranking->GetActiveEdges();
+	this->CurrentDensity=(double)((double)this->ActiveEdges/(double)this->AllEdges);
+	
 	#ifdef ADJ_DEBUG
-	printf("Leastw:%f\tMaxW:%f\n",LeastW,MaxW);
+	printf("Active Edges:%d\n",this->ActiveEdges);
+	printf("Current Density:%f\tTarget Density:%f\n",this->CurrentDensity,this->TargetDensity);
 	#endif
-	if(!(MaxW != 0.0))
-	{
-		return;
-	}
-	
-	//Create the contact graph (containing 0s and 1s)
-	this->ActiveEdges=0;
-	this->NumEdgesLimit=0;
-	diff=0.0;
-	for(int i=0;i<this->NN;i++)
-	{
-		for(int j=0;j<i;j++)
-		{
-			if(this->LastSeen[i][j] != 0.0)
-			{
-				diff=ConTime-this->LastSeen[i][j];
-				diff=(1.0/(1.0+diff));
-			}
-			else
-			{
-				diff=0.0;
-			}
-			if(diff >= LeastW && this->LastSeen[i][j] != 0.0)
-			{
-				if(diff == LeastW)
-				{
-					this->NumEdgesLimit++;
-				}
-				this->ActiveEdges++;
-				(*CG)[i].set(j,true);
-				(*CG)[j].set(i,true);
-			}
-		}
-	}
-	this->CurrentDensity=(double)((double)this->ActiveEdges/(double)this->AllEdges);
 	return;
 }
 
@@ -27,8 +27,21 @@
 #include <limits.h>
 #include <bitset>
 #include <vector>
+#include <set>
+#include <queue>
+#include <iterator>
 #include <boost/dynamic_bitset.hpp>
 
+#ifndef BIT_KERNELS_H
+	#define BIT_KERNELS_H
+	#include "BitKernels.h"
+#endif
+
+#ifndef SNAPSHOT_H
+	#define SNAPSHOT_H
+	#include "../core/Snapshot.h"
+#endif
+
 using namespace boost;
 using namespace std;
 using std::vector;
@@ -50,6 +63,31 @@ public:
 	~DrawCandidate(void){return;};
 };
 
+/* Options that shape the 2-hop set cover problem of the dominant pruning forwarding sets */
+#define COVER_EXCLUDE_OLD 1
+#define COVER_EXCLUDE_COMMON 2
+#define COVER_EXCLUDE_PREV 4
+#define COVER_PREV_NEIGHBORS 8
+
+#define COVER_GAIN_SIZE 0
+#define COVER_GAIN_STRENGTH 1
+#define COVER_GAIN_STATIC 2
+
+#define COVER_TIE_DEGREE 0
+#define COVER_TIE_STRENGTH 1
+
+/* Rules of the greedy set cover (see Adjacency::GreedyCover) */
+struct CoverRules
+{
+	int Gain;
+	double *StaticGain;
+	int Tie;
+	bool OldFirst;
+	int FirstIfGain;
+	int *oldFWs;
+	double Ctime;
+};
+
 class Adjacency
 {
 	friend class ContactAggregation;
@@ -74,11 +112,36 @@ protected:
 	
 	ContactAggregation *CA;
 	
+	//Scratch space of the similarity and betweenness metrics
+	int RowBlocks;
+	vector<unsigned long> KernelRow;
+	vector<unsigned long> KernelMask;
+	vector<unsigned long> KernelRows;
+	vector<int> KernelIDs;
+	unsigned long *LoadRows(const int *IDs,int num,int first);
+	
+	//Scratch space of the greedy set cover
+	vector<unsigned long> CoverMatrix;
+	vector<unsigned long> CoverDirect;
+	vector<unsigned long> CoverCommon;
+	vector<unsigned long> CoverLeft;
+	vector<int> CoverCon;
+	vector<int> CoverRound;
+	vector<int> CoverTies;
+	vector<double> CoverTieKey;
+	vector< pair<double,int> > CoverHeap;
+	int CoverWords;
+	void PrepareCover(int *oldFWs,int *prev,int Options);
+	int *GreedyCover(CoverRules *Rules);
+	double CoverGain(int pos,CoverRules *Rules);
+	double CoverTie(int pos,CoverRules *Rules);
+	
 public:
 	Adjacency(int ID, int NodeSize, int AggregationType, double argument);
 	Adjacency(int ID, int NodeSize);
 	virtual ~Adjacency();
 	void init(int ID, int NodeSize, int AggregationType, double argument);
+	void Checkpoint(Snapshot *snap);
 	//Basic methods
 	void PrintAdjacency();
 	void SetConnection(int Node1, int Node2, double ConTime);
@@ -171,6 +234,7 @@ class AdjacencyWeights:public Adjacency
 protected:
 	double **IntimacyWeight;
 	double **FreqWeight;
+	vector<double> CoverPrices;
 	
 public:
 	AdjacencyWeights(int ID,int NodeSize);
@@ -199,6 +263,7 @@ public:
 	virtual ~ContactAggregation();
 	virtual void Update(void)=0;
 	virtual void Connect(int Node1,int Node2,double ConTime)=0;
+	virtual void Checkpoint(Snapshot *snap){snap->Unsupported("this contact aggregation type");};
 };
 
 
@@ -209,6 +274,35 @@ public:
 	~GrowingTimeWindow();
 	virtual void Update();
 	virtual void Connect(int Node1, int Node2, double ConTime);
+	virtual void Checkpoint(Snapshot *snap){return;};
+};
+
+
+/* EdgeRanking
+ * -----------
+ * Keeps the K edges of the contact graph with the highest key (e.g. number of contacts or
+ * last contact time) in the "Top" set and the remaining ranked edges in the "Rest" set.
+ * An edge is active (set in the contact graph) when its key is at least equal to the
+ * K-th highest key, or when less than K edges are ranked.
+ */
+class EdgeRanking
+{
+protected:
+	vector< dynamic_bitset<> > *CG;
+	int NN;
+	unsigned int K;
+	vector<double> Keys;
+	vector<bool> Active;
+	set< pair<double,int> > Top;
+	set< pair<double,int> > Rest;
+	int ActiveEdges;
+	void refresh(int Edge);
+	double getThreshold(void);
+public:
+	EdgeRanking(vector< dynamic_bitset<> > *p2Nodes,int NodeSize,int Edges);
+	void Rank(int Node1,int Node2,double Key);
+	double GetLeastKey(void);
+	int GetActiveEdges(void){return this->ActiveEdges;};
 };
 
 
@@ -218,14 +312,14 @@ protected:
 	double **ContactTime;
 	double WindowSize;
 	int NN;
-	double Oldest;
+	priority_queue< pair<double,int>,vector< pair<double,int> >,greater< pair<double,int> > > Expiry;
 public:
 	SlidingWindow(vector< dynamic_bitset<> > *p2Nodes,int NodeSize,double window);
 	~SlidingWindow();
 	virtual void Update(void);
 	virtual void Connect(int Node1,int Node2,double ConTime);
 private:
-	void ReCreateContactGraph(double ConTime);
+	void ExpireEdges(double ConTime);
 };
 
 
@@ -239,14 +333,12 @@ protected:
 	int AllEdges;
 	double FreqLimit;
 	int NN;
-	int NumEdgesLimit;
+	EdgeRanking *Ranking;
 public:
 	MFaggregation(int NodeSize,vector< dynamic_bitset<> > *p2Nodes,double Density);
 	~MFaggregation();
 	virtual void Update(void);
 	virtual void Connect(int Node1,int Node2,double ConTime);
-private:
-	void ReCreateContactGraph(void);
 };
 
 
@@ -260,13 +352,10 @@ protected:
 	int AllEdges;
 	double RecencyLimit;
 	int NN;
-	int NumEdgesLimit;
+	EdgeRanking *Ranking;
 public:
 	MRaggregation(int NodeSize,vector< dynamic_bitset<> > *p2Nodes,double Density);
 	~MRaggregation();
 	virtual void Update(void);
 	virtual void Connect(int Node1,int Node2,double ConTime);
-private:
-	void ReCreateContactGraph(double ConTime);
 };
-
@@ -0,0 +1,363 @@
+/*
+ *  Adyton: A Network Simulator for Opportunistic Networks
+ *  Copyright (C) 2015  Nikolaos Papanikos, Dimitrios-Georgios Akestoridis,
+ *  and Evangelos Papapetrou
+ *
+ *  This file is part of Adyton.
+ *
+ *  Adyton is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Adyton is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Adyton.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef BIT_KERNELS_H
+	#define BIT_KERNELS_H
+	#include "BitKernels.h"
+#endif
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+	#define BIT_KERNELS_X86
+	#include <immintrin.h>
+#endif
+
+
+/* Portable implementation */
+
+static inline int PortableCount(unsigned long w)
+{
+	unsigned long long x=(unsigned long long)w;
+
+	x=x-((x>>1)&0x5555555555555555ULL);
+	x=(x&0x3333333333333333ULL)+((x>>2)&0x3333333333333333ULL);
+	x=(x+(x>>4))&0x0F0F0F0F0F0F0F0FULL;
+	return (int)((x*0x0101010101010101ULL)>>56);
+}
+
+
+static int PortableAndCount(const unsigned long *a, const unsigned long *b, int words)
+{
+	int count=0;
+
+	for(int i=0;i<words;i++)
+	{
+		count+=PortableCount(a[i]&b[i]);
+	}
+	return count;
+}
+
+
+static int PortableAndNotCount(const unsigned long *a, const unsigned long *b, int words)
+{
+	int count=0;
+
+	for(int i=0;i<words;i++)
+	{
+		count+=PortableCount(a[i]&~b[i]);
+	}
+	return count;
+}
+
+
+static int PortableBitCount(const unsigned long *a, int words)
+{
+	int count=0;
+
+	for(int i=0;i<words;i++)
+	{
+		count+=PortableCount(a[i]);
+	}
+	return count;
+}
+
+
+static void PortableOrInto(unsigned long *dst, const unsigned long *src, int words)
+{
+	for(int i=0;i<words;i++)
+	{
+		dst[i]|=src[i];
+	}
+	return;
+}
+
+
+#ifdef BIT_KERNELS_X86
+
+/* POPCNT implementation */
+
+__attribute__((target("popcnt")))
+static int PopcntAndCount(const unsigned long *a, const unsigned long *b, int words)
+{
+	int count=0;
+
+	for(int i=0;i<words;i++)
+	{
+		count+=__builtin_popcountl(a[i]&b[i]);
+	}
+	return count;
+}
+
+
+__attribute__((target("popcnt")))
+static int PopcntAndNotCount(const unsigned long *a, const unsigned long *b, int words)
+{
+	int count=0;
+
+	for(int i=0;i<words;i++)
+	{
+		count+=__builtin_popcountl(a[i]&~b[i]);
+	}
+	return count;
+}
+
+
+__attribute__((target("popcnt")))
+static int PopcntBitCount(const unsigned long *a, int words)
+{
+	int count=0;
+
+	for(int i=0;i<words;i++)
+	{
+		count+=__builtin_popcountl(a[i]);
+	}
+	return count;
+}
+
+
+/* AVX2 implementation (64-bit words only)
+ * -------------------
+ * Counts four words at a time with the nibble lookup method: each byte is split into two
+ * nibbles whose bit counts are looked up with a byte shuffle, and the per-byte counts are
+ * summed into 64-bit lanes with SAD. The remaining words are counted with POPCNT.
+ */
+
+__attribute__((target("avx2")))
+static inline __m256i Avx2Count(__m256i v)
+{
+	const __m256i lookup=_mm256_setr_epi8(0,1,1,2,1,2,2,3,1,2,2,3,2,3,3,4,0,1,1,2,1,2,2,3,1,2,2,3,2,3,3,4);
+	const __m256i low=_mm256_set1_epi8(0x0F);
+	__m256i lo=_mm256_and_si256(v,low);
+	__m256i hi=_mm256_and_si256(_mm256_srli_epi16(v,4),low);
+	__m256i cnt=_mm256_add_epi8(_mm256_shuffle_epi8(lookup,lo),_mm256_shuffle_epi8(lookup,hi));
+
+	return _mm256_sad_epu8(cnt,_mm256_setzero_si256());
+}
+
+
+__attribute__((target("avx2")))
+static inline int Avx2Sum(__m256i acc)
+{
+	long long lanes[4];
+
+	_mm256_storeu_si256((__m256i *)lanes,acc);
+	return (int)(lanes[0]+lanes[1]+lanes[2]+lanes[3]);
+}
+
+
+__attribute__((target("avx2,popcnt")))
+static int Avx2AndCount(const unsigned long *a, const unsigned long *b, int words)
+{
+	__m256i acc=_mm256_setzero_si256();
+	int i=0;
+
+	for(;i+4<=words;i+=4)
+	{
+		__m256i va=_mm256_loadu_si256((const __m256i *)(a+i));
+		__m256i vb=_mm256_loadu_si256((const __m256i *)(b+i));
+		acc=_mm256_add_epi64(acc,Avx2Count(_mm256_and_si256(va,vb)));
+	}
+	int count=Avx2Sum(acc);
+	for(;i<words;i++)
+	{
+		count+=__builtin_popcountl(a[i]&b[i]);
+	}
+	return count;
+}
+
+
+__attribute__((target("avx2,popcnt")))
+static int Avx2AndNotCount(const unsigned long *a, const unsigned long *b, int words)
+{
+	__m256i acc=_mm256_setzero_si256();
+	int i=0;
+
+	for(;i+4<=words;i+=4)
+	{
+		__m256i va=_mm256_loadu_si256((const __m256i *)(a+i));
+		__m256i vb=_mm256_loadu_si256((const __m256i *)(b+i));
+		acc=_mm256_add_epi64(acc,Avx2Count(_mm256_andnot_si256(vb,va)));
+	}
+	int count=Avx2Sum(acc);
+	for(;i<words;i++)
+	{
+		count+=__builtin_popcountl(a[i]&~b[i]);
+	}
+	return count;
+}
+
+
+__attribute__((target("avx2,popcnt")))
+static int Avx2BitCount(const unsigned long *a, int words)
+{
+	__m256i acc=_mm256_setzero_si256();
+	int i=0;
+
+	for(;i+4<=words;i+=4)
+	{
+		acc=_mm256_add_epi64(acc,Avx2Count(_mm256_loadu_si256((const __m256i *)(a+i))));
+	}
+	int count=Avx2Sum(acc);
+	for(;i<words;i++)
+	{
+		count+=__builtin_popcountl(a[i]);
+	}
+	return count;
+}
+
+
+__attribute__((target("avx2")))
+static void Avx2OrInto(unsigned long *dst, const unsigned long *src, int words)
+{
+	int i=0;
+
+	for(;i+4<=words;i+=4)
+	{
+		__m256i vd=_mm256_loadu_si256((const __m256i *)(dst+i));
+		__m256i vs=_mm256_loadu_si256((const __m256i *)(src+i));
+		_mm256_storeu_si256((__m256i *)(dst+i),_mm256_or_si256(vd,vs));
+	}
+	for(;i<words;i++)
+	{
+		dst[i]|=src[i];
+	}
+	return;
+}
+
+#endif
+
+
+/* Dispatch */
+
+struct BitKernelTable
+{
+	int (*AndCount)(const unsigned long *, const unsigned long *, int);
+	int (*AndNotCount)(const unsigned long *, const unsigned long *, int);
+	int (*BitCount)(const unsigned long *, int);
+	void (*OrInto)(unsigned long *, const unsigned long *, int);
+};
+
+
+static BitKernelTable SelectKernels(void)
+{
+	BitKernelTable table={PortableAndCount,PortableAndNotCount,PortableBitCount,PortableOrInto};
+
+	#ifdef BIT_KERNELS_X86
+	__builtin_cpu_init();
+	if(__builtin_cpu_supports("popcnt"))
+	{
+		table.AndCount=PopcntAndCount;
+		table.AndNotCount=PopcntAndNotCount;
+		table.BitCount=PopcntBitCount;
+		if(sizeof(unsigned long) == 8 && __builtin_cpu_supports("avx2"))
+		{
+			table.AndCount=Avx2AndCount;
+			table.AndNotCount=Avx2AndNotCount;
+			table.BitCount=Avx2BitCount;
+			table.OrInto=Avx2OrInto;
+		}
+	}
+	#endif
+	return table;
+}
+
+
+/* The selection runs on first use, so it does not depend on the initialization order of
+ * other translation units */
+static const BitKernelTable &Kernels(void)
+{
+	static const BitKernelTable table=SelectKernels();
+
+	return table;
+}
+
+
+int AndCount(const unsigned long *a, const unsigned long *b, int words)
+{
+	return Kernels().AndCount(a,b,words);
+}
+
+
+int AndNotCount(const unsigned long *a, const unsigned long *b, int words)
+{
+	return Kernels().AndNotCount(a,b,words);
+}
+
+
+int BitCount(const unsigned long *a, int words)
+{
+	return Kernels().BitCount(a,words);
+}
+
+
+void OrInto(unsigned long *dst, const unsigned long *src, int words)
+{
+	Kernels().OrInto(dst,src,words);
+	return;
+}
+
+
+void AndInto(unsigned long *dst, const unsigned long *a, const unsigned long *b, int words)
+{
+	for(int i=0;i<words;i++)
+	{
+		dst[i]=a[i]&b[i];
+	}
+	return;
+}
+
+
+void AndNotInto(unsigned long *dst, const unsigned long *a, const unsigned long *b, int words)
+{
+	for(int i=0;i<words;i++)
+	{
+		dst[i]=a[i]&~b[i];
+	}
+	return;
+}
+
+
+int SetBits(const unsigned long *a, int words, int *IDs)
+{
+	const int bits=8*sizeof(unsigned long);
+	int runner=0;
+
+	for(int i=0;i<words;i++)
+	{
+		unsigned long w=a[i];
+		while(w)
+		{
+			#if defined(__GNUC__) || defined(__clang__)
+			IDs[runner]=i*bits+__builtin_ctzl(w);
+			#else
+			int pos=0;
+			while(!((w>>pos)&1UL))
+			{
+				pos++;
+			}
+			IDs[runner]=i*bits+pos;
+			#endif
+			runner++;
+			w&=w-1;
+		}
+	}
+	return runner;
+}
@@ -0,0 +1,63 @@
+/*
+ *  Adyton: A Network Simulator for Opportunistic Networks
+ *  Copyright (C) 2015  Nikolaos Papanikos, Dimitrios-Georgios Akestoridis,
+ *  and Evangelos Papapetrou
+ *
+ *  This file is part of Adyton.
+ *
+ *  Adyton is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Adyton is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Adyton.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <boost/dynamic_bitset.hpp>
+
+using namespace std;
+
+
+/* Row access
+ * ----------
+ * Copies the blocks of a dynamic_bitset to words, which must have room for num_blocks()
+ * words, and returns words. Unused bits of the highest block are always zero, so whole
+ * blocks can be counted.
+ */
+inline unsigned long *RowWords(const boost::dynamic_bitset<>& row, unsigned long *words)
+{
+	boost::to_block_range(row,words);
+	return words;
+}
+
+
+/* Bit kernels
+ * -----------
+ * Word-parallel operations on rows of the contact graph. All rows have the same number of
+ * words. The implementation (AVX2, POPCNT or portable) is chosen on first use
+ * according to the capabilities of the running CPU.
+ */
+
+/* Number of bits set in (a AND b) */
+int AndCount(const unsigned long *a, const unsigned long *b, int words);
+/* Number of bits set in (a AND NOT b) */
+int AndNotCount(const unsigned long *a, const unsigned long *b, int words);
+/* Number of bits set in a */
+int BitCount(const unsigned long *a, int words);
+/* dst = dst OR src */
+void OrInto(unsigned long *dst, const unsigned long *src, int words);
+/* dst = a AND b */
+void AndInto(unsigned long *dst, const unsigned long *a, const unsigned long *b, int words);
+/* dst = a AND NOT b */
+void AndNotInto(unsigned long *dst, const unsigned long *a, const unsigned long *b, int words);
+/* Stores the positions of the set bits of a in IDs (ascending) and returns their number */
+int SetBits(const unsigned long *a, int words, int *IDs);
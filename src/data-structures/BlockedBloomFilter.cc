@@ -0,0 +1,170 @@
+/*
+ *  Adyton: A Network Simulator for Opportunistic Networks
+ *  Copyright (C) 2015  Nikolaos Papanikos, Dimitrios-Georgios Akestoridis,
+ *  and Evangelos Papapetrou
+ *
+ *  This file is part of Adyton.
+ *
+ *  Adyton is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Adyton is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Adyton.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef BLOCKED_BLOOM_FILTER_H
+	#define BLOCKED_BLOOM_FILTER_H
+	#include "BlockedBloomFilter.h"
+#endif
+
+
+/* Odd multipliers used to derive the probe positions (one per probe) */
+static const unsigned int BloomSalts[BLOOM_MAX_HASHES] = {
+	0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+	0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U,
+	0x9e3779b1U, 0x85ebca77U, 0xc2b2ae3dU, 0x27d4eb2fU,
+	0x165667b1U, 0x7feb352dU, 0xfd7046c5U, 0xb55a4f09U
+};
+
+
+/* Constructor: BlockedBloomFilter
+ * -------------------------------
+ * Creates a filter of at least the given number of bits (rounded up to whole blocks)
+ * that uses the given number of probes per element.
+ */
+BlockedBloomFilter::BlockedBloomFilter(unsigned long long bits, unsigned int hashes, unsigned long long randomSeed)
+{
+	void *mem=NULL;
+
+
+	this->numBlocks=(bits+BLOOM_BLOCK_BITS-1)/BLOOM_BLOCK_BITS;
+	if(this->numBlocks == 0)
+	{
+		this->numBlocks=1;
+	}
+	if(hashes < 1 || hashes > BLOOM_MAX_HASHES)
+	{
+		printf("Error - Blocked bloom filters support 1 to %d hash functions (%u requested)!\n",BLOOM_MAX_HASHES,hashes);
+		exit(1);
+	}
+	this->numHashes=hashes;
+	this->seed=randomSeed;
+	if(posix_memalign(&mem,64,this->numBlocks*BLOOM_BLOCK_WORDS*sizeof(unsigned long long)) != 0)
+	{
+		printf("Error - Could not allocate %llu bytes for the blocked bloom filter!\n",this->numBlocks*BLOOM_BLOCK_WORDS*sizeof(unsigned long long));
+		exit(1);
+	}
+	this->words=(unsigned long long *)mem;
+	this->clear();
+	return;
+}
+
+BlockedBloomFilter::~BlockedBloomFilter()
+{
+	free(this->words);
+	return;
+}
+
+/* clear
+ * -----
+ * Removes all elements from the filter.
+ */
+void BlockedBloomFilter::clear(void)
+{
+	memset(this->words,0,this->numBlocks*BLOOM_BLOCK_WORDS*sizeof(unsigned long long));
+	return;
+}
+
+/* hash
+ * ----
+ * 64-bit mixing function (finalizer of splitmix64).
+ */
+unsigned long long BlockedBloomFilter::hash(unsigned long long element)
+{
+	unsigned long long z=element+this->seed+0x9e3779b97f4a7c15ULL;
+	z=(z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	z=(z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+	return z ^ (z >> 31);
+}
+
+/* probe
+ * -----
+ * Computes the block of an element and the positions of its bits inside the block (one
+ * of the 512 bits per probe). The positions do not depend on each other, so the loop is
+ * vectorized.
+ */
+unsigned long long *BlockedBloomFilter::probe(unsigned long long element, unsigned int *pos)
+{
+	unsigned long long h=hash(element);
+	unsigned int low=(unsigned int)h;
+
+
+	for(int i=0;i<BLOOM_MAX_HASHES;i++)
+	{
+		pos[i]=(low * BloomSalts[i]) >> 23;
+	}
+	return this->words+(((h >> 32) * this->numBlocks) >> 32)*BLOOM_BLOCK_WORDS;
+}
+
+void BlockedBloomFilter::insert(unsigned long long element)
+{
+	unsigned int pos[BLOOM_MAX_HASHES];
+	unsigned long long *block=probe(element,pos);
+
+
+	for(unsigned int i=0;i<this->numHashes;i++)
+	{
+		block[pos[i] >> 6]|=1ULL << (pos[i] & 63);
+	}
+	return;
+}
+
+bool BlockedBloomFilter::contains(unsigned long long element)
+{
+	unsigned int pos[BLOOM_MAX_HASHES];
+	unsigned long long *block=probe(element,pos);
+	unsigned long long found=1;
+
+
+	for(unsigned int i=0;i<this->numHashes;i++)
+	{
+		found&=block[pos[i] >> 6] >> (pos[i] & 63);
+	}
+	return ((found & 1) == 1);
+}
+
+/* falsePositiveRate
+ * -----------------
+ * Expected false positive probability after inserting the given number of elements.
+ * The number of elements per block follows a Poisson distribution, so the result is the
+ * Poisson-weighted false positive probability of a 512-bit bloom filter.
+ */
+double BlockedBloomFilter::falsePositiveRate(unsigned long long elements)
+{
+	double lambda=(double)elements/(double)this->numBlocks;
+	double total=0.0;
+	double weight=exp(-lambda);
+
+
+	for(int load=0;load<100000;load++)
+	{
+		if(load > 0)
+		{
+			weight*=lambda/(double)load;
+		}
+		if(load > lambda && weight < 1e-12)
+		{
+			break;
+		}
+		total+=weight*pow(1.0-pow(1.0-1.0/(double)BLOOM_BLOCK_BITS,(double)(load*this->numHashes)),(double)this->numHashes);
+	}
+	return total;
+}
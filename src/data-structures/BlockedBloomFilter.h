@@ -0,0 +1,63 @@
+/*
+ *  Adyton: A Network Simulator for Opportunistic Networks
+ *  Copyright (C) 2015  Nikolaos Papanikos, Dimitrios-Georgios Akestoridis,
+ *  and Evangelos Papapetrou
+ *
+ *  This file is part of Adyton.
+ *
+ *  Adyton is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Adyton is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Adyton.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <cmath>
+
+using namespace std;
+
+/* Number of 64-bit words in a block (one 64-byte cache line) */
+#define BLOOM_BLOCK_WORDS 8
+#define BLOOM_BLOCK_BITS 512
+/* Maximum number of hash probes per element */
+#define BLOOM_MAX_HASHES 16
+
+/* BlockedBloomFilter
+ * ------------------
+ * Bloom filter whose probes for an element all fall inside a single 64-byte block. The
+ * block is selected by the high half of a 64-bit hash and the probes are taken from the
+ * low half, so a lookup touches exactly one cache line. The bit positions are produced by independent multiplications with fixed
+ * odd constants, which the compiler turns into vector instructions.
+ */
+class BlockedBloomFilter
+{
+private:
+	unsigned long long *words;
+	unsigned long long numBlocks;
+	unsigned int numHashes;
+	unsigned long long seed;
+
+	unsigned long long hash(unsigned long long element);
+	unsigned long long *probe(unsigned long long element, unsigned int *pos);
+
+public:
+	BlockedBloomFilter(unsigned long long bits, unsigned int hashes, unsigned long long randomSeed);
+	~BlockedBloomFilter();
+	void insert(unsigned long long element);
+	bool contains(unsigned long long element);
+	void clear(void);
+	unsigned long long size(void){return this->numBlocks*BLOOM_BLOCK_BITS;};
+	unsigned int hashCount(void){return this->numHashes;};
+	double falsePositiveRate(unsigned long long elements);
+};
@@ -241,3 +241,17 @@ double CentralityApproximation::getGlobalRank(double currTime)
 
 	return globalRank;
 }
+
+
+void CentralityApproximation::Checkpoint(Snapshot *snap)
+{
+	snap->Section("CENT");
+	snap->Match(numNodes, "number of nodes");
+	snap->Value(prevTimePeriod);
+	snap->Value(currTimePeriod);
+	snap->Array(prevTimeSlot, numNodes);
+	snap->Array(currTimeSlot, numNodes);
+	snap->Array(currConnectedNodes, numNodes);
+
+	return;
+}
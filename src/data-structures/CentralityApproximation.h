@@ -26,6 +26,11 @@
 #include <stdlib.h>
 #include <math.h>
 
+#ifndef SNAPSHOT_H
+	#define SNAPSHOT_H
+	#include "../core/Snapshot.h"
+#endif
+
 #define SIX_HOURS 21600
 
 
@@ -49,4 +54,5 @@ public:
 	void updateTimeSlots(double currTime);
 	double getLocalRank(double currTime, bool *myLocalCommunity);
 	double getGlobalRank(double currTime);
+	void Checkpoint(Snapshot *snap);
 };
@@ -118,70 +118,113 @@ bool Coding::checkOpportunity(int PID1,int PID2)
 	return false;
 }
 
-/* deleteOpportunities
- * -------------------
- * Deletes the list that is composed of opportunities given as argument.
+/* indexCandidates
+ * ---------------
+ * Looks up the source and destination of every packet in the list "Pkts" (entries
+ * equal to -1 are ignored) and groups the positions of the packets by their
+ * (source,destination) pair.
  */
-void Coding::deleteOpportunities(Opportunities *Opps)
+void Coding::indexCandidates(int *Pkts,vector<int> &Src,vector<int> &Dst,CodingIndex &Index)
 {
-	Opportunities *runner=Opps;
-	Opportunities *previous=NULL;
-	while(runner)
+	Src.assign(Pkts[0]+1,-1);
+	Dst.assign(Pkts[0]+1,-1);
+	for(int i=1;i<=Pkts[0];i++)
 	{
-		previous=runner;
-		runner=runner->next;
-		free(previous);
+		if(Pkts[i] == -1)
+		{
+			continue;
+		}
+		Src[i]=NodeBuf->getPacketSource(Pkts[i]);
+		Dst[i]=NodeBuf->getPacketDest(Pkts[i]);
+		CodingBucket &bucket=Index[make_pair(Src[i],Dst[i])];
+		if(bucket.Positions.empty())
+		{
+			bucket.Head=0;
+		}
+		bucket.Positions.push_back(i);
 	}
 	return;
 }
 
+/* nextCandidate
+ * -------------
+ * Returns the first position after "After" that holds a packet (not yet combined) from
+ * "Source" to "Dest". If there is no such packet, -1 is returned. The caller must ask
+ * for non-decreasing values of "After" so that skipped positions are never revisited.
+ */
+int Coding::nextCandidate(CodingIndex &Index,int Source,int Dest,int *Pkts,int After)
+{
+	CodingIndex::iterator it=Index.find(make_pair(Source,Dest));
+	if(it == Index.end())
+	{
+		return -1;
+	}
+	CodingBucket &bucket=it->second;
+	while(bucket.Head < bucket.Positions.size() && (bucket.Positions[bucket.Head] <= After || Pkts[bucket.Positions[bucket.Head]] == -1))
+	{
+		bucket.Head++;
+	}
+	if(bucket.Head == bucket.Positions.size())
+	{
+		return -1;
+	}
+	return bucket.Positions[bucket.Head];
+}
+
+/* nextFriendlyCandidate
+ * ---------------------
+ * Returns the first position after "After" that holds a packet (not yet combined) destined
+ * to "Source" and originating from a friend of "Dest" (see checkFriendlyOpportunity()).
+ * If there is no such packet, -1 is returned.
+ */
+int Coding::nextFriendlyCandidate(CodingIndex &Index,int Source,int Dest,int *Pkts,int After)
+{
+	int *friends=SimGod->getFriends(Dest);
+	int best=-1;
+	int pos=-1;
+	for(int i=0;i<50;i++)
+	{
+		pos=nextCandidate(Index,friends[i],Source,Pkts,After);
+		if(pos != -1 && (best == -1 || pos < best))
+		{
+			best=pos;
+		}
+	}
+	return best;
+}
+
 /* searchCodingOpportunities
  * -------------------------
  * Searches for coding opportunities among packets ("Candidates") that are given as input. 
  * The maximum coding depth for now is set at 2. Actually the codings returned by this method
  * are known as codings of type A.
  */
-Opportunities *Coding::searchCodingOpportunities(int *Candidates)
+Opportunities Coding::searchCodingOpportunities(int *Candidates)
 {
-	Opportunities *Opps=NULL;
-	Opportunities *tmp=NULL;
-	Opportunities *previous=NULL;
-	bool found=false;
+	Opportunities Opps;
+	Opportunity tmp;
+	vector<int> Src;
+	vector<int> Dst;
+	CodingIndex Index;
+	int j=-1;
+	indexCandidates(Candidates,Src,Dst,Index);
 	for(int i=1;i<=Candidates[0];i++)
 	{
 		if(Candidates[i] == -1)
 		{
 			continue;
 		}
-		found=false;
-		for(int j=(i+1);j<=Candidates[0];j++)
+		//The first following packet that travels the opposite way
+		j=nextCandidate(Index,Dst[i],Src[i],Candidates,i);
+		if(j != -1)
 		{
-			if(Candidates[j] == -1)
-			{
-				continue;
-			}
-			found=checkOpportunity(Candidates[i],Candidates[j]);
-			if(found)
-			{
-				SimGod->increaseEncodingsA();
-				//printf("%d: Found a coding opportunity between %d and %d!\n",this->NodeID,Candidates[i],Candidates[j]);
-				tmp=(Opportunities *)malloc(sizeof(Opportunities));
-				tmp->PID1=Candidates[i];
-				tmp->PID2=Candidates[j];
-				tmp->next=NULL;
-				if(previous)
-				{
-					previous->next=tmp;
-				}
-				if(!Opps)
-				{
-					Opps=tmp;
-				}
-				previous=tmp;
-				Candidates[i]=-1;
-				Candidates[j]=-1;
-				break;
-			}
+			SimGod->increaseEncodingsA();
+			//printf("%d: Found a coding opportunity between %d and %d!\n",this->NodeID,Candidates[i],Candidates[j]);
+			tmp.PID1=Candidates[i];
+			tmp.PID2=Candidates[j];
+			Opps.push_back(tmp);
+			Candidates[i]=-1;
+			Candidates[j]=-1;
 		}
 	}
 	return Opps;
@@ -194,47 +237,31 @@ Opportunities *Coding::searchCodingOpportunities(int *Candidates)
  * list and a second packet coming from "NoPriority" packet list. Actually the codings returned by this method
  * are known as codings of type B.
  */
-Opportunities *Coding::forceCoding(int *Candidates, int *NoPriority)
+Opportunities Coding::forceCoding(int *Candidates, int *NoPriority)
 {
-	Opportunities *Opps=NULL;
-	Opportunities *tmp=NULL;
-	Opportunities *previous=NULL;
-	bool found=false;
+	Opportunities Opps;
+	Opportunity tmp;
+	vector<int> Src;
+	vector<int> Dst;
+	CodingIndex Index;
+	int j=-1;
+	indexCandidates(NoPriority,Src,Dst,Index);
 	for(int i=1;i<=Candidates[0];i++)
 	{
 		if(Candidates[i] == -1)
 		{
 			continue;
 		}
-		found=false;
-		for(int j=1;j<=NoPriority[0];j++)
+		j=nextCandidate(Index,NodeBuf->getPacketDest(Candidates[i]),NodeBuf->getPacketSource(Candidates[i]),NoPriority,0);
+		if(j != -1)
 		{
-			if(NoPriority[j] == -1)
-			{
-				continue;
-			}
-			found=checkOpportunity(Candidates[i],NoPriority[j]);
-			if(found)
-			{
-				SimGod->increaseEncodingsB();
-				//printf("%d: Forced a coding opportunity between %d and %d!\n",this->NodeID,Candidates[i],NoPriority[j]);
-				tmp=(Opportunities *)malloc(sizeof(Opportunities));
-				tmp->PID1=Candidates[i];
-				tmp->PID2=NoPriority[j];
-				tmp->next=NULL;
-				if(previous)
-				{
-					previous->next=tmp;
-				}
-				if(!Opps)
-				{
-					Opps=tmp;
-				}
-				previous=tmp;
-				Candidates[i]=-1;
-				NoPriority[j]=-1;
-				break;
-			}
+			SimGod->increaseEncodingsB();
+			//printf("%d: Forced a coding opportunity between %d and %d!\n",this->NodeID,Candidates[i],NoPriority[j]);
+			tmp.PID1=Candidates[i];
+			tmp.PID2=NoPriority[j];
+			Opps.push_back(tmp);
+			Candidates[i]=-1;
+			NoPriority[j]=-1;
 		}
 	}
 	return Opps;
@@ -244,36 +271,17 @@ Opportunities *Coding::forceCoding(int *Candidates, int *NoPriority)
  * ------------------
  * Prints the list that is composed of opportunities given as argument.
  */
-void Coding::printOpportunities(Opportunities* Opps)
+void Coding::printOpportunities(Opportunities &Opps)
 {
-	Opportunities *runner=Opps;
-	//Packet *p=NULL;
-	if(!runner)
+	if(Opps.empty())
 	{
 		printf("-no combinations-\n");
 		return;
 	}
-	int cnt=0;
-	while(runner)
-	{
-		cnt++;
-		runner=runner->next;
-	}
-	printf("(%d combinations): ",cnt);
-	runner=Opps;
-	while(runner)
+	printf("(%d combinations): ",(int)Opps.size());
+	for(unsigned int i=0;i<Opps.size();i++)
 	{
-		printf("%d-%d ",runner->PID1,runner->PID2);
-		//check existence
-// 		if((p=pktPool->GetPacket(runner->PID1)))
-// 		{
-// 			printf("%d->exists!\n",runner->PID1);
-// 		}
-// 		if((p=pktPool->GetPacket(runner->PID2)))
-// 		{
-// 			printf("%d->exists!\n",runner->PID2);
-// 		}
-		runner=runner->next;
+		printf("%d-%d ",Opps[i].PID1,Opps[i].PID2);
 	}
 	printf("\n");
 	return;
@@ -519,7 +527,7 @@ int *Coding::getPktsForActivation(int *req, double *Utils, bool *owned, int *isE
 				{
 					for(int j=0;j<(*it)->CodingDepth;j++)
 					{
-						if((*it)->EncodedPktIDs[j] == req[i] && Utils[i] > (*it)->EncodedMaxUtil[j])
+						if((*it)->Enc->PktIDs[j] == req[i] && Utils[i] > (*it)->Enc->MaxUtil[j])
 						{
 							found=true;
 							break;
@@ -528,7 +536,7 @@ int *Coding::getPktsForActivation(int *req, double *Utils, bool *owned, int *isE
 				}
 				else
 				{
-					if((*it)->EncodedPktIDs[(*it)->mimic] == req[i] && Utils[i] > (*it)->EncodedMaxUtil[(*it)->mimic])
+					if((*it)->Enc->PktIDs[(*it)->mimic] == req[i] && Utils[i] > (*it)->Enc->MaxUtil[(*it)->mimic])
 					{
 						found=true;
 					}
@@ -601,13 +609,13 @@ int *Coding::getAlreadyEncoded(int *req, double *Utils, bool *owned)
 				{
 					for(int j=0;j<(*it)->CodingDepth;j++)
 					{
-						if((*it)->EncodedPktIDs[j] == req[i])
+						if((*it)->Enc->PktIDs[j] == req[i])
 						{
-							if(Utils[i] > (*it)->EncodedMaxUtil[j])
+							if(Utils[i] > (*it)->Enc->MaxUtil[j])
 							{
 								pos++;
 								pkts = (int *) realloc(pkts, (pos + 1) * sizeof(int));
-								pkts[pos] = (*it)->EncodedPktIDs[j];
+								pkts[pos] = (*it)->Enc->PktIDs[j];
 								pkts[0] = pos;
 							}
 						}
@@ -794,98 +802,70 @@ bool Coding::checkFriendlyOpportunity(int PID1, int PID2)
 	return false;
 }
 
-Opportunities *Coding::searchFriendlyCodingOpportunities(int *Candidates)
+/* searchFriendlyCodingOpportunities
+ * ---------------------------------
+ * Same as searchCodingOpportunities() but the second packet may originate from any
+ * friend of the destination of the first packet (see checkFriendlyOpportunity()).
+ */
+Opportunities Coding::searchFriendlyCodingOpportunities(int *Candidates)
 {
-	Opportunities *Opps=NULL;
-	Opportunities *tmp=NULL;
-	Opportunities *previous=NULL;
-	bool found=false;
+	Opportunities Opps;
+	Opportunity tmp;
+	vector<int> Src;
+	vector<int> Dst;
+	CodingIndex Index;
+	int j=-1;
+	indexCandidates(Candidates,Src,Dst,Index);
 	for(int i=1;i<=Candidates[0];i++)
 	{
 		if(Candidates[i] == -1)
 		{
 			continue;
 		}
-		found=false;
-		for(int j=(i+1);j<=Candidates[0];j++)
+		j=nextFriendlyCandidate(Index,Src[i],Dst[i],Candidates,i);
+		if(j != -1)
 		{
-			if(Candidates[j] == -1)
-			{
-				continue;
-			}
-			found=checkFriendlyOpportunity(Candidates[i],Candidates[j]);
-			if(found)
-			{
-				//SimGod->increaseEncodingsA();
-				//printf("%d: Found a coding opportunity between %d and %d!\n",this->NodeID,Candidates[i],Candidates[j]);
-				tmp=(Opportunities *)malloc(sizeof(Opportunities));
-				tmp->PID1=Candidates[i];
-				tmp->PID2=Candidates[j];
-				tmp->next=NULL;
-				if(previous)
-				{
-					previous->next=tmp;
-				}
-				if(!Opps)
-				{
-					Opps=tmp;
-				}
-				previous=tmp;
-				Candidates[i]=-1;
-				Candidates[j]=-1;
-				break;
-			}
-		}
-		if(!found)
-		{
-			
+			//SimGod->increaseEncodingsA();
+			tmp.PID1=Candidates[i];
+			tmp.PID2=Candidates[j];
+			Opps.push_back(tmp);
+			Candidates[i]=-1;
+			Candidates[j]=-1;
 		}
 	}
 	return Opps;
 }
 
-Opportunities *Coding::forceFriendlyCoding(int *Candidates, int *NoPriority)
+/* forceFriendlyCoding
+ * -------------------
+ * Same as forceCoding() but the second packet may originate from any friend of the
+ * destination of the first packet (see checkFriendlyOpportunity()).
+ */
+Opportunities Coding::forceFriendlyCoding(int *Candidates, int *NoPriority)
 {
-	Opportunities *Opps=NULL;
-	Opportunities *tmp=NULL;
-	Opportunities *previous=NULL;
-	bool found=false;
+	Opportunities Opps;
+	Opportunity tmp;
+	vector<int> Src;
+	vector<int> Dst;
+	CodingIndex Index;
+	int j=-1;
+	indexCandidates(NoPriority,Src,Dst,Index);
 	for(int i=1;i<=Candidates[0];i++)
 	{
 		if(Candidates[i] == -1)
 		{
 			continue;
 		}
-		found=false;
-		for(int j=1;j<=NoPriority[0];j++)
+		j=nextFriendlyCandidate(Index,NodeBuf->getPacketSource(Candidates[i]),NodeBuf->getPacketDest(Candidates[i]),NoPriority,0);
+		if(j != -1)
 		{
-			if(NoPriority[j] == -1)
-			{
-				continue;
-			}
-			found=checkFriendlyOpportunity(Candidates[i],NoPriority[j]);
-			if(found)
-			{
-				//SimGod->increaseEncodingsB();
-				//printf("%d: Forced a coding opportunity between %d and %d!\n",this->NodeID,Candidates[i],NoPriority[j]);
-				tmp=(Opportunities *)malloc(sizeof(Opportunities));
-				tmp->PID1=Candidates[i];
-				tmp->PID2=NoPriority[j];
-				tmp->next=NULL;
-				if(previous)
-				{
-					previous->next=tmp;
-				}
-				if(!Opps)
-				{
-					Opps=tmp;
-				}
-				previous=tmp;
-				Candidates[i]=-1;
-				NoPriority[j]=-1;
-				printf("Combination of %d and %d\n",tmp->PID1,tmp->PID2);
-				break;
-			}
+			//SimGod->increaseEncodingsB();
+			tmp.PID1=Candidates[i];
+			tmp.PID2=NoPriority[j];
+			Opps.push_back(tmp);
+			Candidates[i]=-1;
+			NoPriority[j]=-1;
+			printf("Combination of %d and %d\n",tmp.PID1,tmp.PID2);
 		}
 	}
 	return Opps;
@@ -24,6 +24,8 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <vector>
+#include <map>
 
 #ifndef PACKET_BUFFER_H
 	#define PACKET_BUFFER_H
@@ -44,9 +46,18 @@ struct Opportunity
 {
 	int PID1;
 	int PID2;
-	struct Opportunity *next;
 };
-typedef struct Opportunity Opportunities;
+typedef vector<Opportunity> Opportunities;
+
+/* Positions (inside a candidate list) of the packets that share the same source and
+ * destination. Positions before Head are either already combined or no longer useful.
+ */
+struct CodingBucket
+{
+	vector<int> Positions;
+	unsigned int Head;
+};
+typedef map<pair<int,int>,CodingBucket> CodingIndex;
 
 class Coding
 {
@@ -54,17 +65,19 @@ private:
 	PacketBuffer *NodeBuf;
 	int NID;
 	God *SimGod;
+	void indexCandidates(int *Pkts,vector<int> &Src,vector<int> &Dst,CodingIndex &Index);
+	int nextCandidate(CodingIndex &Index,int Source,int Dest,int *Pkts,int After);
+	int nextFriendlyCandidate(CodingIndex &Index,int Source,int Dest,int *Pkts,int After);
 public:
 	Coding(int NodeID,PacketBuffer *Buf,God *gd);
 	int *cleanPackets(int *Selected);
 	bool checkOpportunity(int PID1,int PID2);
 	bool checkFriendlyOpportunity(int PID1,int PID2);
-	void deleteOpportunities(Opportunities *Opps);
-	Opportunities *searchCodingOpportunities(int *Candidates);
-	Opportunities *searchFriendlyCodingOpportunities(int *Candidates);
-	Opportunities *forceCoding(int *Candidates,int *NotRequested);
-	Opportunities *forceFriendlyCoding(int *Candidates, int *NoPriority);
-	void printOpportunities(Opportunities *Opps);
+	Opportunities searchCodingOpportunities(int *Candidates);
+	Opportunities searchFriendlyCodingOpportunities(int *Candidates);
+	Opportunities forceCoding(int *Candidates,int *NotRequested);
+	Opportunities forceFriendlyCoding(int *Candidates, int *NoPriority);
+	void printOpportunities(Opportunities &Opps);
 	//xCnR
 	int *getMyPackets(int *Selected);
 	int *getAlreadyEncoded(int *Selected);
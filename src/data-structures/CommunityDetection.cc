@@ -293,3 +293,24 @@ bool **CommunityDetection::cloneFamiliarSets(double currentTime)
 
 	return tmp;
 }
+
+
+void CommunityDetection::Checkpoint(Snapshot *snap)
+{
+	int i;
+
+
+	snap->Section("COMM");
+	snap->Match(numNodes, "number of nodes");
+	snap->Value(prevUpdate);
+	snap->Array(cumulativeContactDurations, numNodes);
+	snap->Array(currConnectedNodes, numNodes);
+	snap->Array(myLocalCommunity, numNodes);
+
+	for(i = 0; i < numNodes; i++)
+	{
+		snap->Array(myFamiliarSets[i], numNodes);
+	}
+
+	return;
+}
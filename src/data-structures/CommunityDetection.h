@@ -26,6 +26,11 @@
 #include <stdlib.h>
 #include <string.h>
 
+#ifndef SNAPSHOT_H
+	#define SNAPSHOT_H
+	#include "../core/Snapshot.h"
+#endif
+
 #define DEFAULT_FAMILIAR_SET_THRESHOLD 388800
 #define DEFAULT_KAPPA 3
 
@@ -54,4 +59,5 @@ public:
 	void updateBubble(bool *encLocalCommunity, bool **encFamiliarSets, int encID, double currentTime);
 	bool *cloneLocalCommunity(double currentTime);
 	bool **cloneFamiliarSets(double currentTime);
+	void Checkpoint(Snapshot *snap);
 };
@@ -304,6 +304,18 @@ void DPT::Aging(double currTime)
 }
 
 
+void DPT::Checkpoint(Snapshot *snap)
+{
+	snap->Section("DPT ");
+	snap->Match(this->numNodes, "number of nodes");
+	snap->Value(this->lastTimeAged);
+	snap->Array(this->myDPT, this->numNodes);
+	this->AverageSeparationPeriod->Checkpoint(snap);
+
+	return;
+}
+
+
 void DPTv1::UpdateDPT(double* encDPT, int encNode, double currTime)
 {
 	int i;
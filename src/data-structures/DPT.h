@@ -71,6 +71,7 @@ public:
 	double *CalcRepValue(double *encDPT, double currTime);
 	int *CheckDPs(double *encDPT, double currTime);
 	void Aging(double currTime);
+	void Checkpoint(Snapshot *snap);
 	virtual void UpdateDPT(double *encDPT, int encNode, double currTime) = 0;
 };
 
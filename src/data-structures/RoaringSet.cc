@@ -0,0 +1,515 @@
+/*
+ *  Adyton: A Network Simulator for Opportunistic Networks
+ *  Copyright (C) 2015  Nikolaos Papanikos, Dimitrios-Georgios Akestoridis,
+ *  and Evangelos Papapetrou
+ *
+ *  This file is part of Adyton.
+ *
+ *  Adyton is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Adyton is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Adyton.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef ROARING_SET_H
+	#define ROARING_SET_H
+	#include "RoaringSet.h"
+#endif
+
+
+/* Constructor: RoaringSet
+ * -----------------------
+ * Compressed set of integers. Values are partitioned according to their 16 high-order
+ * bits and the low-order bits of each partition are stored in a container whose type
+ * (array, bitmap or runs) depends on how dense the partition is.
+ */
+RoaringSet::RoaringSet()
+{
+	this->card=0;
+	return;
+}
+
+RoaringSet::~RoaringSet()
+{
+	this->clear();
+	return;
+}
+
+/* clear
+ * -----
+ * Removes all values from the set.
+ */
+void RoaringSet::clear(void)
+{
+	for(unsigned int i=0;i<containers.size();i++)
+	{
+		freeContainer(containers[i]);
+	}
+	containers.clear();
+	keys.clear();
+	this->card=0;
+	return;
+}
+
+/* findKey
+ * -------
+ * Binary search for the container of the given high-order bits. Returns the position of
+ * the container, or -(insertion point)-1 if no such container exists.
+ */
+int RoaringSet::findKey(unsigned short key)
+{
+	int low=0;
+	int high=(int)keys.size()-1;
+	while(low <= high)
+	{
+		int mid=(low+high)>>1;
+		if(keys[mid] < key)
+		{
+			low=mid+1;
+		}
+		else if(keys[mid] > key)
+		{
+			high=mid-1;
+		}
+		else
+		{
+			return mid;
+		}
+	}
+	return -(low+1);
+}
+
+SetContainer *RoaringSet::newContainer(void)
+{
+	SetContainer *c=new SetContainer;
+	c->type=ARRAY_CONTAINER;
+	c->card=0;
+	c->bits=NULL;
+	return c;
+}
+
+void RoaringSet::freeContainer(SetContainer *c)
+{
+	free(c->bits);
+	c->values.clear();
+	delete c;
+	return;
+}
+
+/* insert
+ * ------
+ * Adds a value to the set. Returns true if the value was not already a member.
+ */
+bool RoaringSet::insert(int value)
+{
+	unsigned int v=(unsigned int)value;
+	unsigned short key=(unsigned short)(v>>16);
+	int pos=findKey(key);
+	if(pos < 0)
+	{
+		pos=-pos-1;
+		keys.insert(keys.begin()+pos,key);
+		containers.insert(containers.begin()+pos,newContainer());
+	}
+	if(containerAdd(containers[pos],(unsigned short)(v & 0xFFFF)))
+	{
+		this->card++;
+		return true;
+	}
+	return false;
+}
+
+/* contains
+ * --------
+ * Checks whether a value is a member of the set.
+ */
+bool RoaringSet::contains(int value)
+{
+	unsigned int v=(unsigned int)value;
+	int pos=findKey((unsigned short)(v>>16));
+	if(pos < 0)
+	{
+		return false;
+	}
+	return containerHas(containers[pos],(unsigned short)(v & 0xFFFF));
+}
+
+/* containerAdd
+ * ------------
+ * Adds the low-order bits of a value to a container. Array containers that grow too
+ * large are converted to bitmaps.
+ */
+bool RoaringSet::containerAdd(SetContainer *c, unsigned short low)
+{
+	switch(c->type)
+	{
+		case ARRAY_CONTAINER:
+		{
+			vector<unsigned short>::iterator it=lower_bound(c->values.begin(),c->values.end(),low);
+			if(it != c->values.end() && *it == low)
+			{
+				return false;
+			}
+			c->values.insert(it,low);
+			c->card++;
+			if(c->card > ARRAY_CONTAINER_MAX)
+			{
+				toBitmap(c);
+			}
+			return true;
+		}
+		case BITMAP_CONTAINER:
+		{
+			unsigned long long mask=1ULL << (low & 63);
+			if(c->bits[low >> 6] & mask)
+			{
+				return false;
+			}
+			c->bits[low >> 6]|=mask;
+			c->card++;
+			return true;
+		}
+		default:
+		{
+			//Find the first run that starts after the value
+			int nruns=(int)c->values.size()/2;
+			int lo=0;
+			int hi=nruns;
+			while(lo < hi)
+			{
+				int mid=(lo+hi)>>1;
+				if(c->values[2*mid] <= low)
+				{
+					lo=mid+1;
+				}
+				else
+				{
+					hi=mid;
+				}
+			}
+			int next=lo;
+			int prev=lo-1;
+			if(prev >= 0 && (int)low <= (int)c->values[2*prev]+(int)c->values[2*prev+1])
+			{
+				return false;
+			}
+			bool extendPrev=(prev >= 0 && (int)c->values[2*prev]+(int)c->values[2*prev+1]+1 == (int)low);
+			bool extendNext=(next < nruns && (int)c->values[2*next] == (int)low+1);
+			if(extendPrev && extendNext)
+			{
+				c->values[2*prev+1]=(unsigned short)(c->values[2*prev+1]+c->values[2*next+1]+2);
+				c->values.erase(c->values.begin()+2*next,c->values.begin()+2*next+2);
+			}
+			else if(extendPrev)
+			{
+				c->values[2*prev+1]++;
+			}
+			else if(extendNext)
+			{
+				c->values[2*next]=low;
+				c->values[2*next+1]++;
+			}
+			else
+			{
+				unsigned short run[2]={low,0};
+				c->values.insert(c->values.begin()+2*next,run,run+2);
+			}
+			c->card++;
+			if(containerBytes(RUN_CONTAINER,c->card,(int)c->values.size()/2) > containerBytes(BITMAP_CONTAINER,c->card,0))
+			{
+				toBitmap(c);
+			}
+			return true;
+		}
+	}
+}
+
+/* containerHas
+ * ------------
+ * Checks whether the low-order bits of a value are stored in a container.
+ */
+bool RoaringSet::containerHas(SetContainer *c, unsigned short low)
+{
+	switch(c->type)
+	{
+		case ARRAY_CONTAINER:
+		{
+			return binary_search(c->values.begin(),c->values.end(),low);
+		}
+		case BITMAP_CONTAINER:
+		{
+			return (c->bits[low >> 6] >> (low & 63)) & 1ULL;
+		}
+		default:
+		{
+			int lo=0;
+			int hi=(int)c->values.size()/2;
+			while(lo < hi)
+			{
+				int mid=(lo+hi)>>1;
+				if(c->values[2*mid] <= low)
+				{
+					lo=mid+1;
+				}
+				else
+				{
+					hi=mid;
+				}
+			}
+			lo--;
+			return (lo >= 0 && (int)low <= (int)c->values[2*lo]+(int)c->values[2*lo+1]);
+		}
+	}
+}
+
+/* countRuns
+ * ---------
+ * Returns the number of runs of consecutive values stored in a container.
+ */
+int RoaringSet::countRuns(SetContainer *c)
+{
+	int runs=0;
+	switch(c->type)
+	{
+		case ARRAY_CONTAINER:
+		{
+			for(unsigned int i=0;i<c->values.size();i++)
+			{
+				if(i == 0 || c->values[i] != c->values[i-1]+1)
+				{
+					runs++;
+				}
+			}
+			return runs;
+		}
+		case BITMAP_CONTAINER:
+		{
+			unsigned long long carry=0;
+			for(int w=0;w<BITMAP_CONTAINER_WORDS;w++)
+			{
+				unsigned long long word=c->bits[w];
+				runs+=__builtin_popcountll(word & ~((word << 1) | carry));
+				carry=word >> 63;
+			}
+			return runs;
+		}
+		default:
+		{
+			return (int)c->values.size()/2;
+		}
+	}
+}
+
+int RoaringSet::containerBytes(int type, int cardinality, int runs)
+{
+	switch(type)
+	{
+		case ARRAY_CONTAINER:
+		{
+			return 2*cardinality;
+		}
+		case BITMAP_CONTAINER:
+		{
+			return 8*BITMAP_CONTAINER_WORDS;
+		}
+		default:
+		{
+			return 4*runs;
+		}
+	}
+}
+
+/* toBitmap
+ * --------
+ * Converts an array or run container to a bitmap container.
+ */
+void RoaringSet::toBitmap(SetContainer *c)
+{
+	if(c->type == BITMAP_CONTAINER)
+	{
+		return;
+	}
+	c->bits=(unsigned long long *)calloc(BITMAP_CONTAINER_WORDS,sizeof(unsigned long long));
+	if(c->type == ARRAY_CONTAINER)
+	{
+		for(unsigned int i=0;i<c->values.size();i++)
+		{
+			c->bits[c->values[i] >> 6]|=1ULL << (c->values[i] & 63);
+		}
+	}
+	else
+	{
+		for(unsigned int i=0;i<c->values.size();i+=2)
+		{
+			for(int v=c->values[i];v<=(int)c->values[i]+(int)c->values[i+1];v++)
+			{
+				c->bits[v >> 6]|=1ULL << (v & 63);
+			}
+		}
+	}
+	vector<unsigned short>().swap(c->values);
+	c->type=BITMAP_CONTAINER;
+	return;
+}
+
+/* toArray
+ * -------
+ * Converts a bitmap or run container to an array container.
+ */
+void RoaringSet::toArray(SetContainer *c)
+{
+	if(c->type == ARRAY_CONTAINER)
+	{
+		return;
+	}
+	vector<unsigned short> vals;
+	vals.reserve(c->card);
+	if(c->type == BITMAP_CONTAINER)
+	{
+		for(int w=0;w<BITMAP_CONTAINER_WORDS;w++)
+		{
+			unsigned long long word=c->bits[w];
+			while(word)
+			{
+				vals.push_back((unsigned short)(w*64+__builtin_ctzll(word)));
+				word&=word-1;
+			}
+		}
+		free(c->bits);
+		c->bits=NULL;
+	}
+	else
+	{
+		for(unsigned int i=0;i<c->values.size();i+=2)
+		{
+			for(int v=c->values[i];v<=(int)c->values[i]+(int)c->values[i+1];v++)
+			{
+				vals.push_back((unsigned short)v);
+			}
+		}
+	}
+	c->values.swap(vals);
+	c->type=ARRAY_CONTAINER;
+	return;
+}
+
+/* toRuns
+ * ------
+ * Converts an array or bitmap container to a run container.
+ */
+void RoaringSet::toRuns(SetContainer *c)
+{
+	if(c->type == RUN_CONTAINER)
+	{
+		return;
+	}
+	toArray(c);
+	vector<unsigned short> runs;
+	for(unsigned int i=0;i<c->values.size();i++)
+	{
+		if(i > 0 && c->values[i] == c->values[i-1]+1)
+		{
+			runs[runs.size()-1]++;
+		}
+		else
+		{
+			runs.push_back(c->values[i]);
+			runs.push_back(0);
+		}
+	}
+	c->values.swap(runs);
+	c->type=RUN_CONTAINER;
+	return;
+}
+
+/* runOptimize
+ * -----------
+ * Converts each container to the representation that needs the least memory. Long
+ * sequences of consecutive values are turned into run containers.
+ */
+void RoaringSet::runOptimize(void)
+{
+	for(unsigned int i=0;i<containers.size();i++)
+	{
+		SetContainer *c=containers[i];
+		int runBytes=containerBytes(RUN_CONTAINER,c->card,countRuns(c));
+		int type=(c->card <= ARRAY_CONTAINER_MAX)?ARRAY_CONTAINER:BITMAP_CONTAINER;
+		if(runBytes < containerBytes(type,c->card,0))
+		{
+			type=RUN_CONTAINER;
+		}
+		if(type == c->type)
+		{
+			continue;
+		}
+		if(type == ARRAY_CONTAINER)
+		{
+			toArray(c);
+		}
+		else if(type == BITMAP_CONTAINER)
+		{
+			toBitmap(c);
+		}
+		else
+		{
+			toRuns(c);
+		}
+	}
+	return;
+}
+
+/* getValues
+ * ---------
+ * Returns an array with all members of the set in ascending order. The first
+ * position holds the number of members.
+ */
+int *RoaringSet::getValues(void)
+{
+	int *res=(int *)malloc(sizeof(int)*(this->card+1));
+	int pos=1;
+	res[0]=(int)this->card;
+	for(unsigned int i=0;i<containers.size();i++)
+	{
+		SetContainer *c=containers[i];
+		unsigned int high=((unsigned int)keys[i]) << 16;
+		if(c->type == ARRAY_CONTAINER)
+		{
+			for(unsigned int j=0;j<c->values.size();j++)
+			{
+				res[pos++]=(int)(high | c->values[j]);
+			}
+		}
+		else if(c->type == BITMAP_CONTAINER)
+		{
+			for(int w=0;w<BITMAP_CONTAINER_WORDS;w++)
+			{
+				unsigned long long word=c->bits[w];
+				while(word)
+				{
+					res[pos++]=(int)(high | (unsigned int)(w*64+__builtin_ctzll(word)));
+					word&=word-1;
+				}
+			}
+		}
+		else
+		{
+			for(unsigned int j=0;j<c->values.size();j+=2)
+			{
+				for(int v=c->values[j];v<=(int)c->values[j]+(int)c->values[j+1];v++)
+				{
+					res[pos++]=(int)(high | (unsigned int)v);
+				}
+			}
+		}
+	}
+	return res;
+}
@@ -0,0 +1,83 @@
+/*
+ *  Adyton: A Network Simulator for Opportunistic Networks
+ *  Copyright (C) 2015  Nikolaos Papanikos, Dimitrios-Georgios Akestoridis,
+ *  and Evangelos Papapetrou
+ *
+ *  This file is part of Adyton.
+ *
+ *  Adyton is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Adyton is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Adyton.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include <algorithm>
+
+using namespace std;
+
+#define ARRAY_CONTAINER 0
+#define BITMAP_CONTAINER 1
+#define RUN_CONTAINER 2
+
+/* Maximum number of values stored in an array container */
+#define ARRAY_CONTAINER_MAX 4096
+/* Number of 64-bit words in a bitmap container (2^16 bits) */
+#define BITMAP_CONTAINER_WORDS 1024
+
+/* SetContainer
+ * ------------
+ * Holds all values of the set that share the same 16 high-order bits. Depending on
+ * its type, the low-order bits are kept as a sorted array, a bitmap or a sorted list
+ * of runs (start, length-1).
+ */
+struct SetContainer
+{
+	int type;
+	int card;
+	vector<unsigned short> values;
+	unsigned long long *bits;
+};
+
+class RoaringSet
+{
+private:
+	vector<unsigned short> keys;
+	vector<SetContainer*> containers;
+	long int card;
+
+	int findKey(unsigned short key);
+	SetContainer *newContainer(void);
+	void freeContainer(SetContainer *c);
+	bool containerAdd(SetContainer *c, unsigned short low);
+	bool containerHas(SetContainer *c, unsigned short low);
+	int countRuns(SetContainer *c);
+	void toBitmap(SetContainer *c);
+	void toArray(SetContainer *c);
+	void toRuns(SetContainer *c);
+	int containerBytes(int type, int cardinality, int runs);
+	RoaringSet(const RoaringSet &other);
+	RoaringSet &operator=(const RoaringSet &other);
+
+public:
+	RoaringSet();
+	~RoaringSet();
+	bool insert(int value);
+	bool contains(int value);
+	void runOptimize(void);
+	void clear(void);
+	long int size(void){return this->card;};
+	int *getValues(void);
+};
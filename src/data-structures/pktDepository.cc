@@ -72,6 +72,7 @@ bloomDepository::bloomDepository(int nodeID,int maxSize): pktDepository(nodeID,m
 {
 	numElements=0;
 	filter=NULL;
+	blockedFilter=NULL;
 	return;
 }
 
@@ -84,9 +85,28 @@ double calcBloomSize(double n,double k,double p)
 	return m;
 }
 
+/* A negative number of hashes (k) selects the cache-line-blocked bloom filter with |k|
+ * probes per element. The blocked filter uses the same number of bits, checks a single
+ * 64-byte block per lookup and has a slightly higher false positive probability.
+ */
+
 void bloomDepository::init(double n, double k, double p,int numF)
 {
 	limit=(int)n;
+	if(k < 0)
+	{
+		k=-k;
+		double bloomSize=calcBloomSize(n,k,p);
+		blockedFilter=new BlockedBloomFilter((unsigned long long)bloomSize,(unsigned int)k,0xA5A5A5A5);
+		if(!NID)
+		{
+			printf("Number of elements: %.0f\n",n);
+			printf("False positive probability: %f (blocked filter: %f)\n",p,blockedFilter->falsePositiveRate((unsigned long long)n));
+			printf("Number of hashes: %.0f\n",k);
+			printf("Blocked bloom filter size: %llu bits - %llu Bytes - %.2f KB\n",blockedFilter->size(),blockedFilter->size()/8,blockedFilter->size()/(8.0*1024.0));
+		}
+		return;
+	}
 	//How many elements roughly do we expect to insert?
 	parameters.projected_element_count = (unsigned long long int)n;
 	//How many hash functions will be used 
@@ -137,11 +157,25 @@ void bloomDepository::insert(int ID)
 	}
 	if(numElements > limit)
 	{
-		filter->clear();
+		if(blockedFilter)
+		{
+			blockedFilter->clear();
+		}
+		else
+		{
+			filter->clear();
+		}
 		numElements=0;
 	}
 	size_t element=(size_t)ID;
-	filter->insert(element);
+	if(blockedFilter)
+	{
+		blockedFilter->insert(element);
+	}
+	else
+	{
+		filter->insert(element);
+	}
 	numElements++;
 	#ifdef BLOOM_DEBUG
 	printf("Inserted PID %d\n",element);
@@ -155,7 +189,7 @@ bool bloomDepository::lookUp(int ID)
 	#ifdef BLOOM_DEBUG
 	printf("Looking for PID %d..",element);
 	#endif
-	if(filter->contains(element))
+	if((blockedFilter && blockedFilter->contains(element)) || (!blockedFilter && filter->contains(element)))
 	{
 		#ifdef BLOOM_DEBUG
 		printf("found!\n");
@@ -182,6 +216,27 @@ multiBloomDepository::multiBloomDepository(int nodeID,int maxSize): pktDepositor
 void multiBloomDepository::init(double n, double k, double p,int numF)
 {
 	limit=(int)n;
+	if(k < 0)
+	{
+		k=-k;
+		double bloomSize=calcBloomSize(n,k,p);
+		numFilters=numF;
+		numElements=(int *)malloc(sizeof(int)*numF);
+		for(int i=0;i<numF;i++)
+		{
+			blockedFilters.push_back(new BlockedBloomFilter((unsigned long long)bloomSize,(unsigned int)k,0xA5A5A5A5));
+			numElements[i]=0;
+		}
+		if(!NID)
+		{
+			printf("Number of bloom filters: %d\n",numF);
+			printf("Number of elements: %.0f\n",n);
+			printf("False positive probability: %f (blocked filter: %f)\n",p,blockedFilters[0]->falsePositiveRate((unsigned long long)n));
+			printf("Number of hashes: %.0f\n",k);
+			printf("Total blocked bloom filter size: %d x %llu bits - %d x %llu Bytes - %d x %.2f KB\n",numF,blockedFilters[0]->size(),numF,blockedFilters[0]->size()/8,numF,blockedFilters[0]->size()/(8.0*1024.0));
+		}
+		return;
+	}
 	//How many elements roughly do we expect to insert?
 	parameters.projected_element_count = (unsigned long long int)n;
 	//How many hash functions will be used 
@@ -245,12 +300,26 @@ void multiBloomDepository::insert(int ID)
 		enabledFilter=enabledFilter%numFilters;
 		if(numElements[enabledFilter] > limit)
 		{
-			filters[enabledFilter]->clear();
+			if(!blockedFilters.empty())
+			{
+				blockedFilters[enabledFilter]->clear();
+			}
+			else
+			{
+				filters[enabledFilter]->clear();
+			}
 			numElements[enabledFilter]=0;
 		}
 	}
 	size_t element=(size_t)ID;
-	filters[enabledFilter]->insert(element);
+	if(!blockedFilters.empty())
+	{
+		blockedFilters[enabledFilter]->insert(element);
+	}
+	else
+	{
+		filters[enabledFilter]->insert(element);
+	}
 	numElements[enabledFilter]++;
 	return;
 }
@@ -266,7 +335,7 @@ bool multiBloomDepository::lookUp(int ID)
 		#ifdef BLOOM_DEBUG
 		printf("Checking %d bloom filter..",i+1);
 		#endif
-		if(filters[i]->contains(element))
+		if((!blockedFilters.empty() && blockedFilters[i]->contains(element)) || (blockedFilters.empty() && filters[i]->contains(element)))
 		{
 			#ifdef BLOOM_DEBUG
 			printf("found!\n");
@@ -28,6 +28,11 @@
 #include <cmath>
 #include <partow/bloom_filter.hpp>
 
+#ifndef BLOCKED_BLOOM_FILTER_H
+	#define BLOCKED_BLOOM_FILTER_H
+	#include "BlockedBloomFilter.h"
+#endif
+
 using namespace std;
 
 class pktDepository
@@ -62,6 +67,7 @@ class bloomDepository:public pktDepository
 protected:
 	bloom_parameters parameters;
 	bloom_filter *filter;
+	BlockedBloomFilter *blockedFilter;
 	int numElements;
 public:
 	bloomDepository(int nodeID,int maxSize);
@@ -78,6 +84,7 @@ protected:
 	int enabledFilter;
 	bloom_parameters parameters;
 	vector<bloom_filter*> filters;
+	vector<BlockedBloomFilter*> blockedFilters;
 	int *numElements;
 public:
 	multiBloomDepository(int nodeID,int maxSize);
@@ -68,8 +68,7 @@ void Cataclysm::CleanBuffer(PacketBuffer* PktBf)
 	{
 		if(Gd->IsDelivered((*it)->pktID))
 		{
-			delete (*it);
-			it=PktBf->Entries.erase(it);
+			it=PktBf->eraseEntry(it);
 			PktBf->PacketNum--;
 			//ToDo
 			//Stat->incPktsDied();
@@ -87,7 +86,7 @@ void Cataclysm::CleanBuffer(PacketBuffer* PktBf)
  * ----------
  * Is not used by "Cataclysm".
  */
-void Cataclysm::UpdateInfo(int* info)
+void Cataclysm::UpdateInfo(int *info, int NID)
 {
 	return;
 }
@@ -96,7 +95,7 @@ void Cataclysm::UpdateInfo(int* info)
  * ----------
  * Is not used by "Cataclysm".
  */
-int* Cataclysm::GetInfo(void)
+int* Cataclysm::GetInfo(int NID)
 {
 	return NULL;
 }
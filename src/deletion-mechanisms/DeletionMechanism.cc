@@ -50,3 +50,10 @@ bool DeletionMechanism::isDelivered(int PID)
 {
 	return false;
 }
+
+
+void DeletionMechanism::Checkpoint(Snapshot *snap)
+{
+	snap->Unsupported("this deletion mechanism");
+	return;
+}
@@ -38,11 +38,12 @@ public:
 	virtual ~DeletionMechanism();
 	virtual void setAsDelivered(int pktID)=0;
 	virtual void CleanBuffer(PacketBuffer *PktBf)=0;
-	virtual void UpdateInfo(int *info)=0;
-	virtual int *GetInfo(void)=0;
+	virtual void UpdateInfo(int *info, int NID)=0;
+	virtual int *GetInfo(int NID)=0;
 	virtual bool OffloaderDeletePkt(void)=0;
 	virtual bool DestinationDeletePkt(void)=0;
 	virtual bool ExchangeDirectSummary(void);
 	virtual bool isDelivered(int PID);
 	virtual bool NoDuplicatesSupport(void)=0;
+	virtual void Checkpoint(Snapshot *snap);
 };
@@ -63,7 +63,7 @@ void JustTTL::CleanBuffer(PacketBuffer* PktBf)
  * ----------
  * Is not used by "JustTTL".
  */
-void JustTTL::UpdateInfo(int* info)
+void JustTTL::UpdateInfo(int *info, int NID)
 {
 	return;
 }
@@ -72,7 +72,7 @@ void JustTTL::UpdateInfo(int* info)
  * -------
  * Is not used by "JustTTL".
  */
-int *JustTTL::GetInfo(void)
+int *JustTTL::GetInfo(int NID)
 {
 	return NULL;
 }
@@ -74,7 +74,7 @@ void NoDuplicates::CleanBuffer(PacketBuffer* PktBf)
  * ----------
  * Is not used by "NoDuplicates".
  */
-void NoDuplicates::UpdateInfo(int* info)
+void NoDuplicates::UpdateInfo(int *info, int NID)
 {
 	return;
 }
@@ -83,7 +83,7 @@ void NoDuplicates::UpdateInfo(int* info)
  * -------
  * Is not used by "NoDuplicates".
  */
-int* NoDuplicates::GetInfo(void)
+int* NoDuplicates::GetInfo(int NID)
 {
 	return NULL;
 }
@@ -145,3 +145,14 @@ bool NoDuplicates::NoDuplicatesSupport(void )
 {
 	return true;
 }
+
+/* Checkpoint
+ * ----------
+ * Saves or restores the set of packets that the node knows to be delivered.
+ */
+void NoDuplicates::Checkpoint(Snapshot *snap)
+{
+	snap->Section("DELM");
+	snap->Values(this->Delivered);
+	return;
+}
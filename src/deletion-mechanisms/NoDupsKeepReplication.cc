@@ -74,7 +74,7 @@ void NoDupsKeepReplication::CleanBuffer(PacketBuffer* PktBf)
  * ----------
  * Is not used by "NoDupsKeepReplication".
  */
-void NoDupsKeepReplication::UpdateInfo(int* info)
+void NoDupsKeepReplication::UpdateInfo(int *info, int NID)
 {
 	return;
 }
@@ -83,7 +83,7 @@ void NoDupsKeepReplication::UpdateInfo(int* info)
  * -------
  * Is not used by "NoDupsKeepReplication".
  */
-int *NoDupsKeepReplication::GetInfo(void)
+int *NoDupsKeepReplication::GetInfo(int NID)
 {
 	return NULL;
 }
@@ -145,3 +145,14 @@ bool NoDupsKeepReplication::NoDuplicatesSupport(void)
 {
 	return true;
 }
+
+/* Checkpoint
+ * ----------
+ * Saves or restores the set of packets that the node knows to be delivered.
+ */
+void NoDupsKeepReplication::Checkpoint(Snapshot *snap)
+{
+	snap->Section("DELM");
+	snap->Values(this->Delivered);
+	return;
+}
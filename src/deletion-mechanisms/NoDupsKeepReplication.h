@@ -38,11 +38,12 @@ public:
 	~NoDupsKeepReplication();
 	virtual void setAsDelivered(int pktID);
 	virtual void CleanBuffer(PacketBuffer *PktBf);
-	virtual void UpdateInfo(int *info);
-	virtual int *GetInfo(void);
+	virtual void UpdateInfo(int *info, int NID);
+	virtual int *GetInfo(int NID);
 	virtual bool OffloaderDeletePkt(void);
 	virtual bool DestinationDeletePkt(void);
 	virtual bool isDelivered(int PID);
 	virtual bool ExchangeDirectSummary(void);
 	virtual bool NoDuplicatesSupport(void);
+	virtual void Checkpoint(Snapshot *snap);
 };
@@ -32,19 +32,62 @@
  * Each node has its vaccine component, so NID differentiates each component.
  * VaccineInfo is a set that holds all known packets that have been delivered to
  * their destinations (including packets delivered to current node too).  
+ * Learned keeps the same packets in the order they became known, so that only
+ * the part of this log that a peer has not confirmed is exchanged. The log costs
+ * 4 bytes per delivered packet on top of the (compressed) set, since any peer that
+ * has not been met yet needs it from the beginning.
  */
 Vaccine::Vaccine(int NID): DeletionMechanism()
 {
 	ID=NID;
 	VaccineInfo.clear();
+	Learned.clear();
+	Marks.clear();
 	return;
 }
 
 Vaccine::~Vaccine()
 {
+	Learned.clear();
+	Marks.clear();
 	return;
 }
 
+/* learn
+ * -----
+ * Records a delivered packet. Containers are compacted periodically since delivered
+ * packet IDs tend to form long runs as the simulation advances.
+ */
+void Vaccine::learn(int pktID)
+{
+	if(this->VaccineInfo.insert(pktID))
+	{
+		this->Learned.push_back(pktID);
+		if((this->Learned.size() % 4096) == 0)
+		{
+			this->VaccineInfo.runOptimize();
+		}
+	}
+	return;
+}
+
+/* getMarks
+ * --------
+ * Returns the high-water marks kept for node NID.
+ */
+struct VaccineMarks *Vaccine::getMarks(int NID)
+{
+	map<int,struct VaccineMarks>::iterator it=Marks.find(NID);
+	if(it == Marks.end())
+	{
+		struct VaccineMarks m;
+		m.Acked=0;
+		m.Seen=0;
+		it=Marks.insert(pair<int,struct VaccineMarks>(NID,m)).first;
+	}
+	return &(it->second);
+}
+
 /* setAsDelivered
  * --------------
  * This method is called when a packet that is destined to current node is delivered
@@ -52,7 +95,7 @@ Vaccine::~Vaccine()
  */
 void Vaccine::setAsDelivered(int pktID)
 {
-	this->VaccineInfo.insert(pktID);
+	this->learn(pktID);
 	return;
 }
 
@@ -78,7 +121,7 @@ void Vaccine::CleanBuffer(PacketBuffer* PktBf)
 			{
 				for(int i=0;i<(*it)->CodingDepth;i++)
 				{
-					if(!(this->exists((*it)->EncodedPktIDs[i])))
+					if(!(this->exists((*it)->Enc->PktIDs[i])))
 					{
 						flag=false;
 						//break;
@@ -98,14 +141,13 @@ void Vaccine::CleanBuffer(PacketBuffer* PktBf)
 			}
 			else
 			{
-				flag=this->exists((*it)->EncodedPktIDs[(*it)->mimic]);
+				flag=this->exists((*it)->Enc->PktIDs[(*it)->mimic]);
 			}
 			
 		}
 		if(flag)
 		{
-			delete (*it);
-			it=PktBf->Entries.erase(it);
+			it=PktBf->eraseEntry(it);
 			PktBf->PacketNum--;
 			//ToDo
 			//Stat->incPktsDied();
@@ -135,52 +177,53 @@ bool Vaccine::isDelivered(int PID)
  */
 bool Vaccine::exists(int pktID)
 {
-	set<int>::iterator it=VaccineInfo.find(pktID);
-	
-	if(it == VaccineInfo.end())
-	{
-		return false;
-	}
-	else
-	{
-		return true;
-	}
+	return VaccineInfo.contains(pktID);
 }
 
 /* UpdateInfo
  * ----------
- * Receives an array of packet IDs and inserts them into the VaccineInfo sets. 
+ * Receives an array of packet IDs from node NID and inserts them into the VaccineInfo
+ * set. The two positions after the packet IDs carry the length of the sender's log
+ * and how much of the local log the sender has already merged.
  */
-void Vaccine::UpdateInfo(int *info)
+void Vaccine::UpdateInfo(int *info, int NID)
 {
 	int contents=info[0];
+	struct VaccineMarks *m=getMarks(NID);
 	for(int i=1;i<=contents;i++)
 	{
-		if(!this->exists(info[i]))
-		{
-			this->VaccineInfo.insert(info[i]);
-		}
+		this->learn(info[i]);
+	}
+	//The received part of the sender's log starts at or before the merged position
+	if(info[contents+1] > m->Seen)
+	{
+		m->Seen=info[contents+1];
+	}
+	if(info[contents+2] > m->Acked)
+	{
+		m->Acked=info[contents+2];
 	}
 	return;
 }
 
 /* GetInfo
  * -------
- * Returns an array consisting of all packet IDs that have been delivered and the
- * current node is informed about.
+ * Returns an array consisting of the packet IDs that have been delivered, the current
+ * node is informed about, and node NID has not confirmed to know yet. The array is
+ * followed by the length of the local log and the merged position of NID's log.
  */
-int *Vaccine::GetInfo(void)
+int *Vaccine::GetInfo(int NID)
 {
-	int infoLength=(int)VaccineInfo.size();
-	int *res=(int *)malloc(sizeof(int)*(infoLength+1));
+	struct VaccineMarks *m=getMarks(NID);
+	int infoLength=(int)Learned.size()-m->Acked;
+	int *res=(int *)malloc(sizeof(int)*(infoLength+3));
 	res[0]=infoLength;
-	set<int>::iterator it;
-	int pos=1;
-	for (it=VaccineInfo.begin(); it!=VaccineInfo.end(); ++it)
+	for(int i=0;i<infoLength;i++)
 	{
-		res[pos]=(int)(*it);
-		pos++;
+		res[i+1]=Learned[m->Acked+i];
 	}
+	res[infoLength+1]=(int)Learned.size();
+	res[infoLength+2]=m->Seen;
 	return res;
 }
 
@@ -190,13 +233,14 @@ int *Vaccine::GetInfo(void)
  */
 void Vaccine::PrintInfo(void)
 {
-	set<int>::iterator it;
-	printf("Vaccine info for node %d has size %d: ",this->ID,(int)VaccineInfo.size());
-	for (it=VaccineInfo.begin(); it!=VaccineInfo.end(); ++it)
+	int *vals=VaccineInfo.getValues();
+	printf("Vaccine info for node %d has size %d: ",this->ID,vals[0]);
+	for(int i=1;i<=vals[0];i++)
 	{
-		printf("%d ",(int)(*it));
+		printf("%d ",vals[i]);
 	}
 	printf("\n");
+	free(vals);
 }
 
 /* OffloaderDeletePkt
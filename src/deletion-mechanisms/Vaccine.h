@@ -27,26 +27,46 @@
 	#include "DeletionMechanism.h"
 #endif
 
-#include <set>
+#ifndef ROARING_SET_H
+	#define ROARING_SET_H
+	#include "../data-structures/RoaringSet.h"
+#endif
+
+#include <map>
 
+/* VaccineMarks
+ * ------------
+ * High-water marks kept for each peer: how much of the local log of delivered packets
+ * the peer has confirmed (Acked), and how much of the peer's log has been merged
+ * locally (Seen).
+ */
+struct VaccineMarks
+{
+	int Acked;
+	int Seen;
+};
 
 class Vaccine:public DeletionMechanism
 {
 protected:
 	int ID;
-	set<int> VaccineInfo;
+	RoaringSet VaccineInfo;
+	vector<int> Learned;
+	map<int,struct VaccineMarks> Marks;
 public:
 	Vaccine(int NID);
 	~Vaccine();
 	virtual void setAsDelivered(int pktID);
 	virtual void CleanBuffer(PacketBuffer *PktBf);
-	virtual void UpdateInfo(int *info);
-	virtual int *GetInfo(void);
+	virtual void UpdateInfo(int *info, int NID);
+	virtual int *GetInfo(int NID);
 	virtual bool OffloaderDeletePkt(void);
 	virtual bool DestinationDeletePkt(void);
 	virtual bool isDelivered(int PID);
 	virtual bool NoDuplicatesSupport(void);
 private:
 	bool exists(int pktID);
+	void learn(int pktID);
+	struct VaccineMarks *getMarks(int NID);
 	void PrintInfo(void);
 };
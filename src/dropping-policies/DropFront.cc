@@ -28,7 +28,7 @@
 #endif
 
 
-DropFront::DropFront(list<PacketEntry*> *B, Statistics *St): DroppingPolicy(B, St)
+DropFront::DropFront(list<PacketEntry*> *B, BufferIndex *I, Statistics *St): DroppingPolicy(B, I, St)
 {
 	return;
 }
@@ -49,6 +49,7 @@ double DropFront::Drop()
 	drpCrtTime = Buf->front()->CreationTime;
 	drpHops = Buf->front()->Hops;
 
+	Index->remove(Buf->begin());
 	delete Buf->front();
 	Buf->pop_front();
 
@@ -36,7 +36,7 @@ using namespace std;
 class DropFront: public DroppingPolicy
 {
 public:
-	DropFront(list<PacketEntry*> *B, Statistics *St);
+	DropFront(list<PacketEntry*> *B, BufferIndex *I, Statistics *St);
 	~DropFront();
 	virtual double Drop();
 };
@@ -28,8 +28,9 @@
 #endif
 
 
-DropFrontASP::DropFrontASP(list<PacketEntry*> *B, Statistics *St): DroppingPolicy(B, St)
+DropFrontASP::DropFrontASP(list<PacketEntry*> *B, BufferIndex *I, Statistics *St): DroppingPolicy(B, I, St)
 {
+	Index->enable(RELAYS_BY_ARRIVAL_IDX);
 	return;
 }
 
@@ -42,36 +43,25 @@ DropFrontASP::~DropFrontASP()
 
 double DropFrontASP::Drop()
 {
-	bool found;
 	double drpCrtTime;
 	int drpHops;
-	list<PacketEntry*>::iterator it;
+	list<PacketEntry*>::iterator drop_cand;
 
 
-	found = false;
-	drpCrtTime = 0.0;
-	drpHops = 0;
-
-	for(it = Buf->begin(); it != Buf->end(); ++it)
+	if(!Index->RelaysByArrival.empty())
 	{
-		if((*it)->Hops > 0)
-		{
-			drpCrtTime = (*it)->CreationTime;
-			drpHops = (*it)->Hops;
-			delete (*it);
-			Buf->erase(it);
-			found = true;
-			break;
-		}
+		drop_cand = Index->firstRelay();
 	}
-
-	if(!found)
+	else
 	{
-		drpCrtTime = Buf->front()->CreationTime;
-		drpHops = Buf->front()->Hops;
-		delete Buf->front();
-		Buf->pop_front();
+		drop_cand = Buf->begin();
 	}
+	drpCrtTime = (*drop_cand)->CreationTime;
+	drpHops = (*drop_cand)->Hops;
+
+	Index->remove(drop_cand);
+	delete (*drop_cand);
+	Buf->erase(drop_cand);
 
 	Stat->incPktsDropped(drpCrtTime);
 	if(drpHops == 0)
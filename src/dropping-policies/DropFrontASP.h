@@ -36,7 +36,7 @@ using namespace std;
 class DropFrontASP: public DroppingPolicy
 {
 public:
-	DropFrontASP(list<PacketEntry*> *B, Statistics *St);
+	DropFrontASP(list<PacketEntry*> *B, BufferIndex *I, Statistics *St);
 	~DropFrontASP();
 	virtual double Drop();
 };
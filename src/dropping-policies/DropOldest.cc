@@ -28,8 +28,9 @@
 #endif
 
 
-DropOldest::DropOldest(list<PacketEntry*> *B, Statistics *St): DroppingPolicy(B, St)
+DropOldest::DropOldest(list<PacketEntry*> *B, BufferIndex *I, Statistics *St): DroppingPolicy(B, I, St)
 {
+	Index->enable(BY_CREATION_IDX);
 	return;
 }
 
@@ -44,24 +45,15 @@ double DropOldest::Drop()
 {
 	double oldestTime;
 	int drpHops;
-	list<PacketEntry*>::iterator it;
 	list<PacketEntry*>::iterator drop_cand;
 
 
-	drop_cand = Buf->begin();
-	oldestTime = (*(Buf->begin()))->CreationTime;
-	drpHops = (*(Buf->begin()))->Hops;
-
-	for(it = Buf->begin(); it != Buf->end(); ++it)
-	{
-		if((*it)->CreationTime < oldestTime)
-		{
-			oldestTime = (*it)->CreationTime;
-			drpHops = (*it)->Hops;
-			drop_cand = it;
-		}
-	}
+	/* Among packets with the same creation time, the one closer to the front is dropped */
+	drop_cand = Index->oldest();
+	oldestTime = (*drop_cand)->CreationTime;
+	drpHops = (*drop_cand)->Hops;
 
+	Index->remove(drop_cand);
 	delete (*drop_cand);
 	Buf->erase(drop_cand);
 
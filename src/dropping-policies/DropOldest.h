@@ -36,7 +36,7 @@ using namespace std;
 class DropOldest: public DroppingPolicy
 {
 public:
-	DropOldest(list<PacketEntry*> *B, Statistics *St);
+	DropOldest(list<PacketEntry*> *B, BufferIndex *I, Statistics *St);
 	~DropOldest();
 	virtual double Drop();
 };
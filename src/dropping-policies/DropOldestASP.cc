@@ -28,8 +28,9 @@
 #endif
 
 
-DropOldestASP::DropOldestASP(list<PacketEntry*> *B, Statistics *St): DroppingPolicy(B, St)
+DropOldestASP::DropOldestASP(list<PacketEntry*> *B, BufferIndex *I, Statistics *St): DroppingPolicy(B, I, St)
 {
+	Index->enable(BY_CREATION_IDX | RELAYS_BY_CREATION_IDX);
 	return;
 }
 
@@ -42,51 +43,26 @@ DropOldestASP::~DropOldestASP()
 
 double DropOldestASP::Drop()
 {
-	bool found;
 	double oldestTime;
 	int drpHops;
-	list<PacketEntry*>::iterator it;
 	list<PacketEntry*>::iterator drop_cand;
 
 
-	found = false;
-	drop_cand = Buf->begin();
-	oldestTime = (*(Buf->begin()))->CreationTime;
-	drpHops = (*(Buf->begin()))->Hops;
-
-	for(it = Buf->begin(); it != Buf->end(); ++it)
-	{
-		if(((*it)->CreationTime < oldestTime) && ((*it)->Hops > 0))
-		{
-			found = true;
-			oldestTime = (*it)->CreationTime;
-			drpHops = (*it)->Hops;
-			drop_cand = it;
-		}
-	}
-
-	if(found)
+	/* A relay packet is preferred only if it is older than the packet at the front */
+	if(!Index->RelaysByCreation.empty() && (*(Index->oldestRelay()))->CreationTime < Buf->front()->CreationTime)
 	{
-		delete (*drop_cand);
-		Buf->erase(drop_cand);
+		drop_cand = Index->oldestRelay();
 	}
 	else
 	{
-		oldestTime = (*(Buf->begin()))->CreationTime;
-		drpHops = (*(Buf->begin()))->Hops;
-
-		for(it = Buf->begin(); it != Buf->end(); ++it)
-		{
-			if((*it)->CreationTime < oldestTime)
-			{
-				oldestTime = (*it)->CreationTime;
-				drpHops = (*it)->Hops;
-				drop_cand = it;
-			}
-		}
-		delete (*drop_cand);
-		Buf->erase(drop_cand);
+		drop_cand = Index->oldest();
 	}
+	oldestTime = (*drop_cand)->CreationTime;
+	drpHops = (*drop_cand)->Hops;
+
+	Index->remove(drop_cand);
+	delete (*drop_cand);
+	Buf->erase(drop_cand);
 
 	Stat->incPktsDropped(oldestTime);
 	if(drpHops == 0)
@@ -36,7 +36,7 @@ using namespace std;
 class DropOldestASP: public DroppingPolicy
 {
 public:
-	DropOldestASP(list<PacketEntry*> *B, Statistics *St);
+	DropOldestASP(list<PacketEntry*> *B, BufferIndex *I, Statistics *St);
 	~DropOldestASP();
 	virtual double Drop();
 };
@@ -28,7 +28,7 @@
 #endif
 
 
-DropTail::DropTail(list<PacketEntry*> *B, Statistics *St): DroppingPolicy(B, St)
+DropTail::DropTail(list<PacketEntry*> *B, BufferIndex *I, Statistics *St): DroppingPolicy(B, I, St)
 {
 	return;
 }
@@ -49,6 +49,7 @@ double DropTail::Drop()
 	drpCrtTime = Buf->back()->CreationTime;
 	drpHops = Buf->back()->Hops;
 
+	Index->remove(--(Buf->end()));
 	delete Buf->back();
 	Buf->pop_back();
 
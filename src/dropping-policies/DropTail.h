@@ -36,7 +36,7 @@ using namespace std;
 class DropTail: public DroppingPolicy
 {
 public:
-	DropTail(list<PacketEntry*> *B, Statistics *St);
+	DropTail(list<PacketEntry*> *B, BufferIndex *I, Statistics *St);
 	~DropTail();
 	virtual double Drop();
 };
@@ -27,8 +27,9 @@
 	#include "DropTailASP.h"
 #endif
 
-DropTailASP::DropTailASP(list<PacketEntry*> *B, Statistics *St): DroppingPolicy(B, St)
+DropTailASP::DropTailASP(list<PacketEntry*> *B, BufferIndex *I, Statistics *St): DroppingPolicy(B, I, St)
 {
+	Index->enable(RELAYS_BY_ARRIVAL_IDX);
 	return;
 }
 
@@ -41,41 +42,25 @@ DropTailASP::~DropTailASP()
 
 double DropTailASP::Drop()
 {
-	bool found;
 	double drpCrtTime;
 	int drpHops;
-	list<PacketEntry*>::iterator it;
 	list<PacketEntry*>::iterator drop_cand;
 
 
-	found = false;
-	drpCrtTime = 0.0;
-	drpHops = 0;
-
-	for(it = Buf->begin(); it != Buf->end(); ++it)
-	{
-		if((*it)->Hops > 0)
-		{
-			found = true;
-			drpCrtTime = (*it)->CreationTime;
-			drpHops = (*it)->Hops;
-			drop_cand = it;
-		}
-	}
-
-	if(found)
+	if(!Index->RelaysByArrival.empty())
 	{
-		delete (*drop_cand);
-		Buf->erase(drop_cand);
+		drop_cand = Index->lastRelay();
 	}
 	else
 	{
-		drpCrtTime = Buf->back()->CreationTime;
-		drpHops = Buf->back()->Hops;
-
-		delete Buf->back();
-		Buf->pop_back();
+		drop_cand = --(Buf->end());
 	}
+	drpCrtTime = (*drop_cand)->CreationTime;
+	drpHops = (*drop_cand)->Hops;
+
+	Index->remove(drop_cand);
+	delete (*drop_cand);
+	Buf->erase(drop_cand);
 
 	Stat->incPktsDropped(drpCrtTime);
 	if(drpHops == 0)
@@ -36,7 +36,7 @@ using namespace std;
 class DropTailASP: public DroppingPolicy
 {
 public:
-	DropTailASP(list<PacketEntry*> *B, Statistics *St);
+	DropTailASP(list<PacketEntry*> *B, BufferIndex *I, Statistics *St);
 	~DropTailASP();
 	virtual double Drop();
 };
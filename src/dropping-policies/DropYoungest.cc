@@ -28,8 +28,9 @@
 #endif
 
 
-DropYoungest::DropYoungest(list<PacketEntry*> *B, Statistics *St): DroppingPolicy(B, St)
+DropYoungest::DropYoungest(list<PacketEntry*> *B, BufferIndex *I, Statistics *St): DroppingPolicy(B, I, St)
 {
+	Index->enable(BY_CREATION_IDX);
 	return;
 }
 
@@ -44,23 +45,15 @@ double DropYoungest::Drop()
 {
 	double youngestTime;
 	int drpHops;
-	list<PacketEntry*>::iterator it;
 	list<PacketEntry*>::iterator drop_cand;
 
 
-	drop_cand = Buf->begin();
-	youngestTime = (*(Buf->begin()))->CreationTime;
-	drpHops = (*(Buf->begin()))->Hops;
+	/* Among packets with the same creation time, the one closer to the back is dropped */
+	drop_cand = Index->youngest();
+	youngestTime = (*drop_cand)->CreationTime;
+	drpHops = (*drop_cand)->Hops;
 
-	for(it=Buf->begin(); it!=Buf->end(); ++it)
-	{
-		if((*it)->CreationTime >= youngestTime)
-		{
-			youngestTime = (*it)->CreationTime;
-			drpHops = (*it)->Hops;
-			drop_cand = it;
-		}
-	}
+	Index->remove(drop_cand);
 	delete (*drop_cand);
 	Buf->erase(drop_cand);
 
@@ -36,7 +36,7 @@ using namespace std;
 class DropYoungest: public DroppingPolicy
 {
 public:
-	DropYoungest(list<PacketEntry*> *B, Statistics *St);
+	DropYoungest(list<PacketEntry*> *B, BufferIndex *I, Statistics *St);
 	~DropYoungest();
 	virtual double Drop();
 };
@@ -28,8 +28,9 @@
 #endif
 
 
-DropYoungestASP::DropYoungestASP(list<PacketEntry*> *B, Statistics *St): DroppingPolicy(B, St)
+DropYoungestASP::DropYoungestASP(list<PacketEntry*> *B, BufferIndex *I, Statistics *St): DroppingPolicy(B, I, St)
 {
+	Index->enable(BY_CREATION_IDX | RELAYS_BY_CREATION_IDX);
 	return;
 }
 
@@ -42,51 +43,26 @@ DropYoungestASP::~DropYoungestASP()
 
 double DropYoungestASP::Drop()
 {
-	bool found;
 	double youngestTime;
 	int drpHops;
-	list<PacketEntry*>::iterator it;
 	list<PacketEntry*>::iterator drop_cand;
 
 
-	found = false;
-	drop_cand = Buf->begin();
-	youngestTime = (*(Buf->begin()))->CreationTime;
-	drpHops = (*(Buf->begin()))->Hops;
-
-	for(it=Buf->begin(); it!=Buf->end(); ++it)
-	{
-		if(((*it)->CreationTime >= youngestTime) && ((*it)->Hops > 0))
-		{
-			found = true;
-			youngestTime = (*it)->CreationTime;
-			drpHops = (*it)->Hops;
-			drop_cand = it;
-		}
-	}
-
-	if(found)
+	/* A relay packet is preferred only if it is not older than the packet at the front */
+	if(!Index->RelaysByCreation.empty() && (*(Index->youngestRelay()))->CreationTime >= Buf->front()->CreationTime)
 	{
-		delete (*drop_cand);
-		Buf->erase(drop_cand);
+		drop_cand = Index->youngestRelay();
 	}
 	else
 	{
-		youngestTime = (*(Buf->begin()))->CreationTime;
-		drpHops = (*(Buf->begin()))->Hops;
-
-		for(it=Buf->begin(); it!=Buf->end(); ++it)
-		{
-			if((*it)->CreationTime >= youngestTime)
-			{
-				youngestTime = (*it)->CreationTime;
-				drpHops = (*it)->Hops;
-				drop_cand = it;
-			}
-		}
-		delete (*drop_cand);
-		Buf->erase(drop_cand);
+		drop_cand = Index->youngest();
 	}
+	youngestTime = (*drop_cand)->CreationTime;
+	drpHops = (*drop_cand)->Hops;
+
+	Index->remove(drop_cand);
+	delete (*drop_cand);
+	Buf->erase(drop_cand);
 
 	Stat->incPktsDropped(youngestTime);
 	if(drpHops == 0)
@@ -36,7 +36,7 @@ using namespace std;
 class DropYoungestASP: public DroppingPolicy
 {
 public:
-	DropYoungestASP(list<PacketEntry*> *B, Statistics *St);
+	DropYoungestASP(list<PacketEntry*> *B, BufferIndex *I, Statistics *St);
 	~DropYoungestASP();
 	virtual double Drop();
 };
@@ -28,9 +28,10 @@
 #endif
 
 
-DroppingPolicy::DroppingPolicy(list<PacketEntry*> *B, Statistics *St)
+DroppingPolicy::DroppingPolicy(list<PacketEntry*> *B, BufferIndex *I, Statistics *St)
 {
 	this->Buf = B;
+	this->Index = I;
 	this->Stat = St;
 
 	return;
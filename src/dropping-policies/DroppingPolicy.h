@@ -31,6 +31,11 @@
 	#include "../core/PacketEntry.h"
 #endif
 
+#ifndef BUFFER_INDEX_H
+	#define BUFFER_INDEX_H
+	#include "../core/BufferIndex.h"
+#endif
+
 #ifndef SETTINGS_H
 	#define SETTINGS_H
 	#include "../core/Settings.h"
@@ -48,8 +53,9 @@ class DroppingPolicy
 {
 public:
 	list<PacketEntry*> *Buf;
+	BufferIndex *Index;
 	Statistics *Stat;
-	DroppingPolicy(list<PacketEntry*> *B, Statistics *St);
+	DroppingPolicy(list<PacketEntry*> *B, BufferIndex *I, Statistics *St);
 	virtual ~DroppingPolicy();
 	virtual double Drop() = 0;
 };
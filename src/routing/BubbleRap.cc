@@ -104,7 +104,7 @@ void BubbleRap::Contact(double CTime, int NID)
 	//SendDirectPackets(CTime,NID);
 	
 	//Get information about known delivered packets
-	int *Information=DM->GetInfo();
+	int *Information=DM->GetInfo(NID);
 	if(Information != NULL)
 	{
 		//Create a vaccine information packet
@@ -129,11 +129,9 @@ void BubbleRap::Contact(double CTime, int NID)
 void BubbleRap::AfterDirectTransfers(double CTime, int NID)
 {
 	Packet *ReqPacket;
-	Header *h;
 	/* Create a new request packet (Local Community and Familiar Sets request) */
 	ReqPacket = new ReqLCandFS(CTime, 0);
-	h = new BasicHeader(this->NodeID, NID);
-	ReqPacket->setHeader(h);
+	ReqPacket->setHeader(BasicHeader(this->NodeID, NID));
 	pktPool->AddPacket(ReqPacket);
 	/* Send the packet to the new contact */
 	Mlayer->SendPkt(CTime, this->NodeID, NID, ReqPacket->getSize(), ReqPacket->getID());
@@ -331,7 +329,6 @@ void BubbleRap::ReceptionReqLCandFS(Header *hd, Packet *pkt, int PID, double Cur
 	bool *myLocalCommunity;
 	bool **myFamiliarSets;
 	Packet *responsePacket;
-	Header *responseHeader;
 
 
 	#ifdef BUBBLERAP_DEBUG
@@ -342,8 +339,7 @@ void BubbleRap::ReceptionReqLCandFS(Header *hd, Packet *pkt, int PID, double Cur
 	myLocalCommunity = labeling->cloneLocalCommunity(CurrentTime);
 	myFamiliarSets = labeling->cloneFamiliarSets(CurrentTime);
 	responsePacket = new LCandFS(CurrentTime, myLocalCommunity, myFamiliarSets, 0);
-	responseHeader = new BasicHeader(this->NodeID, hd->GetprevHop());
-	responsePacket->setHeader(responseHeader);
+	responsePacket->setHeader(BasicHeader(this->NodeID, hd->GetprevHop()));
 	((LCandFS *)responsePacket)->setmaxN(Set->getNN());
 	pktPool->AddPacket(responsePacket);
 
@@ -373,7 +369,6 @@ void BubbleRap::ReceptionLCandFS(Header *hd,Packet *pkt,int PID,double CurrentTi
 	bool **encFamiliarSets;
 	struct PktDest *mySummaryVector;
 	Packet *responsePacket;
-	Header *responseHeader;
 
 
 	#ifdef BUBBLERAP_DEBUG
@@ -408,8 +403,7 @@ void BubbleRap::ReceptionLCandFS(Header *hd,Packet *pkt,int PID,double CurrentTi
 	
 	/* Create a response packet containing bubble information and summary vector */
 	responsePacket = new BubbleSummary(CurrentTime, allPackets[0], mySummaryVector, myLocalCommunity, myLocalRank, myGlobalRank, 0);
-	responseHeader = new BasicHeader(this->NodeID, hd->GetprevHop());
-	responsePacket->setHeader(responseHeader);
+	responsePacket->setHeader(BasicHeader(this->NodeID, hd->GetprevHop()));
 	pktPool->AddPacket(responsePacket);
 
 
@@ -445,7 +439,6 @@ void BubbleRap::ReceptionBubbleSummary(Header *hd, Packet *pkt, int PID, double
 	double myGlobalRank=0.0;
 	struct PktDest *encSummaryVector=NULL;
 	Packet *responsePacket=NULL;
-	Header *responseHeader=NULL;
 
 
 	#ifdef BUBBLERAP_DEBUG
@@ -537,8 +530,7 @@ void BubbleRap::ReceptionBubbleSummary(Header *hd, Packet *pkt, int PID, double
 	responsePacket = new MarkedRequestPacket(CurrentTime, 0);
 	responsePacket->setContents((void *) myRequestVector);
 	((MarkedRequestPacket *)responsePacket)->setMarked(myRequestMarks);
-	responseHeader = new BasicHeader(this->NodeID, hd->GetprevHop());
-	responsePacket->setHeader(responseHeader);
+	responsePacket->setHeader(BasicHeader(this->NodeID, hd->GetprevHop()));
 	pktPool->AddPacket(responsePacket);
 
 	/* Send the packet with the response */
@@ -666,3 +658,13 @@ void BubbleRap::SendPacket(double STime, int pktID,int nHop,int RepValue)
 
 	return;
 }
+
+
+void BubbleRap::Checkpoint(Snapshot *snap)
+{
+	this->CheckpointMechanisms(snap);
+	this->ranking->Checkpoint(snap);
+	this->labeling->Checkpoint(snap);
+
+	return;
+}
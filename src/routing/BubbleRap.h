@@ -53,6 +53,7 @@ protected:
 public:
 	BubbleRap(PacketPool* PP, MAC* mc, PacketBuffer* Bf, int NID, Statistics *St, Settings *S, God *G);
 	~BubbleRap();
+	virtual void Checkpoint(Snapshot *snap);
 	virtual void NewContact(double CTime, int NID);
 	virtual void ContactRemoved(double CTime, int NID);
 	virtual void Contact(double CTime, int NID);
@@ -202,7 +202,7 @@ void CnR::Contact(double CTime, int NID)
 		MyDPT->ContactUp(NID, CTime);
 	}
 	//Get information about known delivered packets
-	int *Information=DM->GetInfo();
+	int *Information=DM->GetInfo(NID);
 	if(Information != NULL)
 	{
 		//Create a vaccine information packet
@@ -390,8 +390,7 @@ void CnR::SendSummary(double CTime, int NID)
 	//Create new summary packet
 	Packet *SumPacket=new PktDests(CTime,0);
 	SumPacket->setContents((void *)Sum);
-	Header *SumHeader=new BasicHeader(this->NodeID,NID);
-	SumPacket->setHeader(SumHeader);
+	SumPacket->setHeader(BasicHeader(this->NodeID,NID));
 	((PktDests*)SumPacket)->setPktNum(OtherSummary[0]);
 	//Add packet to the packet pool
 	pktPool->AddPacket(SumPacket);
@@ -415,8 +414,7 @@ void CnR::SendContactRequest(double CTime, int NID)
 {
 	//Create new request contacts packet
 	Packet *ReqPacket=new ReqContacts(CTime,0);
-	Header *Reqh=new BasicHeader(this->NodeID,NID);
-	ReqPacket->setHeader(Reqh);
+	ReqPacket->setHeader(BasicHeader(this->NodeID,NID));
 	//Add packet to the packet pool
 	pktPool->AddPacket(ReqPacket);
 	//Send packet to the new contact
@@ -431,8 +429,7 @@ void CnR::SendRSPMRequest(double CTime, int NID)
 {
 	//Create new request contacts packet
 	Packet *ReqPacket=new ReqRSPM(CTime,0);
-	Header *Reqh=new BasicHeader(this->NodeID,NID);
-	ReqPacket->setHeader(Reqh);
+	ReqPacket->setHeader(BasicHeader(this->NodeID,NID));
 	//Add packet to the packet pool
 	pktPool->AddPacket(ReqPacket);
 	//Send packet to the new contact
@@ -455,8 +452,7 @@ void CnR::ReceptionRequestContacts(Header* hd, Packet* pkt, int PID, double Curr
 		double *delivpre=MyDPT->CloneDPT(CurrentTime);
 		Packet *Response=new DPs(CurrentTime,0);
 		Response->setContents((void *)delivpre);
-		Header *reshd=new BasicHeader(this->NodeID,hd->GetprevHop());
-		Response->setHeader(reshd);
+		Response->setHeader(BasicHeader(this->NodeID,hd->GetprevHop()));
 		//Add packet to the packet pool
 		pktPool->AddPacket(Response);
 		//Send packet
@@ -477,8 +473,7 @@ void CnR::ReceptionRequestContacts(Header* hd, Packet* pkt, int PID, double Curr
 		int *con=Adja->GetMyContacts();
 		Packet *Response=new Contacts(CurrentTime,0);
 		Response->setContents((void *)con);
-		Header *reshd=new BasicHeader(this->NodeID,hd->GetprevHop());
-		Response->setHeader(reshd);
+		Response->setHeader(BasicHeader(this->NodeID,hd->GetprevHop()));
 		//Add packet to the packet pool
 		pktPool->AddPacket(Response);
 		//Send packet
@@ -510,8 +505,7 @@ void CnR::ReceptionRequestRSPM(Header* hd, Packet* pkt, int PID, double CurrentT
 	double *val=((SPM *)Util)->getRSPMfor(hd->GetprevHop());
 	Packet *Response=new IndRSPM(CurrentTime,0);
 	Response->setContents((void *)val);
-	Header *reshd=new BasicHeader(this->NodeID,hd->GetprevHop());
-	Response->setHeader(reshd);
+	Response->setHeader(BasicHeader(this->NodeID,hd->GetprevHop()));
 	//Add packet to the packet pool
 	pktPool->AddPacket(Response);
 	//Send packet
@@ -657,8 +651,7 @@ void CnR::ReceptionSummary(Header *hd,Packet *pkt,int PID,double CurrentTime)
 	free(reqDest);
 	//Create a packet request as a response
 	Packet *ReqPacket=new PktUtils(CurrentTime,0);
-	Header *head=new BasicHeader(this->NodeID,hd->GetprevHop());
-	ReqPacket->setHeader(head);
+	ReqPacket->setHeader(BasicHeader(this->NodeID,hd->GetprevHop()));
 	ReqPacket->setContents((void *)RList);
 	((PktUtils *)ReqPacket)->setPktNum(unKnown);
 	//Add packet to the packet pool
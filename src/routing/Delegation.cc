@@ -226,7 +226,7 @@ void Delegation::Contact(double CTime, int NID)
 		MyDPT->ContactUp(NID, CTime);
 	}
 	//Get information about known delivered packets
-	int *Information=DM->GetInfo();
+	int *Information=DM->GetInfo(NID);
 	if(Information != NULL)
 	{
 		//Create a vaccine information packet
@@ -472,8 +472,7 @@ void Delegation::SendContactRequest(double CTime, int NID)
 {
 	//Create new request contacts packet
 	Packet *ReqPacket=new ReqContacts(CTime,0);
-	Header *Reqh=new BasicHeader(this->NodeID,NID);
-	ReqPacket->setHeader(Reqh);
+	ReqPacket->setHeader(BasicHeader(this->NodeID,NID));
 	//Add packet to the packet pool
 	pktPool->AddPacket(ReqPacket);
 	//Send packet to the new contact
@@ -493,8 +492,7 @@ void Delegation::ReceptionRequestContacts(Header* hd, Packet* pkt, int PID, doub
 		double *delivpre=MyDPT->CloneDPT(CurrentTime);
 		Packet *Response=new DPs(CurrentTime,0);
 		Response->setContents((void *)delivpre);
-		Header *reshd=new BasicHeader(this->NodeID,hd->GetprevHop());
-		Response->setHeader(reshd);
+		Response->setHeader(BasicHeader(this->NodeID,hd->GetprevHop()));
 		//Add packet to the packet pool
 		pktPool->AddPacket(Response);
 		//Send packet
@@ -519,8 +517,7 @@ void Delegation::ReceptionRequestContacts(Header* hd, Packet* pkt, int PID, doub
 		int *con=Adja->GetMyContacts();
 		Packet *Response=new Contacts(CurrentTime,0);
 		Response->setContents((void *)con);
-		Header *reshd=new BasicHeader(this->NodeID,hd->GetprevHop());
-		Response->setHeader(reshd);
+		Response->setHeader(BasicHeader(this->NodeID,hd->GetprevHop()));
 		//Add packet to the packet pool
 		pktPool->AddPacket(Response);
 		//Send packet
@@ -614,8 +611,7 @@ void Delegation::SendSummary(double CTime, int NID)
 	//Create new summary packet
 	Packet *SumPacket=new PktDests(CTime,0);
 	SumPacket->setContents((void *)Sum);
-	Header *SumHeader=new BasicHeader(this->NodeID,NID);
-	SumPacket->setHeader(SumHeader);
+	SumPacket->setHeader(BasicHeader(this->NodeID,NID));
 	((PktDests*)SumPacket)->setPktNum(OtherSummary[0]);
 	//Add packet to the packet pool
 	pktPool->AddPacket(SumPacket);
@@ -709,8 +705,7 @@ void Delegation::prepareReqSimBetTS(double CurrentTime,int encID, int numContent
 	}
 	//Create a packet request as a response
 	Packet *ReqPacket=new PktMultiUtils(CurrentTime,0);
-	Header *head=new BasicHeader(this->NodeID,encID);
-	ReqPacket->setHeader(head);
+	ReqPacket->setHeader(BasicHeader(this->NodeID,encID));
 	ReqPacket->setContents((void *)RList);
 	((PktMultiUtils *)ReqPacket)->setPktNum(numContents);
 	//Add packet to the packet pool
@@ -775,8 +770,7 @@ void Delegation::prepareReq(double CurrentTime,int encID, int numContents, int*
 	}
 	//Create a packet request as a response
 	Packet *ReqPacket=new PktUtils(CurrentTime,0);
-	Header *head=new BasicHeader(this->NodeID,encID);
-	ReqPacket->setHeader(head);
+	ReqPacket->setHeader(BasicHeader(this->NodeID,encID));
 	ReqPacket->setContents((void *)RList);
 	((PktUtils *)ReqPacket)->setPktNum(numContents);
 	//clean this - not needed
@@ -1108,8 +1102,7 @@ void Delegation::SendRSPMRequest(double CTime, int NID)
 {
 	//Create new request contacts packet
 	Packet *ReqPacket=new ReqRSPM(CTime,0);
-	Header *Reqh=new BasicHeader(this->NodeID,NID);
-	ReqPacket->setHeader(Reqh);
+	ReqPacket->setHeader(BasicHeader(this->NodeID,NID));
 	//Add packet to the packet pool
 	pktPool->AddPacket(ReqPacket);
 	//Send packet to the new contact
@@ -1132,8 +1125,7 @@ void Delegation::ReceptionRequestRSPM(Header* hd, Packet* pkt, int PID, double C
 	double *val=((SPM *)Util)->getRSPMfor(hd->GetprevHop());
 	Packet *Response=new IndRSPM(CurrentTime,0);
 	Response->setContents((void *)val);
-	Header *reshd=new BasicHeader(this->NodeID,hd->GetprevHop());
-	Response->setHeader(reshd);
+	Response->setHeader(BasicHeader(this->NodeID,hd->GetprevHop()));
 	//Add packet to the packet pool
 	pktPool->AddPacket(Response);
 	//Send packet
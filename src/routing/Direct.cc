@@ -238,3 +238,11 @@ void Direct::SendPacket(double STime, int pktID, int nHop, int RepValue)
 	}
 	return;
 }
+
+
+void Direct::Checkpoint(Snapshot *snap)
+{
+	this->CheckpointMechanisms(snap);
+
+	return;
+}
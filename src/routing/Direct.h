@@ -38,6 +38,7 @@ class Direct:public Routing
 public:
 	Direct(PacketPool* PP, MAC* mc, PacketBuffer* Bf, int NID, Statistics *St, Settings *S, God *G);
 	~Direct();
+	virtual void Checkpoint(Snapshot *snap);
 	virtual void ContactRemoved(double CTime, int NID);
 	virtual void Contact(double CTime, int NID);
 	virtual void NewContact(double CTime, int NID);
@@ -176,7 +176,7 @@ void EBR::Contact(double CTime, int NID)
 {
 	EncUtil->ContactUp(NID,CTime);
 	//Get information about known delivered packets
-	int *Information=DM->GetInfo();
+	int *Information=DM->GetInfo(NID);
 	if(Information != NULL)
 	{
 		//Create a vaccine information packet
@@ -203,11 +203,16 @@ void EBR::AfterDirectTransfers(double CTime, int NID)
 	//Prepare the summary vector for all other packets
 //  	int *OtherSummary=Buf->getAllPackets();
 	int *OtherSummary=Buf->getPacketsNotDestinedTo(NID);
+	if(OtherSummary[0] == 0)
+	{//No packet inside buffer, so the request would be empty as well
+		free(OtherSummary);
+		Stat->incSkippedHandshakes();
+		return;
+	}
 	//Create new summary packet
 	Packet *SumPacket=new SummaryPacket(CTime,0);
 	SumPacket->setContents((void *)OtherSummary);
-	Header *SumHeader=new BasicHeader(this->NodeID,NID);
-	SumPacket->setHeader(SumHeader);
+	SumPacket->setHeader(BasicHeader(this->NodeID,NID));
 	//Add packet to the packet pool
 	pktPool->AddPacket(SumPacket);
 	//Send packet to the new contact
@@ -313,8 +318,7 @@ void EBR::ReceptionSummary(Header *hd,Packet *pkt,int PID,double CurrentTime)
 	
 	//Create a packet request as a response
 	Packet *ReqPacket=new EBRequest(CurrentTime,0);
-	Header *head=new BasicHeader(this->NodeID,hd->GetprevHop());
-	ReqPacket->setHeader(head);
+	ReqPacket->setHeader(BasicHeader(this->NodeID,hd->GetprevHop()));
 	ReqPacket->setContents((void *)req);
 	((EBRequest *)ReqPacket)->SetEncounters(EncUtil->get(this->NodeID,CurrentTime));
 	//Add packet to the packet pool
@@ -74,7 +74,7 @@ Epidemic::~Epidemic()
 void Epidemic::Contact(double CTime, int NID)
 {
 	//Get information about known delivered packets
-	int *Information=DM->GetInfo();
+	int *Information=DM->GetInfo(NID);
 	if(Information != NULL)
 	{
 		//Create a vaccine information packet
@@ -114,15 +114,16 @@ void Epidemic::AfterDirectTransfers(double CTime, int NID)
 {
 	//Prepare the summary vector
 	int *summary=Buf->getPacketsNotDestinedTo(NID);
-// 	if(summary[0] == 0)
-// 	{//No packet inside buffer
-// 		return;
-// 	}
+	if(summary[0] == 0)
+	{//No packet inside buffer, so the request would be empty as well
+		free(summary);
+		Stat->incSkippedHandshakes();
+		return;
+	}
 	//Create new summary packet
 	Packet *SumPacket=new SummaryPacket(CTime,0);
 	SumPacket->setContents((void *)summary);
-	Header *h=new BasicHeader(this->NodeID,NID);
-	SumPacket->setHeader(h);
+	SumPacket->setHeader(BasicHeader(this->NodeID,NID));
 	//Add packet to the packet pool
 	pktPool->AddPacket(SumPacket);
 	//Send packet to the new contact
@@ -244,8 +245,7 @@ void Epidemic::ReceptionSummary(Header* hd, Packet* pkt, int PID, double Current
 	req[0]=unKnown;
 	//Create a packet request as a response
 	Packet *ReqPacket=new RequestPacket(CurrentTime,0);
-	Header *head=new BasicHeader(this->NodeID,hd->GetprevHop());
-	ReqPacket->setHeader(head);
+	ReqPacket->setHeader(BasicHeader(this->NodeID,hd->GetprevHop()));
 	ReqPacket->setContents((void *)req);
 	//Add packet to the packet pool
 	pktPool->AddPacket(ReqPacket);
@@ -401,3 +401,11 @@ void Epidemic::SendPacket(double STime, int pktID, int nHop, int RepValue)
 	}
 	return;
 }
+
+
+void Epidemic::Checkpoint(Snapshot *snap)
+{
+	this->CheckpointMechanisms(snap);
+
+	return;
+}
@@ -35,6 +35,7 @@ class Epidemic:public Routing
 public:
 	Epidemic(PacketPool* PP, MAC* mc, PacketBuffer* Bf,int NID,Statistics *St,Settings *S,God *G);
 	~Epidemic();
+	virtual void Checkpoint(Snapshot *snap);
 	virtual void recv(double rTime,int pktID);
 	virtual void NewContact(double CTime,int NID);
 	virtual void ContactRemoved(double CTime,int NID);
@@ -102,7 +102,7 @@ void LSFSpray::NewContact(double CTime, int NID)
 void LSFSpray::Contact(double CTime, int NID)
 {
 	//Get information about known delivered packets
-	int *Information=DM->GetInfo();
+	int *Information=DM->GetInfo(NID);
 	if(Information != NULL)
 	{
 		//Create a vaccine information packet
@@ -150,8 +150,7 @@ void LSFSpray::AfterDirectTransfers(double CTime, int NID)
 	((DstUtils *)OtherSummary)->setDestNum(DestInfo[0]);
 	//free memory
 	free(DestInfo);
-	Header *HSum=new BasicHeader(this->NodeID,NID);
-	OtherSummary->setHeader(HSum);
+	OtherSummary->setHeader(BasicHeader(this->NodeID,NID));
 	//Add packet to the packet pool
 	pktPool->AddPacket(OtherSummary);
 	//Send packet
@@ -299,8 +298,7 @@ void LSFSpray::ReceptionUtilDest(Header* hd, Packet* pkt, int PID, double Curren
 	//prepare response packet
 	Packet *AvailDest=new DstAvail(CurrentTime,0);
 	AvailDest->setContents((void *)Req);
-	Header *HReq=new BasicHeader(this->NodeID,hd->GetprevHop());
-	AvailDest->setHeader(HReq);
+	AvailDest->setHeader(BasicHeader(this->NodeID,hd->GetprevHop()));
 	//Add packet to the packet pool
 	pktPool->AddPacket(AvailDest);
 	//Send packet
@@ -329,8 +327,7 @@ void LSFSpray::ReceptionAvailDest(Header* hd, Packet* pkt, int PID, double Curre
 	//Create new summary packet
 	Packet *SumPacket=new SummaryPacket(CurrentTime,0);
 	SumPacket->setContents((void *)pktsToSend);
-	Header *newhd=new BasicHeader(this->NodeID,hd->GetprevHop());
-	SumPacket->setHeader(newhd);
+	SumPacket->setHeader(BasicHeader(this->NodeID,hd->GetprevHop()));
 	//Add packet to the packet pool
 	pktPool->AddPacket(SumPacket);
 	//Send packet to the new contact
@@ -370,8 +367,7 @@ void LSFSpray::ReceptionSummary(Header* hd, Packet* pkt, int PID, double Current
 	req[0]=unKnown;
 	//Create a packet request as a response
 	Packet *ReqPacket=new RequestPacket(CurrentTime,0);
-	Header *head=new BasicHeader(this->NodeID,hd->GetprevHop());
-	ReqPacket->setHeader(head);
+	ReqPacket->setHeader(BasicHeader(this->NodeID,hd->GetprevHop()));
 	ReqPacket->setContents((void *)req);
 	//Add packet to the packet pool
 	pktPool->AddPacket(ReqPacket);
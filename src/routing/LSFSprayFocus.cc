@@ -108,8 +108,7 @@ void LSFSprayFocus::ReceptionAvailDest(Header* hd, Packet* pkt, int PID, double
 	//Create new summary packet
 	Packet *SumPacket=new SummaryPacket(CurrentTime,0);
 	SumPacket->setContents((void *)pktsToSend);
-	Header *newhd=new BasicHeader(this->NodeID,hd->GetprevHop());
-	SumPacket->setHeader(newhd);
+	SumPacket->setHeader(BasicHeader(this->NodeID,hd->GetprevHop()));
 	//Add packet to the packet pool
 	pktPool->AddPacket(SumPacket);
 	//Send packet to the new contact
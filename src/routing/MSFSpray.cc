@@ -62,7 +62,7 @@ void MSFSpray::Contact(double CTime, int NID)
 	SB->Update(NID,CTime);
 	
 	//Get information about known delivered packets
-	int *Information=DM->GetInfo();
+	int *Information=DM->GetInfo(NID);
 	if(Information != NULL)
 	{
 		//Create a vaccine information packet
@@ -105,14 +105,14 @@ void MSFSpray::AfterDirectTransfers(double CTime, int NID)
 	if(OtherSummary[0] == 0)
 	{//No packet inside buffer
 		free(OtherSummary);
+		Stat->incSkippedHandshakes();
 		return;
 	}
 	//Create new summary packet
 	Packet *SumPacket=new SocialSummary(CTime,0);
 	SumPacket->setContents((void *)OtherSummary);
 	((SocialSummary *)SumPacket)->SetSocialMetric(SB->get(this->NodeID,CTime));
-	Header *Directhead=new BasicHeader(this->NodeID,NID);
-	SumPacket->setHeader(Directhead);
+	SumPacket->setHeader(BasicHeader(this->NodeID,NID));
 	//Add packet to the packet pool
 	pktPool->AddPacket(SumPacket);
 	//Send packet to the new contact
@@ -152,8 +152,7 @@ void MSFSpray::ReceptionUtilSummary(Header* hd, Packet* pkt, int PID, double Cur
 	req[0]=unKnown;
 	//Create a packet request as a response
 	Packet *ReqPacket=new RequestPacket(CurrentTime,0);
-	Header *head=new BasicHeader(this->NodeID,hd->GetprevHop());
-	ReqPacket->setHeader(head);
+	ReqPacket->setHeader(BasicHeader(this->NodeID,hd->GetprevHop()));
 	ReqPacket->setContents((void *)req);
 	//Add packet to the packet pool
 	pktPool->AddPacket(ReqPacket);
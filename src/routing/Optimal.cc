@@ -55,7 +55,7 @@ void Optimal::Contact(double CTime, int NID)
 	int *Information;
 
 
-	Information = DM->GetInfo();
+	Information = DM->GetInfo(NID);
 	if(Information != NULL)
 	{
 		printf("\n[Error]: (Optimal::Contact) Node %d received information about known delivered packets from node %d\n\n", this->NodeID, NID);
@@ -81,7 +81,6 @@ void Optimal::Contact(double CTime, int NID)
 
 void Optimal::AfterDirectTransfers(double CTime, int NID)
 {
-	Header *h;
 	Packet *EnhSumPkt;
 	struct PktIDandHops *pktData;
 
@@ -90,8 +89,7 @@ void Optimal::AfterDirectTransfers(double CTime, int NID)
 	pktData = Buf->getPktIDsandHopsNotDestinedTo(NID);
 	EnhSumPkt = new EnhancedSummaryPacket(CTime, 0);
 	EnhSumPkt->setContents((void *) pktData);
-	h = new BasicHeader(this->NodeID, NID);
-	EnhSumPkt->setHeader(h);
+	EnhSumPkt->setHeader(BasicHeader(this->NodeID, NID));
 	pktPool->AddPacket(EnhSumPkt);
 
 
@@ -242,7 +240,6 @@ void Optimal::ReceptionEnhancedSummary(Header* hd, Packet* pkt, int PID, double
 	int *unknownPktIDs;
 	struct PktIDandHops *pktData;
 	Packet *ReqPacket;
-	Header *head;
 
 
 	#ifdef OPTIMAL_DEBUG
@@ -278,8 +275,7 @@ void Optimal::ReceptionEnhancedSummary(Header* hd, Packet* pkt, int PID, double
 	/* Create a packet with the IDs of the unknown packets */
 	ReqPacket = new RequestPacket(CurrentTime, 0);
 	ReqPacket->setContents((void *) unknownPktIDs);
-	head = new BasicHeader(this->NodeID, hd->GetprevHop());
-	ReqPacket->setHeader(head);
+	ReqPacket->setHeader(BasicHeader(this->NodeID, hd->GetprevHop()));
 	pktPool->AddPacket(ReqPacket);
 
 
@@ -377,3 +373,11 @@ void Optimal::SendPacket(double STime, int pktID, int nHop, int RepValue)
 
 	return;
 }
+
+
+void Optimal::Checkpoint(Snapshot *snap)
+{
+	this->CheckpointMechanisms(snap);
+
+	return;
+}
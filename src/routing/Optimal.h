@@ -37,6 +37,7 @@ class Optimal: public Routing
 public:
 	Optimal(PacketPool* PP, MAC* mc, PacketBuffer* Bf, int NID, Statistics *St, Settings *S, God *G);
 	~Optimal();
+	virtual void Checkpoint(Snapshot *snap);
 	virtual void NewContact(double CTime, int NID);
 	virtual void Contact(double CTime, int NID);
 	virtual void ContactRemoved(double CTime, int NID);
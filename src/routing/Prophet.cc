@@ -317,7 +317,6 @@ void Prophet::recv(double rTime, int pktID)
 void Prophet::AfterDirectTransfers(double CTime, int NID)
 {
 	Packet *ReqPacket;
-	Header *h;
 
 
 	#ifdef CC_DEBUG
@@ -328,8 +327,7 @@ void Prophet::AfterDirectTransfers(double CTime, int NID)
 
 	/* Create a new request contacts packet */
 	ReqPacket = new ReqContacts(CTime, 0);
-	h = new BasicHeader(this->NodeID, NID);
-	ReqPacket->setHeader(h);
+	ReqPacket->setHeader(BasicHeader(this->NodeID, NID));
 	pktPool->AddPacket(ReqPacket);
 
 
@@ -348,7 +346,6 @@ void Prophet::ReceptionRequestContacts(Header *hd, Packet *pkt, int PID, double
 {
 	double *myDPT;
 	Packet *responsePacket;
-	Header *responseHeader;
 
 
 	#ifdef PROPHET_DEBUG
@@ -361,8 +358,7 @@ void Prophet::ReceptionRequestContacts(Header *hd, Packet *pkt, int PID, double
 	responsePacket = new DPs(CurrentTime, 0);
 	responsePacket->setContents((void *) myDPT);
 	responsePacket->setExtraInfo(CC->getExtraInfo(CurrentTime));
-	responseHeader = new BasicHeader(this->NodeID, hd->GetprevHop());
-	responsePacket->setHeader(responseHeader);
+	responsePacket->setHeader(BasicHeader(this->NodeID, hd->GetprevHop()));
 	pktPool->AddPacket(responsePacket);
 
 
@@ -596,3 +592,12 @@ void Prophet::SendPacket(double STime, int pktID, int nHop, int RepValue)
 
 	return;
 }
+
+
+void Prophet::Checkpoint(Snapshot *snap)
+{
+	this->CheckpointMechanisms(snap);
+	this->MyDPT->Checkpoint(snap);
+
+	return;
+}
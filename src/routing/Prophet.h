@@ -46,6 +46,7 @@ public:
 	virtual void Contact(double CTime, int NID);
 	virtual void recv(double rTime, int pktID);
 	~Prophet();
+	virtual void Checkpoint(Snapshot *snap);
 	DPT *MyDPT;
 
 protected:
@@ -318,7 +318,7 @@ void ProphetSpray::Contact(double CTime, int NID)
 {
 	MyDPT->ContactUp(NID, CTime);
 	//Get information about known delivered packets
-	int *Information=DM->GetInfo();
+	int *Information=DM->GetInfo(NID);
 	if(Information != NULL)
 	{
 		//Create a vaccine information packet
@@ -344,8 +344,7 @@ void ProphetSpray::AfterDirectTransfers(double CTime, int NID)
 {
 	//Create new request packet (DPT request)
 	Packet *ReqPacket=new ReqContacts(CTime,0);
-	Header *h=new BasicHeader(this->NodeID,NID);
-	ReqPacket->setHeader(h);
+	ReqPacket->setHeader(BasicHeader(this->NodeID,NID));
 	//Add packet to the packet pool
 	pktPool->AddPacket(ReqPacket);
 	//Send packet to the new contact
@@ -436,8 +435,7 @@ void ProphetSpray::ReceptionRequestContacts(Header* hd, Packet* pkt, int PID, do
 	double *delivpre=MyDPT->CloneDPT(CurrentTime);
 	Packet *Response=new DPs(CurrentTime,0);
 	Response->setContents((void *)delivpre);
-	Header *reshd=new BasicHeader(this->NodeID,hd->GetprevHop());
-	Response->setHeader(reshd);
+	Response->setHeader(BasicHeader(this->NodeID,hd->GetprevHop()));
 	//Add packet to the packet pool
 	pktPool->AddPacket(Response);
 	//Send packet
@@ -559,8 +557,7 @@ void ProphetSpray::ReceptionDPT(Header* hd, Packet* pkt, int PID, double Current
 	//Create new summary packet
 	Packet *SumPacket=new SummaryPacket(CurrentTime,0);
 	SumPacket->setContents((void *)Finalpkts);
-	Header *newhd=new BasicHeader(this->NodeID,hd->GetprevHop());
-	SumPacket->setHeader(newhd);
+	SumPacket->setHeader(BasicHeader(this->NodeID,hd->GetprevHop()));
 	//Add packet to the packet pool
 	pktPool->AddPacket(SumPacket);
 	//Send packet to the new contact
@@ -601,8 +598,7 @@ void ProphetSpray::ReceptionSummary(Header* hd, Packet* pkt, int PID, double Cur
 	req[0]=unKnown;
 	//Create a packet request as a response
 	Packet *ReqPacket=new RequestPacket(CurrentTime,0);
-	Header *head=new BasicHeader(this->NodeID,hd->GetprevHop());
-	ReqPacket->setHeader(head);
+	ReqPacket->setHeader(BasicHeader(this->NodeID,hd->GetprevHop()));
 	ReqPacket->setContents((void *)req);
 	//Add packet to the packet pool
 	pktPool->AddPacket(ReqPacket);
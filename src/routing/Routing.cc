@@ -73,6 +73,10 @@ Routing::Routing(PacketPool* PP, MAC* mc, PacketBuffer* Bf,int NID,Statistics *S
 			exit(EXIT_FAILURE);
 		}
 	}
+	#ifdef SPECIALIZED_BUILD
+	/* The scheduling policy has been fixed at compile time (see Specialization.h) */
+	sch = new SCHEDULING_TYPE(NID, this->Buf);
+	#else
 	switch(S->getSchedulingPolicy())
 	{
 		case FIFO_SP:
@@ -106,6 +110,7 @@ Routing::Routing(PacketPool* PP, MAC* mc, PacketBuffer* Bf,int NID,Statistics *S
 			exit(EXIT_FAILURE);
 		}
 	}
+	#endif
 	switch(S->getCongestionControl())
 	{
 		case NOCC_CC:
@@ -174,18 +179,30 @@ void Routing::NoCostRecv(PacketPool *PP,MAC *mc,PacketBuffer *Bf,int NID,Statist
 	return;
 }
 
+void Routing::Checkpoint(Snapshot *snap)
+{
+	snap->Unsupported("this routing protocol");
+	return;
+}
+
+void Routing::CheckpointMechanisms(Snapshot *snap)
+{
+	DM->Checkpoint(snap);
+	CC->Checkpoint(snap);
+	return;
+}
+
 void Routing::ReceptionAntipacket(Header *hd,Packet *pkt,int PID,double CurrentTime)
 {
 	//Get packet contents and update vaccine data structure
 	int *Dinfo=(int *)pkt->getContents();
-	DM->UpdateInfo(Dinfo);
+	DM->UpdateInfo(Dinfo,hd->GetprevHop());
 	//Remove packets that have reached their destinations from buffer
 	DM->CleanBuffer(this->Buf);
 	//Create an antipacket response
 	Packet *antiResp=new AntiPacketResponse(CurrentTime,0);
-	Header *h=new BasicHeader(this->NodeID,hd->GetprevHop());
-	antiResp->setHeader(h);
-	int *info=DM->GetInfo();
+	antiResp->setHeader(BasicHeader(this->NodeID,hd->GetprevHop()));
+	int *info=DM->GetInfo(hd->GetprevHop());
 	antiResp->setContents((void *)info);
 	//Add packet to the packet pool
 	pktPool->AddPacket(antiResp);
@@ -209,7 +226,7 @@ void Routing::ReceptionAntipacketResponse(Header *hd,Packet *pkt,int PID,double
 {
 	//Get packet contents and update vaccine data structure
 	int *Dinfo=(int *)pkt->getContents();
-	DM->UpdateInfo(Dinfo);
+	DM->UpdateInfo(Dinfo,hd->GetprevHop());
 	//Remove packets that have reached their destinations from buffer
 	DM->CleanBuffer(this->Buf);
 	//Delete antipacket response to free memory
@@ -261,8 +278,7 @@ void Routing::SendDirectSummary(double CTime, int NID)
 	//Create a new summary packet
 	Packet *SumPacket=new DirectSummaryPacket(CTime,0);
 	SumPacket->setContents((void *)summary);
-	Header *h=new BasicHeader(this->NodeID,NID);
-	SumPacket->setHeader(h);
+	SumPacket->setHeader(BasicHeader(this->NodeID,NID));
 	//Add packet to the packet pool
 	pktPool->AddPacket(SumPacket);
 	//Send packet to the new contact
@@ -284,8 +300,7 @@ void Routing::SendBufferReq(double CTime, int NID)
 {
 	//Create a new buffer request packet
 	Packet *bufRq=new BufferRequest(CTime,0);
-	Header *h=new BasicHeader(this->NodeID,NID);
-	bufRq->setHeader(h);
+	bufRq->setHeader(BasicHeader(this->NodeID,NID));
 	//Add packet to the packet pool
 	pktPool->AddPacket(bufRq);
 	//Send packet to the new contact
@@ -300,8 +315,7 @@ void Routing::ReceptionBufferReq(Header* hd, Packet* pkt, int PID, double Curren
 {
 	//Create a buffer response
 	Packet *bufRsp=new BufferReply(CurrentTime,0);
-	Header *h=new BasicHeader(this->NodeID,hd->GetprevHop());
-	bufRsp->setHeader(h);
+	bufRsp->setHeader(BasicHeader(this->NodeID,hd->GetprevHop()));
 	struct BufferInformation *info=(struct BufferInformation *)malloc(sizeof(struct BufferInformation));
 	CC->receivedBufferReq(CurrentTime, hd->GetprevHop());
 	info->bSize=CC->getBufferSize();
@@ -350,8 +364,7 @@ void Routing::SendVaccine(double CTime,int NID,int *info)
 	//Create a new antipacket
 	Packet *antip=new AntiPacket(CTime,0);
 	antip->setContents((void *)info);
-	Header *h=new BasicHeader(this->NodeID,NID);
-	antip->setHeader(h);
+	antip->setHeader(BasicHeader(this->NodeID,NID));
 	//Add packet to the packet pool
 	pktPool->AddPacket(antip);
 	//Send packet to the new contact
@@ -388,8 +401,7 @@ void Routing::ReceptionDirectSummary(Header *hd,Packet *pkt,int PID,double Curre
 	Directreq[0]=DirectunKnown;
 	//Create a packet request as a response
 	Packet *DirectReqPacket=new DirectRequestPacket(CurrentTime,0);
-	Header *Directhead=new BasicHeader(this->NodeID,hd->GetprevHop());
-	DirectReqPacket->setHeader(Directhead);
+	DirectReqPacket->setHeader(BasicHeader(this->NodeID,hd->GetprevHop()));
 	DirectReqPacket->setContents((void *)Directreq);
 	//Add packet to the packet pool
 	pktPool->AddPacket(DirectReqPacket);
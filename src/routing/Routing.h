@@ -71,6 +71,11 @@
 	#include "../congestion-control/CongestionControlMechanisms.h"
 #endif
 
+#ifndef SPECIALIZATION_H
+	#define SPECIALIZATION_H
+	#include "../core/Specialization.h"
+#endif
+
 
 class Routing
 {
@@ -83,6 +88,7 @@ public:
 	virtual void Contact(double CTime,int NID)=0;
 	virtual void Finalize(void);
 	virtual void NoCostRecv(PacketPool *PP,MAC *mc,PacketBuffer *Bf,int NID,Statistics *St,Settings *S);
+	virtual void Checkpoint(Snapshot *snap);
 
 protected:
 	PacketPool *pktPool;
@@ -93,9 +99,10 @@ protected:
 	God *SimGod;
 	DeletionMechanism *DM;
 	Settings *Set;
-	SchedulingPolicy *sch;
+	SCHEDULING_TYPE *sch;
 	CongestionControl *CC;
 	bool NCenabled;
+	void CheckpointMechanisms(Snapshot *snap);
 	virtual void ReceptionAntipacket(Header *hd,Packet *pkt,int PID,double CurrentTime);
 	virtual void ReceptionAntipacketResponse(Header *hd,Packet *pkt,int PID,double CurrentTime);
 	virtual void SendDirectPackets(double CTime,int NID);
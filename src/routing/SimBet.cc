@@ -258,7 +258,6 @@ void SimBet::recv(double rTime, int pktID)
 void SimBet::AfterDirectTransfers(double CTime, int NID)
 {
 	Packet *ReqPacket;
-	Header *h;
 
 
 	#ifdef CC_DEBUG
@@ -269,8 +268,7 @@ void SimBet::AfterDirectTransfers(double CTime, int NID)
 
 	/* Create a new request contacts packet */
 	ReqPacket = new ReqContacts(CTime, 0);
-	h = new BasicHeader(this->NodeID, NID);
-	ReqPacket->setHeader(h);
+	ReqPacket->setHeader(BasicHeader(this->NodeID, NID));
 	pktPool->AddPacket(ReqPacket);
 
 
@@ -289,7 +287,6 @@ void SimBet::ReceptionRequestContacts(Header *hd, Packet *pkt, int PID, double C
 {
 	int *con;
 	Packet *responsePacket;
-	Header *responseHeader;
 
 
 	#ifdef SIMBET_DEBUG
@@ -300,8 +297,7 @@ void SimBet::ReceptionRequestContacts(Header *hd, Packet *pkt, int PID, double C
 	con = Adja->GetMyContacts();
 	responsePacket = new Contacts(CurrentTime, 0);
 	responsePacket->setContents((void *) con);
-	responseHeader = new BasicHeader(this->NodeID, hd->GetprevHop());
-	responsePacket->setHeader(responseHeader);
+	responsePacket->setHeader(BasicHeader(this->NodeID, hd->GetprevHop()));
 	pktPool->AddPacket(responsePacket);
 
 
@@ -326,7 +322,6 @@ void SimBet::ReceptionContacts(Header *hd, Packet *pkt, int PID, double CurrentT
 	int *DestInfo;
 	struct DestSim *DList;
 	Packet *Summary;
-	Header *HSum;
 
 
 	#ifdef SIMBET_DEBUG
@@ -363,8 +358,7 @@ void SimBet::ReceptionContacts(Header *hd, Packet *pkt, int PID, double CurrentT
 	((Destinations *) Summary)->setDest(DestInfo[0]);
 	((Destinations *) Summary)->setBet(Adja->getBet());
 	free(DestInfo);
-	HSum = new BasicHeader(this->NodeID, hd->GetprevHop());
-	Summary->setHeader(HSum);
+	Summary->setHeader(BasicHeader(this->NodeID, hd->GetprevHop()));
 	pktPool->AddPacket(Summary);
 
 
@@ -401,7 +395,6 @@ void SimBet::ReceptionMetricsPerDest(Header *hd, Packet *pkt, int PID, double Cu
 	struct DestSim *Dst;
 	Destinations *Dpkt;
 	Packet *ReqDest;
-	Header *HReq;
 
 
 	#ifdef SIMBET_DEBUG
@@ -497,8 +490,7 @@ void SimBet::ReceptionMetricsPerDest(Header *hd, Packet *pkt, int PID, double Cu
 	ReqDest->setExtraInfo(CC->getExtraInfo(CurrentTime));
 	((ReqDestinations *) ReqDest)->setSenderUtils(otherSimBetUtils);
 	((ReqDestinations *) ReqDest)->setReceiverUtils(mySimBetUtils);
-	HReq = new BasicHeader(this->NodeID, hd->GetprevHop());
-	ReqDest->setHeader(HReq);
+	ReqDest->setHeader(BasicHeader(this->NodeID, hd->GetprevHop()));
 	pktPool->AddPacket(ReqDest);
 
 	/* Send the packet with the response */
@@ -726,3 +718,12 @@ void SimBet::SendPacket(double STime, int pktID, int nHop, int RepValue)
 
 	return;
 }
+
+
+void SimBet::Checkpoint(Snapshot *snap)
+{
+	this->CheckpointMechanisms(snap);
+	this->Adja->Checkpoint(snap);
+
+	return;
+}
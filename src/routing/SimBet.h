@@ -42,6 +42,7 @@ class SimBet:public Routing
 public:
 	SimBet(PacketPool* PP, MAC* mc, PacketBuffer* Bf, int NID, Statistics *St, Settings *S, God *G);
 	~SimBet();
+	virtual void Checkpoint(Snapshot *snap);
 	virtual void NewContact(double CTime, int NID);
 	virtual void ContactRemoved(double CTime, int NID);
 	virtual void Contact(double CTime, int NID);
@@ -117,7 +117,7 @@ void SimBetTS::Contact(double CTime, int NID)
 	CC->contactUp(CTime, NID);
 
 	//Get information about known delivered packet
-	Information = DM->GetInfo();
+	Information = DM->GetInfo(NID);
 	if(Information != NULL)
 	{
 		//Create a vaccine information packet
@@ -144,7 +144,6 @@ void SimBetTS::Contact(double CTime, int NID)
 void SimBetTS::AfterDirectTransfers(double CTime, int NID)
 {
 	Packet *ReqPacket;
-	Header *h;
 
 
 	#ifdef CC_DEBUG
@@ -155,8 +154,7 @@ void SimBetTS::AfterDirectTransfers(double CTime, int NID)
 
 	/* Create a new request contacts packet */
 	ReqPacket = new ReqContacts(CTime, 0);
-	h = new BasicHeader(this->NodeID, NID);
-	ReqPacket->setHeader(h);
+	ReqPacket->setHeader(BasicHeader(this->NodeID, NID));
 	pktPool->AddPacket(ReqPacket);
 
 
@@ -366,7 +364,6 @@ void SimBetTS::ReceptionRequestContacts(Header* hd, Packet* pkt, int PID, double
 {
 	int *con;
 	Packet *responsePacket;
-	Header *responseHeader;
 
 
 	#ifdef SIMBETTS_DEBUG
@@ -378,8 +375,7 @@ void SimBetTS::ReceptionRequestContacts(Header* hd, Packet* pkt, int PID, double
 	con = Adja->GetMyContacts();
 	responsePacket = new Contacts(CurrentTime, 0);
 	responsePacket->setContents((void *) con);
-	responseHeader = new BasicHeader(this->NodeID, hd->GetprevHop());
-	responsePacket->setHeader(responseHeader);
+	responsePacket->setHeader(BasicHeader(this->NodeID, hd->GetprevHop()));
 	pktPool->AddPacket(responsePacket);
 
 
@@ -405,7 +401,6 @@ void SimBetTS::ReceptionContacts(Header* hd, Packet* pkt, int PID, double Curren
 	int *DestInfo;
 	struct DestSim *DList;
 	Packet *Summary;
-	Header *HSum;
 
 
 	#ifdef SIMBETTS_DEBUG
@@ -445,8 +440,7 @@ void SimBetTS::ReceptionContacts(Header* hd, Packet* pkt, int PID, double Curren
 	((Destinations *) Summary)->setDest(DestInfo[0]);
 	((Destinations *) Summary)->setBet(Adja->getBet());
 	free(DestInfo);
-	HSum = new BasicHeader(this->NodeID, hd->GetprevHop());
-	Summary->setHeader(HSum);
+	Summary->setHeader(BasicHeader(this->NodeID, hd->GetprevHop()));
 	pktPool->AddPacket(Summary);
 
 
@@ -490,7 +484,6 @@ void SimBetTS::ReceptionMetricsPerDest(Header* hd, Packet* pkt, int PID, double
 	struct DestSim *Dst;
 	Destinations *Dpkt;
 	Packet *ReqDest;
-	Header *HReq;
 
 
 	#ifdef SIMBETTS_DEBUG
@@ -600,8 +593,7 @@ void SimBetTS::ReceptionMetricsPerDest(Header* hd, Packet* pkt, int PID, double
 	((ReqDestinations *) ReqDest)->setReceiverUtils(mySimBetTSUtils);
 	OwnedPackets = Buf->getPackets(Req);
 	((ReqDestinations *)ReqDest)->SetOwned(OwnedPackets);
-	HReq = new BasicHeader(this->NodeID, hd->GetprevHop());
-	ReqDest->setHeader(HReq);
+	ReqDest->setHeader(BasicHeader(this->NodeID, hd->GetprevHop()));
 	pktPool->AddPacket(ReqDest);
 
 	/* Send the packet with the response */
@@ -827,3 +819,12 @@ void SimBetTS::SendPacket(double STime, int pktID, int nHop, int RepValue)
 
 	return;
 }
+
+
+void SimBetTS::Checkpoint(Snapshot *snap)
+{
+	this->CheckpointMechanisms(snap);
+	this->Adja->Checkpoint(snap);
+
+	return;
+}
@@ -82,7 +82,7 @@ void SprayWait::NewContact(double CTime, int NID)
 void SprayWait::Contact(double CTime, int NID)
 {
 	//Get information about known delivered packets
-	int *Information=DM->GetInfo();
+	int *Information=DM->GetInfo(NID);
 	if(Information != NULL)
 	{
 		//Create a vaccine information packet
@@ -117,17 +117,16 @@ void SprayWait::AfterDirectTransfers(double CTime, int NID)
 //  	int *OtherSummary=Buf->getAllPackets();
 	
 	int *OtherSummary=Buf->getPacketsNotDestinedTo(NID);
-	
-// 	if(OtherSummary[0] == 0)
-// 	{//No packet inside buffer
-// 		free(OtherSummary);
-// 		return;
-// 	}
+	if(OtherSummary[0] == 0)
+	{//No packet inside buffer, so the request would be empty as well
+		free(OtherSummary);
+		Stat->incSkippedHandshakes();
+		return;
+	}
 	//Create new summary packet
 	Packet *SumPacket=new SummaryPacket(CTime,0);
 	SumPacket->setContents((void *)OtherSummary);
-	Header *SumHeader=new BasicHeader(this->NodeID,NID);
-	SumPacket->setHeader(SumHeader);
+	SumPacket->setHeader(BasicHeader(this->NodeID,NID));
 	//Add packet to the packet pool
 	pktPool->AddPacket(SumPacket);
 	//Send packet to the new contact
@@ -249,8 +248,7 @@ void SprayWait::ReceptionSummary(Header *hd,Packet *pkt,int PID,double CurrentTi
 	req[0]=unKnown;
 	//Create a packet request as a response
 	Packet *ReqPacket=new RequestPacket(CurrentTime,0);
-	Header *head=new BasicHeader(this->NodeID,hd->GetprevHop());
-	ReqPacket->setHeader(head);
+	ReqPacket->setHeader(BasicHeader(this->NodeID,hd->GetprevHop()));
 	ReqPacket->setContents((void *)req);
 	//Add packet to the packet pool
 	pktPool->AddPacket(ReqPacket);
@@ -434,3 +432,11 @@ void SprayWait::SendPacket(double STime, int pktID,int nHop,int RepValue)
 	}
 	return;
 }
+
+
+void SprayWait::Checkpoint(Snapshot *snap)
+{
+	this->CheckpointMechanisms(snap);
+
+	return;
+}
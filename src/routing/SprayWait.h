@@ -42,6 +42,7 @@ class SprayWait:public Routing
 public:
 	SprayWait(PacketPool* PP, MAC* mc, PacketBuffer* Bf,int NID,Statistics *St,Settings *S,God *G);
 	~SprayWait();
+	virtual void Checkpoint(Snapshot *snap);
 	virtual void recv(double rTime,int pktID);
 	virtual void NewContact(double CTime,int NID);
 	virtual void ContactRemoved(double CTime,int NID);
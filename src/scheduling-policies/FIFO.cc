@@ -54,13 +54,13 @@ void FIFO::addPacket(int PID, void *additionalInfo)
 	}
 
 
-	/* obtain the packet ID and the distance from the beginning of the buffer */
+	/* obtain the packet ID and the insertion sequence number */
 	newPacket.packetID = PID;
-	newPacket.distanceFromBegin = Buff->getDistanceFromBegin(newPacket.packetID);
+	newPacket.insertionSeq = Buff->getInsertionSeq(newPacket.packetID);
 
 
 	/* sanity check */
-	if(newPacket.distanceFromBegin == -1)
+	if(newPacket.insertionSeq == -1)
 	{
 		printf("\n[Error]: (FIFO::addPacket) The packet with ID %d does not exist inside the packet buffer of node %d\n\n", PID, nodeID);
 		exit(EXIT_FAILURE);
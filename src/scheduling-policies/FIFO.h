@@ -39,17 +39,17 @@ using namespace std;
 struct FIFOPacket
 {
 	int packetID;
-	int distanceFromBegin;
+	long int insertionSeq;
 
 	bool operator < (const FIFOPacket& str) const
 	{
-		if(distanceFromBegin < str.distanceFromBegin)
+		if(insertionSeq < str.insertionSeq)
 		{
 			return true;
 		}
-		else if(distanceFromBegin == str.distanceFromBegin)
+		else if(insertionSeq == str.insertionSeq)
 		{
-			printf("\n[Error]: (FIFOPacket) The packets with IDs %d and %d have the same distance from the beginning of the packet buffer\n\n", packetID, str.packetID);
+			printf("\n[Error]: (FIFOPacket) The packets with IDs %d and %d have the same insertion sequence number\n\n", packetID, str.packetID);
 			exit(EXIT_FAILURE);
 		}
 		else
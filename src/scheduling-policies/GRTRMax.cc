@@ -55,15 +55,15 @@ void GRTRMax::addPacket(int PID, void *additionalInfo)
 	}
 
 
-	/* obtain the packet ID, the distance from the beginning of the buffer, and the receiver's utility value for the packet */
+	/* obtain the packet ID, the insertion sequence number, and the receiver's utility value for the packet */
 	newPacket.packetID = PID;
-	newPacket.distanceFromBegin = Buff->getDistanceFromBegin(newPacket.packetID);
+	newPacket.insertionSeq = Buff->getInsertionSeq(newPacket.packetID);
 	newPacket.receiverUtil = ((ExchangedInformation *) additionalInfo)->recUtil;
 	free(additionalInfo);
 
 
 	/* sanity check */
-	if(newPacket.distanceFromBegin == -1)
+	if(newPacket.insertionSeq == -1)
 	{
 		printf("\n[Error]: (GRTRMax::addPacket) The packet with ID %d does not exist inside the packet buffer of node %d\n\n", PID, nodeID);
 		exit(EXIT_FAILURE);
@@ -39,7 +39,7 @@ using namespace std;
 struct GRTRMaxPacket
 {
 	int packetID;
-	int distanceFromBegin;
+	long int insertionSeq;
 	double receiverUtil;
 
 	bool operator < (const GRTRMaxPacket& str) const
@@ -50,13 +50,13 @@ struct GRTRMaxPacket
 		}
 		else if(receiverUtil == str.receiverUtil)
 		{
-			if(distanceFromBegin < str.distanceFromBegin)
+			if(insertionSeq < str.insertionSeq)
 			{
 				return true;
 			}
-			else if(distanceFromBegin == str.distanceFromBegin)
+			else if(insertionSeq == str.insertionSeq)
 			{
-				printf("\n[Error]: (GRTRMaxPacket) The packets with IDs %d and %d have the same distance from the beginning of the packet buffer\n\n", packetID, str.packetID);
+				printf("\n[Error]: (GRTRMaxPacket) The packets with IDs %d and %d have the same insertion sequence number\n\n", packetID, str.packetID);
 				exit(EXIT_FAILURE);
 			}
 			else
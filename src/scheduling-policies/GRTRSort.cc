@@ -55,15 +55,15 @@ void GRTRSort::addPacket(int PID, void *additionalInfo)
 	}
 
 
-	/* obtain the packet ID, the distance from the beginning of the buffer, and the difference between utility values of the nodes for the packet */
+	/* obtain the packet ID, the insertion sequence number, and the difference between utility values of the nodes for the packet */
 	newPacket.packetID = PID;
-	newPacket.distanceFromBegin = Buff->getDistanceFromBegin(newPacket.packetID);
+	newPacket.insertionSeq = Buff->getInsertionSeq(newPacket.packetID);
 	newPacket.utilDifference = ((ExchangedInformation *) additionalInfo)->recUtil - ((ExchangedInformation *) additionalInfo)->senUtil;
 	free(additionalInfo);
 
 
 	/* sanity check */
-	if(newPacket.distanceFromBegin == -1)
+	if(newPacket.insertionSeq == -1)
 	{
 		printf("\n[Error]: (GRTRSort::addPacket) The packet with ID %d does not exist inside the packet buffer of node %d\n\n", PID, nodeID);
 		exit(EXIT_FAILURE);
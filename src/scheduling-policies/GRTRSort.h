@@ -39,7 +39,7 @@ using namespace std;
 struct GRTRSortPacket
 {
 	int packetID;
-	int distanceFromBegin;
+	long int insertionSeq;
 	double utilDifference;
 
 	bool operator < (const GRTRSortPacket& str) const
@@ -50,13 +50,13 @@ struct GRTRSortPacket
 		}
 		else if(utilDifference == str.utilDifference)
 		{
-			if(distanceFromBegin < str.distanceFromBegin)
+			if(insertionSeq < str.insertionSeq)
 			{
 				return true;
 			}
-			else if(distanceFromBegin == str.distanceFromBegin)
+			else if(insertionSeq == str.insertionSeq)
 			{
-				printf("\n[Error]: (GRTRSortPacket) The packets with IDs %d and %d have the same distance from the beginning of the packet buffer\n\n", packetID, str.packetID);
+				printf("\n[Error]: (GRTRSortPacket) The packets with IDs %d and %d have the same insertion sequence number\n\n", packetID, str.packetID);
 				exit(EXIT_FAILURE);
 			}
 			else
@@ -53,13 +53,13 @@ void LIFO::addPacket(int PID, void *additionalInfo)
 	}
 
 
-	/* obtain the packet ID and the distance from the end of the buffer */
+	/* obtain the packet ID and the insertion sequence number */
 	newPacket.packetID = PID;
-	newPacket.distanceFromEnd = Buff->getDistanceFromEnd(newPacket.packetID);
+	newPacket.insertionSeq = Buff->getInsertionSeq(newPacket.packetID);
 
 
 	/* sanity check */
-	if(newPacket.distanceFromEnd == -1)
+	if(newPacket.insertionSeq == -1)
 	{
 		printf("\n[Error]: (LIFO::addPacket) The packet with ID %d does not exist inside the packet buffer of node %d\n\n", PID, nodeID);
 		exit(EXIT_FAILURE);
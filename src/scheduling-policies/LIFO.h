@@ -39,17 +39,17 @@ using namespace std;
 struct LIFOPacket
 {
 	int packetID;
-	int distanceFromEnd;
+	long int insertionSeq;
 
 	bool operator < (const LIFOPacket& str) const
 	{
-		if(distanceFromEnd < str.distanceFromEnd)
+		if(insertionSeq > str.insertionSeq)
 		{
 			return true;
 		}
-		else if(distanceFromEnd == str.distanceFromEnd)
+		else if(insertionSeq == str.insertionSeq)
 		{
-			printf("\n[Error]: (LIFOPacket) The packets with IDs %d and %d have the same distance from the end of the packet buffer\n\n", packetID, str.packetID);
+			printf("\n[Error]: (LIFOPacket) The packets with IDs %d and %d have the same insertion sequence number\n\n", packetID, str.packetID);
 			exit(EXIT_FAILURE);
 		}
 		else
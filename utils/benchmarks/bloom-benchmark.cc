@@ -0,0 +1,115 @@
+/*
+ *  Adyton: A Network Simulator for Opportunistic Networks
+ *  Copyright (C) 2015  Nikolaos Papanikos, Dimitrios-Georgios Akestoridis,
+ *  and Evangelos Papapetrou
+ *
+ *  This file is part of Adyton.
+ *
+ *  Adyton is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Adyton is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Adyton.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/* Compares the standard bloom filter used by the packet depositories with the
+ * cache-line-blocked variant: insertion/lookup throughput, memory and false positive
+ * rate (measured and expected).
+ *
+ * Usage: ./bloom-benchmark [elements] [hashes] [false positive probability] [queries]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <cmath>
+#include <ctime>
+#include <partow/bloom_filter.hpp>
+
+#ifndef BLOCKED_BLOOM_FILTER_H
+	#define BLOCKED_BLOOM_FILTER_H
+	#include "BlockedBloomFilter.h"
+#endif
+
+using namespace std;
+
+
+double elapsed(clock_t start)
+{
+	return (double)(clock()-start)/(double)CLOCKS_PER_SEC;
+}
+
+int main(int argc, char *argv[])
+{
+	unsigned long long n=(argc > 1)?strtoull(argv[1],NULL,10):100000;
+	unsigned int k=(argc > 2)?(unsigned int)atoi(argv[2]):5;
+	double p=(argc > 3)?atof(argv[3]):0.001;
+	unsigned long long q=(argc > 4)?strtoull(argv[4],NULL,10):10000000;
+	unsigned long long hits=0;
+
+
+	//Same sizing as calcBloomSize() in pktDepository.cc
+	double bits=(-(double)k*(double)n)/log(1.0-pow(p,1.0/(double)k));
+	printf("Elements: %llu, hashes: %u, target false positive probability: %f, queries: %llu\n\n",n,k,p,q);
+
+	bloom_parameters parameters;
+	parameters.projected_element_count=n;
+	parameters.optimal_parameters.number_of_hashes=k;
+	parameters.false_positive_probability=p;
+	parameters.random_seed=0xA5A5A5A5;
+	parameters.optimal_parameters.table_size=(unsigned long long)bits;
+	parameters.optimal_parameters.table_size+=(((parameters.optimal_parameters.table_size % bits_per_char) != 0)?(bits_per_char-(parameters.optimal_parameters.table_size % bits_per_char)):0);
+	bloom_filter standard(parameters);
+	BlockedBloomFilter blocked((unsigned long long)bits,k,0xA5A5A5A5);
+
+	printf("%-10s %12s %14s %14s %12s %12s\n","Filter","Size (KB)","Insert (ns)","Lookup (ns)","FPR","Expected");
+
+	//Standard filter (members are 0..n-1, queries are non-members)
+	clock_t start=clock();
+	for(unsigned long long i=0;i<n;i++)
+	{
+		standard.insert(i);
+	}
+	double insertTime=elapsed(start);
+	start=clock();
+	for(unsigned long long i=0;i<q;i++)
+	{
+		hits+=standard.contains(n+i);
+	}
+	double lookupTime=elapsed(start);
+	printf("%-10s %12.2f %14.2f %14.2f %12.6f %12.6f\n","standard",standard.size()/(8.0*1024.0),1e9*insertTime/n,1e9*lookupTime/q,(double)hits/(double)q,standard.effective_fpp());
+
+	//Blocked filter
+	hits=0;
+	start=clock();
+	for(unsigned long long i=0;i<n;i++)
+	{
+		blocked.insert(i);
+	}
+	insertTime=elapsed(start);
+	start=clock();
+	for(unsigned long long i=0;i<q;i++)
+	{
+		hits+=blocked.contains(n+i);
+	}
+	lookupTime=elapsed(start);
+	printf("%-10s %12.2f %14.2f %14.2f %12.6f %12.6f\n","blocked",blocked.size()/(8.0*1024.0),1e9*insertTime/n,1e9*lookupTime/q,(double)hits/(double)q,blocked.falsePositiveRate(n));
+
+	//Sanity check: no false negatives
+	for(unsigned long long i=0;i<n;i++)
+	{
+		if(!blocked.contains(i) || !standard.contains(i))
+		{
+			printf("Error - False negative for element %llu!\n",i);
+			exit(1);
+		}
+	}
+	return 0;
+}
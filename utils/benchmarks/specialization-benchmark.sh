@@ -0,0 +1,81 @@
+#!/bin/bash
+
+#  Adyton: A Network Simulator for Opportunistic Networks
+#  Copyright (C) 2015  Nikolaos Papanikos, Dimitrios-Georgios Akestoridis,
+#  and Evangelos Papapetrou
+#
+#  This file is part of Adyton.
+#
+#  Adyton is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  Adyton is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with Adyton.  If not, see <http://www.gnu.org/licenses/>.
+
+
+# Compares the running time of a specialized binary (see "make specialized") with the one of
+# the generic binary for the same simulation, and verifies that both produce the same results.
+#
+# Usage: ./specialization-benchmark.sh <generic binary> <specialized binary> <runs> <simulator arguments>
+
+if [ $# -lt 3 ]; then
+	echo "Usage: $0 <generic binary> <specialized binary> <runs> <simulator arguments>";
+	exit 1;
+fi
+
+generic=$1;
+specialized=$2;
+runs=$3;
+shift 3;
+
+workdir=$(mktemp -d);
+trap 'rm -rf "$workdir"' EXIT;
+
+# Prints the minimum running time (in milliseconds) over all runs
+measure()
+{
+	local binary=$1;
+	local resdir=$2;
+	local best=0;
+	local start;
+	local end;
+	local elapsed;
+
+	mkdir -p "$resdir";
+	for (( i=0; i<runs; i++ )); do
+		start=$(date +%s%N);
+		if ! "$binary" "${@:3}" -RES_DIR "$resdir/" -BATCH ON > /dev/null; then
+			echo "The simulation of $binary failed" >&2;
+			exit 1;
+		fi
+		end=$(date +%s%N);
+		elapsed=$(( (end - start) / 1000000 ));
+		if [ $best -eq 0 ] || [ $elapsed -lt $best ]; then
+			best=$elapsed;
+		fi
+	done
+	echo $best;
+}
+
+genericTime=$(measure "$generic" "$workdir/generic" "$@") || exit 1;
+specializedTime=$(measure "$specialized" "$workdir/specialized" "$@") || exit 1;
+
+for f in "$workdir"/generic/*; do
+	name=$(basename "$f");
+	if [ "$name" != "SimulationSettings.txt" ] && ! cmp -s "$f" "$workdir/specialized/$name"; then
+		echo "The results of the two binaries differ ($name)";
+		exit 1;
+	fi
+done
+
+echo "Generic binary:     $genericTime ms";
+echo "Specialized binary: $specializedTime ms";
+ratio=$(( genericTime * 100 / specializedTime ));
+printf "Speedup:            %d.%02dx\n" $(( ratio / 100 )) $(( ratio % 100 ));
@@ -0,0 +1,157 @@
+/*
+ *  Adyton: A Network Simulator for Opportunistic Networks
+ *  Copyright (C) 2015  Nikolaos Papanikos, Dimitrios-Georgios Akestoridis,
+ *  and Evangelos Papapetrou
+ *
+ *  This file is part of Adyton.
+ *
+ *  Adyton is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Adyton is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Adyton.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/* Converts predefined traffic files between the text format (one "creation time, source,
+ * destination" line per packet) and the binary format that Adyton streams during the
+ * simulation. Text input is sorted by creation time (packets with the same creation
+ * time keep their order), so any text traffic file can be converted.
+ *
+ * Usage: ./traffic-converter <input file> <output file>
+ * A text input file produces a binary output file and vice versa.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include <algorithm>
+
+#include "../../src/core/TrafficGen.h"
+
+using namespace std;
+
+
+static bool EarlierPacket(const AppPacket &a, const AppPacket &b)
+{
+	return a.Time < b.Time;
+}
+
+
+static void textToBinary(FILE *in, FILE *out, const char *outName)
+{
+	char line[512];
+	long long count;
+	vector<AppPacket> packets;
+	AppPacket pkt;
+
+
+	while(fgets(line, 512, in))
+	{
+		if(sscanf(line, "%lf %d %d", &pkt.Time, &pkt.Source, &pkt.Dest) == 3)
+		{
+			packets.push_back(pkt);
+		}
+	}
+
+	stable_sort(packets.begin(), packets.end(), EarlierPacket);
+	count = (long long) packets.size();
+
+	if((fwrite(TRAFFIC_MAGIC, 1, TRAFFIC_MAGIC_SIZE, out) != TRAFFIC_MAGIC_SIZE) ||
+	   (fwrite(&count, sizeof(long long), 1, out) != 1) ||
+	   (count > 0 && fwrite(&packets[0], sizeof(AppPacket), packets.size(), out) != packets.size()))
+	{
+		printf("[Error]: Couldn't write the file: %s\n", outName);
+		exit(EXIT_FAILURE);
+	}
+
+	printf("Converted %lld packets to binary format\n", count);
+
+	return;
+}
+
+
+static void binaryToText(FILE *in, FILE *out)
+{
+	long long count;
+	long long written;
+	AppPacket pkt;
+
+
+	if(fread(&count, sizeof(long long), 1, in) != 1)
+	{
+		printf("[Error]: Invalid binary traffic file\n");
+		exit(EXIT_FAILURE);
+	}
+
+	written = 0;
+	while(fread(&pkt, sizeof(AppPacket), 1, in) == 1)
+	{
+		fprintf(out, "%.17g\t%d\t%d\n", pkt.Time, pkt.Source, pkt.Dest);
+		written++;
+	}
+
+	if(written != count)
+	{
+		printf("[Warning]: The binary traffic file declares %lld packets, but %lld were found\n", count, written);
+	}
+
+	printf("Converted %lld packets to text format\n", written);
+
+	return;
+}
+
+
+int main(int argc, char *argv[])
+{
+	char magic[TRAFFIC_MAGIC_SIZE];
+	FILE *in;
+	FILE *out;
+
+
+	if(argc != 3)
+	{
+		printf("Usage: %s <input file> <output file>\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	if(!(in = fopen(argv[1], "rb")))
+	{
+		printf("[Error]: Couldn't open the file: %s\n", argv[1]);
+		return EXIT_FAILURE;
+	}
+
+	if(!(out = fopen(argv[2], "wb")))
+	{
+		printf("[Error]: Couldn't open the file: %s\n", argv[2]);
+		return EXIT_FAILURE;
+	}
+
+	if((fread(magic, 1, TRAFFIC_MAGIC_SIZE, in) == TRAFFIC_MAGIC_SIZE) && !memcmp(magic, TRAFFIC_MAGIC, TRAFFIC_MAGIC_SIZE))
+	{
+		binaryToText(in, out);
+	}
+	else
+	{
+		rewind(in);
+		textToBinary(in, out, argv[2]);
+	}
+
+	fclose(in);
+
+	if(fclose(out))
+	{
+		printf("[Error]: Couldn't close the file: %s\n", argv[2]);
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}